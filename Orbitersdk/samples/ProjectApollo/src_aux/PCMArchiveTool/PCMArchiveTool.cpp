@@ -0,0 +1,218 @@
+/***************************************************************************
+  This file is part of Project Apollo - NASSP
+  Copyright 2026
+
+  PCM Telemetry Archive Tool
+
+  Project Apollo is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  Project Apollo is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Project Apollo; if not, write to the Free Software
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+  See http://nassp.sourceforge.net/license/ for more details.
+
+  **************************************************************************/
+
+#pragma warning(disable : 4996 )
+
+#include "pcmarchive.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+
+// Gaps in the recording are shortened to this many seconds during replay
+#define REPLAY_MAX_GAP	10.0
+
+static void FormatMET(double met, char *buffer)
+{
+	char sign = ' ';
+	if (met < 0) {
+		sign = '-';
+		met = -met;
+	}
+
+	int s = (int)met;
+	sprintf(buffer, "%c%03d:%02d:%06.3f", sign, s / 3600, (s / 60) % 60, met - (s / 60) * 60);
+}
+
+//
+// Accepts MET either in seconds or as HHH:MM:SS.
+//
+
+static double ParseMET(const char *s)
+{
+	int h, m;
+	double sec;
+
+	if (sscanf(s, "%d:%d:%lf", &h, &m, &sec) == 3) {
+		return h * 3600.0 + m * 60.0 + sec;
+	}
+	return atof(s);
+}
+
+static int Info(PCMArchiveReader &r)
+{
+	char first[32], last[32];
+
+	printf("Vehicle: %s\n", r.GetVehicle() == PCM_ARCHIVE_LM ? "LM" : "CSM");
+	printf("Chunks:  %u\n", r.GetChunkCount());
+	printf("Frames:  %llu\n", r.GetFrameCount());
+
+	if (r.GetChunkCount() == 0)
+		return 0;
+
+	FormatMET(r.GetChunkEntry(0).firstMET, first);
+	FormatMET(r.GetChunkEntry(r.GetChunkCount() - 1).lastMET, last);
+	printf("MET:     %s to %s\n", first, last);
+	return 0;
+}
+
+static int Dump(PCMArchiveReader &r, double met, int count)
+{
+	if (!r.Seek(met)) {
+		fprintf(stderr, "No frames at or after that MET\n");
+		return 1;
+	}
+
+	do {
+		const PCMArchiveFrame *f = r.GetFrame();
+		const unsigned char *words = PCMArchiveReader::GetWords(f);
+		char buffer[32];
+
+		FormatMET(f->met, buffer);
+		printf("%s MJD %.8f words %d-%d\n", buffer, f->mjd, f->firstWord, f->firstWord + f->words - 1);
+
+		for (int i = f->firstWord; i < f->firstWord + f->words; i++) {
+			printf("%03o%c", words[i], ((i + 1) % 16 == 0) ? '\n' : ' ');
+		}
+		printf("\n");
+	} while (--count > 0 && r.Next());
+
+	return 0;
+}
+
+//
+// Acts like the PCM in the simulation: listens on the telemetry port and sends the
+// recorded frames to the client which connects, paced by their timestamps.
+//
+
+static int Replay(PCMArchiveReader &r, double met, double speed, int port)
+{
+	if (!r.Seek(met)) {
+		fprintf(stderr, "No frames at or after that MET\n");
+		return 1;
+	}
+
+	WSADATA wsaData;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != NO_ERROR) {
+		fprintf(stderr, "WSAStartup() failed\n");
+		return 1;
+	}
+
+	SOCKET listener = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	sockaddr_in service;
+	service.sin_family = AF_INET;
+	service.sin_addr.s_addr = htonl(INADDR_ANY);
+	service.sin_port = htons(port);
+
+	if (listener == INVALID_SOCKET || ::bind(listener, (SOCKADDR*)&service, sizeof(service)) == SOCKET_ERROR || listen(listener, 1) == SOCKET_ERROR) {
+		fprintf(stderr, "Can't listen on port %d: %ld\n", port, WSAGetLastError());
+		WSACleanup();
+		return 1;
+	}
+
+	printf("Waiting for telemetry client on port %d\n", port);
+	SOCKET client = accept(listener, NULL, NULL);
+	closesocket(listener);
+
+	if (client == INVALID_SOCKET) {
+		fprintf(stderr, "accept() failed: %ld\n", WSAGetLastError());
+		WSACleanup();
+		return 1;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double replayTime = 0.0;
+	double lastMET = r.GetFrame()->met;
+	unsigned long long frames = 0;
+
+	do {
+		const PCMArchiveFrame *f = r.GetFrame();
+		double gap = f->met - lastMET;
+
+		if (gap > REPLAY_MAX_GAP * speed) {
+			gap = REPLAY_MAX_GAP * speed;
+		}
+		replayTime += gap / speed;
+		lastMET = f->met;
+
+		std::this_thread::sleep_until(start + std::chrono::duration<double>(replayTime));
+
+		if (send(client, (const char *)PCMArchiveReader::GetWords(f) + f->firstWord, f->words, 0) == SOCKET_ERROR) {
+			fprintf(stderr, "Client disconnected\n");
+			break;
+		}
+
+		if (++frames % 3000 == 0) {
+			char buffer[32];
+			FormatMET(f->met, buffer);
+			printf("MET %s\r", buffer);
+		}
+	} while (r.Next());
+
+	printf("\n%llu frames sent\n", frames);
+
+	closesocket(client);
+	WSACleanup();
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 3) {
+		fprintf(stderr, "Usage:\n");
+		fprintf(stderr, "  PCMArchiveTool info <archive>\n");
+		fprintf(stderr, "  PCMArchiveTool dump <archive> [MET] [frames]\n");
+		fprintf(stderr, "  PCMArchiveTool replay <archive> [MET] [speed] [port]\n");
+		fprintf(stderr, "MET is given in seconds or as HHH:MM:SS.\n");
+		return 1;
+	}
+
+	PCMArchiveReader r;
+	if (!r.Open(argv[2])) {
+		fprintf(stderr, "Can't open archive %s\n", argv[2]);
+		return 1;
+	}
+
+	double met = (argc > 3) ? ParseMET(argv[3]) : -1e300;
+
+	if (!stricmp(argv[1], "info")) {
+		return Info(r);
+	}
+	if (!stricmp(argv[1], "dump")) {
+		return Dump(r, met, (argc > 4) ? atoi(argv[4]) : 1);
+	}
+	if (!stricmp(argv[1], "replay")) {
+		double speed = (argc > 4) ? atof(argv[4]) : 1.0;
+		int port = (argc > 5) ? atoi(argv[5]) : (r.GetVehicle() == PCM_ARCHIVE_LM ? 14243 : 14242);
+
+		if (speed <= 0) {
+			fprintf(stderr, "Speed has to be positive\n");
+			return 1;
+		}
+		return Replay(r, met, speed, port);
+	}
+
+	fprintf(stderr, "Unknown command %s\n", argv[1]);
+	return 1;
+}
@@ -736,9 +736,9 @@ void HGA::TimeStep(double simt, double simdt)
 	if (hga_proc[1] < 0) hga_proc[1] += 1.0;
 	hga_proc[2] = (Gamma - PI05) / PI2;
 	if (hga_proc[2] < 0) hga_proc[2] += 1.0;
-	if (hga_proc[0] - hga_proc_last[0] != 0.0) sat->SetAnimation(anim_HGAalpha, hga_proc[0]);
-	if (hga_proc[1] - hga_proc_last[1] != 0.0) sat->SetAnimation(anim_HGAbeta, hga_proc[1]);
-	if (hga_proc[2] - hga_proc_last[2] != 0.0) sat->SetAnimation(anim_HGAgamma, hga_proc[2]);
+	if (hga_proc[0] - hga_proc_last[0] != 0.0) sat->QueueAnimation(anim_HGAalpha, hga_proc[0]);
+	if (hga_proc[1] - hga_proc_last[1] != 0.0) sat->QueueAnimation(anim_HGAbeta, hga_proc[1]);
+	if (hga_proc[2] - hga_proc_last[2] != 0.0) sat->QueueAnimation(anim_HGAgamma, hga_proc[2]);
 	hga_proc_last[0] = hga_proc[0];
 	hga_proc_last[1] = hga_proc[1];
 	hga_proc_last[2] = hga_proc[2];
@@ -1258,9 +1258,9 @@ void HGA::clbkPostCreation()
 	if (hga_proc[1] < 0) hga_proc[1] += 1.0;
 	hga_proc[2] = (Gamma - PI05) / PI2;
 	if (hga_proc[2] < 0) hga_proc[2] += 1.0;
-	sat->SetAnimation(anim_HGAalpha, hga_proc[0]);
-	sat->SetAnimation(anim_HGAbeta, hga_proc[1]);
-	sat->SetAnimation(anim_HGAgamma, hga_proc[2]);
+	sat->ApplyAnimation(anim_HGAalpha, hga_proc[0]);
+	sat->ApplyAnimation(anim_HGAbeta, hga_proc[1]);
+	sat->ApplyAnimation(anim_HGAgamma, hga_proc[2]);
 	hga_proc_last[0] = hga_proc[0];
 	hga_proc_last[1] = hga_proc[1];
 	hga_proc_last[2] = hga_proc[2];
@@ -2025,22 +2025,412 @@ void UDL::LoadState(FILEHANDLE scn)
 }
 
 // PCM SYSTEM
+
+//
+// PCM downlink word maps, indexed by word address and 5-frame subcommutation count.
+// Words present in every frame repeat the same entry five times.
+//
+
+// Most words generated in one timestep before frames are skipped, about 10 seconds of HBR
+#define PCM_MAX_STEP_WORDS 65536
+
+// LBR: 40 words per frame
+const PCMWordDef CSMLBRFormat::Map[CSMLBRFormat::Words][CSMLBRFormat::Subframes] = {
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 05) },	// 0: SYNC 1
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0171) },	// 1: SYNC 2
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0267) },	// 2: SYNC 3
+	{ PCM_WORD_ALL(0, PCM_WORD_FRAMECOUNT, 0300) },	// 3: SYNC 4 & FRAME COUNT
+	{ { 11, TLM_A, 1 }, { 11, TLM_A, 109 }, { 11, TLM_A, 46 }, { 11, TLM_A, 154 }, { 11, TLM_A, 91 } },	// 4: 11A1 ECS: SUIT MANF ABS PRESS / 11A109 EPS: BAT B CURR / 11A46 RCS: SM HE MANF C PRESS / 11A154 CMI: SCE NEG SUPPLY VOLTS / 11A91 EPS: BAT BUS A VOLTS
+	{ { 11, TLM_A, 2 }, { 11, TLM_A, 110 }, { 11, TLM_A, 47 }, { 11, TLM_A, 155 }, { 11, TLM_A, 92 } },	// 5: 11A2 ECS: SUIT COMP DELTA P / 11A110 EPS: BAT C CURR / 11A47 EPS: LM HEATER CURRENT / 11A155 RCS: CM HE TK A TEMP / 11A92 RCS: SM FU MANF A PRESS
+	{ { 11, TLM_A, 3 }, { 11, TLM_A, 111 }, { 11, TLM_A, 48 }, { 11, TLM_A, 156 }, { 11, TLM_A, 93 } },	// 6: 11A3 ECS: GLY PUMP OUT PRESS / 11A111 ECS: SM FU MANF C PRESS / 11A48 PCM HI LEVEL 85 PCT REF / 11A156 CM HE TK B TEMP / 11A93 BAT BUS B VOLTS
+	{ { 11, TLM_A, 4 }, { 11, TLM_A, 112 }, { 11, TLM_A, 49 }, { 11, TLM_A, 157 }, { 11, TLM_A, 94 } },	// 7: 11A4 ECS SURGE TANK PRESS / 11A112 SM FU MANF D PRESS / 11A49 PC HI LEVEL 15 PCT REF / 11A157 SEC GLY PUMP OUT PRESS / 11A94 SM FU MANF B PRESS
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 0) },	// 8: 51DS1A COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 1) },	// 9: 51DS1B COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 2) },	// 10: 51DS1C COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 3) },	// 11: 51DS1D COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 4) },	// 12: 51DS1E COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 13: 51DP2 UP-DATA-LINK VALIDITY BITS (4 BITS)
+	{ { 10, TLM_A, 123 }, { 10, TLM_A, 126 }, { 10, TLM_A, 129 }, { 10, TLM_A, 132 }, { 10, TLM_A, 135 } },	// 14: 10A123 FC 2 COND EXH TEMP / 10A126 FC 1 RAD OUT TEMP / 10A129 FC 2 RAD OUT TEMP / 10A132 FC 3 RAD OUT TEMP / 10A135 URINE DUMP NOZZLE TEMP
+	{ { 10, TLM_A, 138 }, { 10, TLM_A, 141 }, { 10, TLM_A, 144 }, { 10, TLM_A, 147 }, { 10, TLM_A, 150 } },	// 15: 10A138 TM BIAS 2.5 VDC / 10A141 EPS: H2 TK 1 QTY / 10A144 H2 TK 2 QTY / 10A147 O2 TK 1 QTY / 10A150 O2 TK 1 PRESS
+	{ { 10, TLM_A, 3 }, { 10, TLM_A, 6 }, { 10, TLM_A, 9 }, { 10, TLM_A, 12 }, { 10, TLM_A, 15 } },	// 16: 10A3 / 10A6 / 10A9 / 10A12 / 10A15
+	{ { 10, TLM_A, 18 }, { 10, TLM_A, 21 }, { 10, TLM_A, 24 }, { 10, TLM_A, 27 }, { 10, TLM_A, 30 } },	// 17: 10A18 / 10A21 / 10A24 / 10A27 / 10A30
+	{ { 10, TLM_A, 33 }, { 10, TLM_A, 36 }, { 10, TLM_A, 39 }, { 10, TLM_A, 42 }, { 10, TLM_A, 45 } },	// 18: 10A33 / 10A36 H2 TK 1 PRESS / 10A39 H2 TK 2 PRESS / 10A42 O2 TK 2 QTY / 10A45
+	{ { 10, TLM_A, 48 }, { 10, TLM_A, 51 }, { 10, TLM_A, 54 }, { 10, TLM_A, 57 }, { 10, TLM_A, 60 } },	// 19: 10A48 / 10A51 / 10A54 O2 TK 1 TEMP / 10A57 O2 TK 2 TEMP / 10A60 H2 TK 1 TEMP
+	{ { 10, TLM_DP, 1 }, { 11, TLM_DP, 6 }, { 11, TLM_DP, 27 }, { 11, TLM_DP, 17 }, { 11, TLM_DP, 20 } },	// 20: 10DP1 / 11DP6 / 11DP27 / 11DP15 / 11DP20
+	{ { 0, TLM_SRC, 0 }, { 11, TLM_DP, 7 }, { 11, TLM_DP, 28 }, { 11, TLM_DP, 16 }, { 11, TLM_DP, 21 } },	// 21: SRC 0 / 11DP7 / 11DP28 / 11DP16 / 11DP21
+	{ { 11, TLM_A, 39 }, { 11, TLM_A, 147 }, { 11, TLM_A, 84 }, { 11, TLM_A, 21 }, { 11, TLM_A, 129 } },	// 22: 11A39 / 11A147 AC BUS 1 PH A VOLTS / 11A84 / 11A21 / 11A129
+	{ { 11, TLM_A, 40 }, { 11, TLM_A, 48 }, { 11, TLM_A, 85 }, { 11, TLM_A, 22 }, { 11, TLM_A, 130 } },	// 23: 11A40 / 11A48 / 11A85 / 11A22 / 11A130
+	{ { 11, TLM_A, 73 }, { 11, TLM_A, 10 }, { 11, TLM_A, 118 }, { 11, TLM_A, 55 }, { 11, TLM_A, 163 } },	// 24: 11A73 BAT CHRGR AMPS / 11A10 / 11A118 / 11A55 / 11A163
+	{ { 11, TLM_A, 74 }, { 11, TLM_A, 11 }, { 11, TLM_A, 119 }, { 11, TLM_A, 56 }, { 11, TLM_A, 164 } },	// 25: 11A74 BAT A CUR / 11A11 / 11A119 / 11A56 AC BUS 2 PH A VOLTS / 11A164
+	{ { 11, TLM_A, 75 }, { 11, TLM_A, 12 }, { 11, TLM_A, 120 }, { 11, TLM_A, 57 }, { 11, TLM_A, 165 } },	// 26: 11A75 / 11A12 / 11A120 / 11A57 / 11A165
+	{ { 11, TLM_A, 76 }, { 11, TLM_A, 13 }, { 11, TLM_A, 121 }, { 11, TLM_A, 58 }, { 11, TLM_A, 166 } },	// 27: 11A76 / 11A13 / 11A121 / 11A58 / 11A166
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 0) },	// 28: 51DS1A COMPUTER DIGITAL DATA (40 BITS) (repeat)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 1) },	// 29: 51DS1B COMPUTER DIGITAL DATA (40 BITS) (repeat)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 2) },	// 30: 51DS1C COMPUTER DIGITAL DATA (40 BITS) (repeat)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 3) },	// 31: 51DS1D COMPUTER DIGITAL DATA (40 BITS) (repeat)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 4) },	// 32: 51DS1E COMPUTER DIGITAL DATA (40 BITS) (repeat)
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 33: 51DP2 UP-DATA-LINK VALIDITY BITS (4 BITS) (repeat)
+	{ { 11, TLM_DP, 3 }, { 11, TLM_DP, 8 }, { 11, TLM_DP, 13 }, { 11, TLM_DP, 29 }, { 11, TLM_DP, 22 } },	// 34: 11DP3 / 11DP8 / 11DP13 / 11DP29 / 11DP22
+	{ { 0, TLM_SRC, 1 }, { 11, TLM_DP, 9 }, { 11, TLM_DP, 14 }, { 11, TLM_DP, 17 }, { 11, TLM_DP, 23 } },	// 35: SRC 1 / 11DP9 / 11DP14 / 11DP17 / 11DP23
+	{ { 10, TLM_A, 63 }, { 10, TLM_A, 66 }, { 10, TLM_A, 69 }, { 10, TLM_A, 72 }, { 10, TLM_A, 75 } },	// 36: 10A63 H2 TK 2 TEMP / 10A66 O2 TK 2 PRESS / 10A69 / 10A72 / 10A75
+	{ { 10, TLM_A, 78 }, { 10, TLM_A, 81 }, { 10, TLM_A, 84 }, { 10, TLM_A, 87 }, { 10, TLM_A, 90 } },	// 37: 10A78 / 10A81 / 10A84 / 10A87 / 10A90
+	{ { 10, TLM_A, 93 }, { 10, TLM_A, 96 }, { 10, TLM_A, 99 }, { 10, TLM_A, 102 }, { 10, TLM_A, 105 } },	// 38: 10A93 / 10A96 / 10A99 / 10A102 / 10A105
+	{ { 10, TLM_A, 108 }, { 10, TLM_A, 11 }, { 10, TLM_A, 114 }, { 10, TLM_A, 117 }, { 10, TLM_A, 120 } },	// 39: 10A108 / 10A111 / 10A114 / 10A117 / 10A120
+};
+
+// HBR: 128 words per frame
+const PCMWordDef CSMHBRFormat::Map[CSMHBRFormat::Words][CSMHBRFormat::Subframes] = {
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 05) },	// 0: SYNC 1
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0171) },	// 1: SYNC 2
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0267) },	// 2: SYNC 3
+	{ PCM_WORD_ALL(0, PCM_WORD_FRAMEADDR, 0300) },	// 3: SYNC 4 & FRAME COUNT
+	{ PCM_WORD_ALL(22, TLM_A, 1) },	// 4: 22A1 ASTRO 1 EKG AXIS 2
+	{ PCM_WORD_ALL(22, TLM_A, 2) },	// 5: 22A2 ASTRO 1 EKG AXIS 3
+	{ PCM_WORD_ALL(22, TLM_A, 3) },	// 6: 22A3 ASTRO 1 EKG AXIS 1
+	{ PCM_WORD_ALL(22, TLM_A, 4) },	// 7: 22A4 PITCH DIFF CLUTCH CURRENT
+	{ { 11, TLM_A, 1 }, { 11, TLM_A, 37 }, { 11, TLM_A, 73 }, { 11, TLM_A, 109 }, { 11, TLM_A, 145 } },	// 8: 11A1 SUIT MANF ABS PRESS / 11A37 SUIT-CABIN DELTA PRESS / 11A73 BAT CHARGER AMPS / 11A109 BAT B CUR / 11A145
+	{ { 11, TLM_A, 2 }, { 11, TLM_A, 38 }, { 11, TLM_A, 74 }, { 11, TLM_A, 110 }, { 11, TLM_A, 146 } },	// 9: 11A2 SUIT COMP DELTA P / 11A38 ALPHA CT RATE CHAN 1 / 11A74 BAT A CUR / 11A110 BAT C CUR / 11A146
+	{ { 11, TLM_A, 3 }, { 11, TLM_A, 39 }, { 11, TLM_A, 75 }, { 11, TLM_A, 111 }, { 11, TLM_A, 147 } },	// 10: 11A3 GLY PUMP OUT PRESS / 11A39 SM HE MANF A PRESS / 11A75 BAT RELAY BUS VOLTS / 11A111 SM FU MANF C PRESS / 11A147 AC BUS 1 PH A VOLTS
+	{ { 11, TLM_A, 4 }, { 11, TLM_A, 40 }, { 11, TLM_A, 76 }, { 11, TLM_A, 112 }, { 11, TLM_A, 148 } },	// 11: 11A4 ECS SURGE TANK PRESS / 11A40 SM HE MANF B PRESS / 11A76 FC 1 CUR / 11A112 SM FU MANF D PRESS / 11A148 SCE POS SUPPLY VOLTS
+	{ PCM_WORD_ALL(12, TLM_A, 1) },	// 12: 12A1 MGA SERVO ERR IN PHASE
+	{ PCM_WORD_ALL(12, TLM_A, 2) },	// 13: 12A2 IGA SERVO ERR IN PHASE
+	{ PCM_WORD_ALL(12, TLM_A, 3) },	// 14: 12A3 OGA SERVO ERR IN PHASE
+	{ PCM_WORD_ALL(12, TLM_A, 4) },	// 15: 12A4 ROLL ATT ERR
+	{ { 11, TLM_A, 5 }, { 11, TLM_A, 41 }, { 11, TLM_A, 77 }, { 11, TLM_A, 113 }, { 11, TLM_A, 149 } },	// 16: 11A5 PYRO BUS B VOLTS / 11A41 ALPHA CT RATE CHAN 2 / 11A77 FC 1 H2 FLOW / 11A113 / 11A149
+	{ PCM_WORD_ALL(22, TLM_DP, 1) },	// 17: 22DP1
+	{ PCM_WORD_ALL(22, TLM_DP, 2) },	// 18: 22DP2
+	{ { 10, TLM_DP, 1 }, { 0, TLM_SRC, 0 }, { 0, TLM_SRC, 1 }, { 0, PCM_WORD_CONST, 0 }, { 0, PCM_WORD_CONST, 0 } },	// 19: 10DP1 / SRC-0 / SRC-1 / (Zeroes?) / (Zeroes?)
+	{ PCM_WORD_ALL(12, TLM_A, 5) },	// 20: 12A5 SCS PITCH BODY RATE
+	{ PCM_WORD_ALL(12, TLM_A, 6) },	// 21: 12A6 SCS YAW BODY RATE
+	{ PCM_WORD_ALL(12, TLM_A, 7) },	// 22: 12A7 SCS ROLL BODY RATE
+	{ PCM_WORD_ALL(12, TLM_A, 8) },	// 23: 12A8 PITCH GIMBL POS 1 OR 2
+	{ { 11, TLM_A, 6 }, { 11, TLM_A, 42 }, { 11, TLM_A, 78 }, { 11, TLM_A, 114 }, { 11, TLM_A, 150 } },	// 24: 11A6 LES LOGIC BUS B VOLTS / 11A42 ALPHA CT RATE CHAN 3 / 11A78 FC 2 H2 FLOW / 11A114 / 11A150
+	{ { 11, TLM_A, 7 }, { 11, TLM_A, 43 }, { 11, TLM_A, 79 }, { 11, TLM_A, 115 }, { 11, TLM_A, 151 } },	// 25: 11A7 / 11A43 PROTON INTEG CT RATE / 11A79 FC 3 H2 FLOW / 11A115 / 11A151
+	{ { 11, TLM_A, 8 }, { 11, TLM_A, 44 }, { 11, TLM_A, 80 }, { 11, TLM_A, 116 }, { 11, TLM_A, 152 } },	// 26: 11A8 LES LOGIC BUS A VOLTS / 11A44 / 11A80 FC 1 O2 FLOW / 11A116 / 11A152 FUEL SM/ENG INTERFACE P
+	{ { 11, TLM_A, 9 }, { 11, TLM_A, 45 }, { 11, TLM_A, 81 }, { 11, TLM_A, 117 }, { 11, TLM_A, 153 } },	// 27: 11A9 PYRO BUS A VOLTS / 11A45 / 11A81 FC 2 O2 FLOW / 11A117 / 11A153
+	{ PCM_WORD_ALL(51, TLM_A, 1) },	// 28: 51A1
+	{ PCM_WORD_ALL(51, TLM_A, 2) },	// 29: 51A2
+	{ PCM_WORD_ALL(51, TLM_A, 3) },	// 30: 51A3
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 0) },	// 31: 51DS1A COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 1) },	// 32: 51DS1B COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 2) },	// 33: 51DS1C COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 3) },	// 34: 51DS1C COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 4) },	// 35: 51DS1E COMPUTER DIGITAL DATA (40 BITS)
+	{ PCM_WORD_ALL(22, TLM_A, 1) },	// 36: 22A1 ASTRO 1 EKG AXIS 2 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 2) },	// 37: 22A2 ASTRO 1 EKG AXIS 3 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 3) },	// 38: 22A3 ASTRO 1 EKG AXIS 1 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 4) },	// 39: 22A4 PITCH DIFF CLUTCH CURRENT (repeat)
+	{ { 11, TLM_A, 10 }, { 11, TLM_A, 46 }, { 11, TLM_A, 82 }, { 11, TLM_A, 118 }, { 11, TLM_A, 154 } },	// 40: 11A10 HE TK PRESS / 11A46 SM HE MANF C PRESS / 11A82 FC 3 O2 FLOW / 11A118 SEC EVAP OUT LIQ TEMP / 11A154 SCE NEG SUPPLY VOLTS
+	{ { 11, TLM_A, 11 }, { 11, TLM_A, 47 }, { 11, TLM_A, 83 }, { 11, TLM_A, 119 }, { 11, TLM_A, 155 } },	// 41: 11A11 OX TK PRESS / 11A47 LM HEATER CURRENT / 11A83 / 11A119 SENSOR EXCITATION 5V / 11A155 CM HE TK A TEMP
+	{ { 11, TLM_A, 12 }, { 11, TLM_A, 48 }, { 11, TLM_A, 84 }, { 11, TLM_A, 120 }, { 11, TLM_A, 156 } },	// 42: 11A12 SPS FU TK PRESS / 11A48 PCM HI LEVEL 85 PCT REF / 11A84 FC 2 CUR / 11A120 SENSOR EXCITATION 10V / 11A156 CM HE TK B TEMP
+	{ { 11, TLM_A, 13 }, { 11, TLM_A, 49 }, { 11, TLM_A, 85 }, { 11, TLM_A, 121 }, { 11, TLM_A, 157 } },	// 43: 11A13 GLY ACCUM QTY / 11A49 PCM LO LEVEL 15 PCT REF / 11A85 FC 3 CUR / 11A121 USB RCVR AGC VOLTAGE / 11A157 SEC GLY PUMP OUT PRESS
+	{ PCM_WORD_ALL(12, TLM_A, 9) },	// 44: 12A9 CM X-AXIS ACCEL
+	{ PCM_WORD_ALL(12, TLM_A, 10) },	// 45: 12A10 YAW GIMBL POS 1 OR 2
+	{ PCM_WORD_ALL(12, TLM_A, 11) },	// 46: 12A11 CM Y-AXIS ACCEL
+	{ PCM_WORD_ALL(12, TLM_A, 12) },	// 47: 12A12 CM Z-AXIS ACCEL
+	{ { 11, TLM_A, 14 }, { 11, TLM_A, 50 }, { 11, TLM_A, 86 }, { 11, TLM_A, 122 }, { 11, TLM_A, 158 } },	// 48: 11A14 ECS O2 FLOW O2 SUPPLY MANF / 11A50 USB RCVR PHASE ERR / 11A86 / 11A122 / 11A158
+	{ PCM_WORD_ALL(22, TLM_DP, 1) },	// 49: 22DP1
+	{ PCM_WORD_ALL(22, TLM_DP, 2) },	// 50: 22DP2
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 0) },	// 51: MAGICAL WORD 1
+	{ PCM_WORD_ALL(12, TLM_A, 13) },	// 52: 12A13
+	{ PCM_WORD_ALL(12, TLM_A, 14) },	// 53: 12A14
+	{ PCM_WORD_ALL(12, TLM_A, 15) },	// 54: 12A15
+	{ PCM_WORD_ALL(12, TLM_A, 16) },	// 55: 12A16
+	{ { 11, TLM_A, 15 }, { 11, TLM_A, 51 }, { 11, TLM_A, 87 }, { 11, TLM_A, 123 }, { 11, TLM_A, 159 } },	// 56: 11A15 / 11A51 / 11A87 / 11A123 / 11A159
+	{ { 11, TLM_A, 16 }, { 11, TLM_A, 52 }, { 11, TLM_A, 88 }, { 11, TLM_A, 124 }, { 11, TLM_A, 160 } },	// 57: 11A16 / 11A52 / 11A88 / 11A124 / 11A160
+	{ { 11, TLM_A, 17 }, { 11, TLM_A, 53 }, { 11, TLM_A, 89 }, { 11, TLM_A, 125 }, { 11, TLM_A, 161 } },	// 58: 11A17 / 11A53 / 11A89 / 11A125 / 11A161
+	{ { 11, TLM_A, 18 }, { 11, TLM_A, 54 }, { 11, TLM_A, 90 }, { 11, TLM_A, 126 }, { 11, TLM_A, 162 } },	// 59: 11A18 / 11A54 / 11A90 / 11A126 / 11A162
+	{ PCM_WORD_ALL(51, TLM_A, 4) },	// 60: 51A4
+	{ PCM_WORD_ALL(51, TLM_A, 5) },	// 61: 51A5
+	{ PCM_WORD_ALL(51, TLM_A, 6) },	// 62: 51A6
+	{ PCM_WORD_ALL(51, TLM_A, 7) },	// 63: 51A7
+	{ { 11, TLM_DP, 2 }, { 11, TLM_DP, 6 }, { 11, TLM_DP, 13 }, { 11, TLM_DP, 20 }, { 11, TLM_DP, 27 } },	// 64: 11DP2A / 11DP6 / 11DP13 / 11DP20 / 11DP27
+	{ { 11, TLM_DP, 2 }, { 11, TLM_DP, 7 }, { 11, TLM_DP, 14 }, { 11, TLM_DP, 21 }, { 11, TLM_DP, 28 } },	// 65: 11DP2B / 11DP7 / 11DP14 / 11DP21 / 11DP28
+	{ { 11, TLM_DP, 2 }, { 11, TLM_DP, 8 }, { 11, TLM_DP, 15 }, { 11, TLM_DP, 22 }, { 11, TLM_DP, 29 } },	// 66: 11DP2C / 11DP8 / 11DP15 / 11DP22 / 11DP29
+	{ { 11, TLM_DP, 2 }, { 11, TLM_DP, 9 }, { 11, TLM_DP, 16 }, { 11, TLM_DP, 23 }, { 11, TLM_DP, 30 } },	// 67: 11DP2D / 11DP9 / 11DP16 / 11DP23 / 11DP30
+	{ PCM_WORD_ALL(22, TLM_A, 1) },	// 68: 22A1 ASTRO 1 EKG AXIS 2 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 2) },	// 69: 22A2 ASTRO 1 EKG AXIS 3 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 3) },	// 70: 22A3 ASTRO 1 EKG AXIS 1 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 4) },	// 71: 22A4 PITCH DIFF CLUTCH CURRENT (repeat)
+	{ { 11, TLM_A, 19 }, { 11, TLM_A, 55 }, { 11, TLM_A, 91 }, { 11, TLM_A, 127 }, { 11, TLM_A, 163 } },	// 72: 11A19 / 11A55 / 11A91 / 11A127 / 11A163
+	{ { 11, TLM_A, 20 }, { 11, TLM_A, 56 }, { 11, TLM_A, 92 }, { 11, TLM_A, 128 }, { 11, TLM_A, 164 } },	// 73: 11A20 / 11A56 AC BUS 2 PH A VOLTS / 11A92 / 11A128 / 11A164
+	{ { 11, TLM_A, 21 }, { 11, TLM_A, 57 }, { 11, TLM_A, 93 }, { 11, TLM_A, 129 }, { 11, TLM_A, 165 } },	// 74: 11A21 / 11A57 MNA VOLTS / 11A93 / 11A129 / 11A165
+	{ { 11, TLM_A, 22 }, { 11, TLM_A, 58 }, { 11, TLM_A, 94 }, { 11, TLM_A, 130 }, { 11, TLM_A, 166 } },	// 75: 11A22 / 11A58 MNB VOLTS / 11A94 / 11A130 / 11A166
+	{ PCM_WORD_ALL(12, TLM_A, 1) },	// 76: 12A1 MGA SERVO ERR IN PHASE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 2) },	// 77: 12A2 IGA SERVO ERR IN PHASE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 3) },	// 78: 12A3 OGA SERVO ERR IN PHASE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 4) },	// 79: 12A4 ROLL ATT ERR (repeat)
+	{ { 11, TLM_A, 23 }, { 11, TLM_A, 59 }, { 11, TLM_A, 95 }, { 11, TLM_A, 131 }, { 11, TLM_A, 167 } },	// 80: 11A23 / 11A59 / 11A95 / 11A131 / 11A167
+	{ PCM_WORD_ALL(22, TLM_DP, 1) },	// 81: 22DP1
+	{ PCM_WORD_ALL(22, TLM_DP, 2) },	// 82: 22DP2
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 1) },	// 83: MAGICAL WORD 2
+	{ PCM_WORD_ALL(12, TLM_A, 5) },	// 84: 12A5 SCS PITCH BODY RATE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 6) },	// 85: 12A6 SCS YAW BODY RATE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 7) },	// 86: 12A7 SCS ROLL BODY RATE (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 8) },	// 87: 12A8 PITCH GIMBL POS 1 OR 2 (repeat)
+	{ { 11, TLM_A, 24 }, { 11, TLM_A, 60 }, { 11, TLM_A, 96 }, { 11, TLM_A, 132 }, { 11, TLM_A, 168 } },	// 88: 11A24 / 11A60 / 11A96 / 11A132 / 11A168
+	{ { 11, TLM_A, 25 }, { 11, TLM_A, 61 }, { 11, TLM_A, 97 }, { 11, TLM_A, 133 }, { 11, TLM_A, 169 } },	// 89: 11A25 / 11A61 / 11A97 / 11A133 / 11A169
+	{ { 11, TLM_A, 26 }, { 11, TLM_A, 62 }, { 11, TLM_A, 98 }, { 11, TLM_A, 134 }, { 11, TLM_A, 170 } },	// 90: 11A26 / 11A62 / 11A98 / 11A134 / 11A170
+	{ { 11, TLM_A, 27 }, { 11, TLM_A, 63 }, { 11, TLM_A, 99 }, { 11, TLM_A, 135 }, { 11, TLM_A, 171 } },	// 91: 11A27 / 11A63 / 11A99 / 11A135 / 11A171
+	{ PCM_WORD_ALL(51, TLM_A, 8) },	// 92: 51A8
+	{ PCM_WORD_ALL(51, TLM_A, 9) },	// 93: 51A9
+	{ PCM_WORD_ALL(51, TLM_A, 10) },	// 94: 51A10
+	{ PCM_WORD_ALL(51, TLM_A, 11) },	// 95: 51A11
+	{ { 11, TLM_DP, 3 }, { 11, TLM_DP, 10 }, { 11, TLM_DP, 17 }, { 11, TLM_DP, 24 }, { 11, TLM_DP, 31 } },	// 96: 11DP3 / 11DP10 / 11DP17 / 11DP24 / 11DP31
+	{ { 11, TLM_DP, 4 }, { 11, TLM_DP, 11 }, { 11, TLM_DP, 18 }, { 11, TLM_DP, 25 }, { 11, TLM_DP, 32 } },	// 97: 11DP4 / 11DP11 / 11DP18 / 11DP25 / 11DP32
+	{ { 11, TLM_DP, 5 }, { 11, TLM_DP, 12 }, { 11, TLM_DP, 19 }, { 11, TLM_DP, 26 }, { 11, TLM_DP, 33 } },	// 98: 11DP5 / 11DP12 / 11DP19 / 11DP26 / 11DP33
+	{ PCM_WORD_ALL(51, TLM_DP, 2) },	// 99: 51DP2
+	{ PCM_WORD_ALL(22, TLM_A, 1) },	// 100: 22A1 ASTRO 1 EKG AXIS 2 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 2) },	// 101: 22A2 ASTRO 1 EKG AXIS 3 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 3) },	// 102: 22A3 ASTRO 1 EKG AXIS 1 (repeat)
+	{ PCM_WORD_ALL(22, TLM_A, 4) },	// 103: 22A4 PITCH DIFF CLUTCH CURRENT (repeat)
+	{ { 11, TLM_A, 28 }, { 11, TLM_A, 64 }, { 11, TLM_A, 100 }, { 11, TLM_A, 136 }, { 11, TLM_A, 172 } },	// 104: 11A28 / 11A64 / 11A100 / 11A136 / 11A172
+	{ { 11, TLM_A, 29 }, { 11, TLM_A, 65 }, { 11, TLM_A, 101 }, { 11, TLM_A, 137 }, { 11, TLM_A, 173 } },	// 105: 11A29 FC1 N2 PRESS / 11A65 / 11A101 / 11A137 / 11A173
+	{ { 11, TLM_A, 30 }, { 11, TLM_A, 66 }, { 11, TLM_A, 102 }, { 11, TLM_A, 138 }, { 11, TLM_A, 174 } },	// 106: 11A30 FC2 N2 PRESS / 11A66 / 11A102 / 11A138 / 11A174
+	{ { 11, TLM_A, 31 }, { 11, TLM_A, 67 }, { 11, TLM_A, 103 }, { 11, TLM_A, 139 }, { 11, TLM_A, 175 } },	// 107: 11A31 / 11A67 FC1 O2 PRESS / 11A103 / 11A139 / 11A175
+	{ PCM_WORD_ALL(12, TLM_A, 9) },	// 108: 12A9 CM X-AXIS ACCEL (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 10) },	// 109: 12A10 YAW GIMBL POS 1 OR 2 (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 11) },	// 110: 12A11 CM Y-AXIS ACCEL (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 12) },	// 111: 12A12 CM Z-AXIS ACCEL (repeat)
+	{ { 11, TLM_A, 32 }, { 11, TLM_A, 68 }, { 11, TLM_A, 104 }, { 11, TLM_A, 140 }, { 11, TLM_A, 176 } },	// 112: 11A32 / 11A68 FC2 O2 PRESS / 11A104 / 11A140 / 11A176
+	{ PCM_WORD_ALL(22, TLM_DP, 1) },	// 113: 22DP1
+	{ PCM_WORD_ALL(22, TLM_DP, 2) },	// 114: 22DP2
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 2) },	// 115: MAGICAL WORD 3
+	{ PCM_WORD_ALL(12, TLM_A, 13) },	// 116: 12A13 (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 14) },	// 117: 12A14 (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 15) },	// 118: 12A15 (repeat)
+	{ PCM_WORD_ALL(12, TLM_A, 16) },	// 119: 12A16 (repeat)
+	{ { 11, TLM_A, 33 }, { 11, TLM_A, 69 }, { 11, TLM_A, 105 }, { 11, TLM_A, 141 }, { 11, TLM_A, 177 } },	// 120: 11A33 / 11A69 / 11A105 / 11A141 / 11A177
+	{ { 11, TLM_A, 34 }, { 11, TLM_A, 70 }, { 11, TLM_A, 106 }, { 11, TLM_A, 142 }, { 11, TLM_A, 178 } },	// 121: 11A34 / 11A70 / 11A106 / 11A142 / 11A178
+	{ { 11, TLM_A, 35 }, { 11, TLM_A, 71 }, { 11, TLM_A, 107 }, { 11, TLM_A, 143 }, { 11, TLM_A, 179 } },	// 122: 11A35 FC3 N2 PRESS / 11A71 / 11A107 / 11A143 / 11A179
+	{ { 11, TLM_A, 36 }, { 11, TLM_A, 72 }, { 11, TLM_A, 108 }, { 11, TLM_A, 143 }, { 11, TLM_A, 180 } },	// 123: 11A36 / 11A72 / 11A108 / 11A143 / 11A180
+	{ PCM_WORD_ALL(51, TLM_A, 12) },	// 124: 51A12
+	{ PCM_WORD_ALL(51, TLM_A, 13) },	// 125: 51A13
+	{ PCM_WORD_ALL(51, TLM_A, 14) },	// 126: 51A14
+	{ PCM_WORD_ALL(51, TLM_A, 15) },	// 127: 51A15
+};
+
+// HBR analog words commutated over 50 frames, indexed by frame address
+static const PCMWordDef HBRCommutated[CSMHBRFormat::CommutatedWords][CSMHBRFormat::FrameAddrCycle] = {
+	{	// MAGICAL WORD 1: 10A1, 10A4, ... 10A148
+		{ 10, TLM_A, 1 }, { 10, TLM_A, 4 }, { 10, TLM_A, 7 }, { 10, TLM_A, 10 }, { 10, TLM_A, 13 }, { 10, TLM_A, 16 }, { 10, TLM_A, 19 }, { 10, TLM_A, 22 }, { 10, TLM_A, 25 }, { 10, TLM_A, 28 },
+		{ 10, TLM_A, 31 }, { 10, TLM_A, 34 }, { 10, TLM_A, 37 }, { 10, TLM_A, 40 }, { 10, TLM_A, 43 }, { 10, TLM_A, 46 }, { 10, TLM_A, 49 }, { 10, TLM_A, 52 }, { 10, TLM_A, 55 }, { 10, TLM_A, 58 },
+		{ 10, TLM_A, 61 }, { 10, TLM_A, 64 }, { 10, TLM_A, 67 }, { 10, TLM_A, 70 }, { 10, TLM_A, 73 }, { 10, TLM_A, 76 }, { 10, TLM_A, 79 }, { 10, TLM_A, 82 }, { 10, TLM_A, 85 }, { 10, TLM_A, 88 },
+		{ 10, TLM_A, 91 }, { 10, TLM_A, 94 }, { 10, TLM_A, 97 }, { 10, TLM_A, 100 }, { 10, TLM_A, 103 }, { 10, TLM_A, 106 }, { 10, TLM_A, 109 }, { 10, TLM_A, 112 }, { 10, TLM_A, 115 }, { 10, TLM_A, 118 },
+		{ 10, TLM_A, 121 }, { 10, TLM_A, 124 }, { 10, TLM_A, 127 }, { 10, TLM_A, 130 }, { 10, TLM_A, 133 }, { 10, TLM_A, 136 }, { 10, TLM_A, 139 }, { 10, TLM_A, 142 }, { 10, TLM_A, 145 }, { 10, TLM_A, 148 },
+	},
+	{	// MAGICAL WORD 2: 10A2, 10A5, ... 10A149
+		{ 10, TLM_A, 2 }, { 10, TLM_A, 5 }, { 10, TLM_A, 8 }, { 10, TLM_A, 11 }, { 10, TLM_A, 14 }, { 10, TLM_A, 17 }, { 10, TLM_A, 20 }, { 10, TLM_A, 23 }, { 10, TLM_A, 26 }, { 10, TLM_A, 29 },
+		{ 10, TLM_A, 32 }, { 10, TLM_A, 35 }, { 10, TLM_A, 38 }, { 10, TLM_A, 41 }, { 10, TLM_A, 44 }, { 10, TLM_A, 47 }, { 10, TLM_A, 50 }, { 10, TLM_A, 53 }, { 10, TLM_A, 56 }, { 10, TLM_A, 59 },
+		{ 10, TLM_A, 62 }, { 10, TLM_A, 65 }, { 10, TLM_A, 68 }, { 10, TLM_A, 71 }, { 10, TLM_A, 74 }, { 10, TLM_A, 77 }, { 10, TLM_A, 80 }, { 10, TLM_A, 83 }, { 10, TLM_A, 86 }, { 10, TLM_A, 89 },
+		{ 10, TLM_A, 92 }, { 10, TLM_A, 95 }, { 10, TLM_A, 98 }, { 10, TLM_A, 101 }, { 10, TLM_A, 104 }, { 10, TLM_A, 107 }, { 10, TLM_A, 110 }, { 10, TLM_A, 113 }, { 10, TLM_A, 116 }, { 10, TLM_A, 119 },
+		{ 10, TLM_A, 122 }, { 10, TLM_A, 125 }, { 10, TLM_A, 128 }, { 10, TLM_A, 131 }, { 10, TLM_A, 134 }, { 10, TLM_A, 137 }, { 10, TLM_A, 140 }, { 10, TLM_A, 143 }, { 10, TLM_A, 146 }, { 10, TLM_A, 149 },
+	},
+	{	// MAGICAL WORD 3: 10A3, 10A6, ... 10A150
+		{ 10, TLM_A, 3 }, { 10, TLM_A, 6 }, { 10, TLM_A, 9 }, { 10, TLM_A, 12 }, { 10, TLM_A, 15 }, { 10, TLM_A, 18 }, { 10, TLM_A, 21 }, { 10, TLM_A, 24 }, { 10, TLM_A, 27 }, { 10, TLM_A, 30 },
+		{ 10, TLM_A, 33 }, { 10, TLM_A, 36 }, { 10, TLM_A, 39 }, { 10, TLM_A, 42 }, { 10, TLM_A, 45 }, { 10, TLM_A, 48 }, { 10, TLM_A, 51 }, { 10, TLM_A, 54 }, { 10, TLM_A, 57 }, { 10, TLM_A, 60 },
+		{ 10, TLM_A, 63 }, { 10, TLM_A, 66 }, { 10, TLM_A, 69 }, { 10, TLM_A, 72 }, { 10, TLM_A, 75 }, { 10, TLM_A, 78 }, { 10, TLM_A, 81 }, { 10, TLM_A, 84 }, { 10, TLM_A, 87 }, { 10, TLM_A, 90 },
+		{ 10, TLM_A, 93 }, { 10, TLM_A, 96 }, { 10, TLM_A, 99 }, { 10, TLM_A, 102 }, { 10, TLM_A, 105 }, { 10, TLM_A, 108 }, { 10, TLM_A, 111 }, { 10, TLM_A, 114 }, { 10, TLM_A, 117 }, { 10, TLM_A, 120 },
+		{ 10, TLM_A, 123 }, { 10, TLM_A, 126 }, { 10, TLM_A, 129 }, { 10, TLM_A, 132 }, { 10, TLM_A, 135 }, { 10, TLM_A, 138 }, { 10, TLM_A, 141 }, { 10, TLM_A, 144 }, { 10, TLM_A, 147 }, { 10, TLM_A, 150 },
+	},
+};
+
+const PCMWordDef *const CSMLBRFormat::Commutated = NULL;
+const PCMWordDef *const CSMHBRFormat::Commutated = &HBRCommutated[0][0];
+
+//
+// Vessel status structures used by PCM::measure(). While a downlink frame is generated, each
+// one is read from the vessel at most once per frame, however many measurements are taken from
+// it. Other callers of measure(), like the panel meters, always get the current values.
+//
+
+class PCMStatusCache
+{
+public:
+	PCMStatusCache(Saturn *s, const int &serial);
+
+	void GetTankPressures(TankPressures &p);
+	void GetTankQuantities(TankQuantities &q);
+	void GetSPSStatus(SPSStatus &s);
+	void GetFuelCellStatus(int index, FuelCellStatus &fc);
+	void GetPyroStatus(PyroStatus &p);
+	void GetSECSStatus(SECSStatus &s);
+	void GetRCSStatus(int index, RCSStatus &rs);
+
+	// Set by the downlink while it generates words
+	void SetFrameActive(bool a) { frameActive = a; };
+
+protected:
+	template <class T> struct Entry {
+		T value;
+		int frame;
+
+		Entry() { frame = -1; }
+	};
+
+	Saturn *sat;
+	const int &frame_serial;
+	bool frameActive;
+
+	Entry<TankPressures> tankPress;
+	Entry<TankQuantities> tankQuantities;
+	Entry<SPSStatus> spsStatus;
+	Entry<FuelCellStatus> fcStatus[3];
+	Entry<PyroStatus> pyroStatus;
+	Entry<SECSStatus> secsStatus;
+	Entry<RCSStatus> rcsStatus[6];
+};
+
+PCMStatusCache::PCMStatusCache(Saturn *s, const int &serial) : sat(s), frame_serial(serial)
+{
+	frameActive = false;
+}
+
+void PCMStatusCache::GetTankPressures(TankPressures &p)
+{
+	if (!frameActive) {
+		sat->GetTankPressures(p);
+		return;
+	}
+	if (tankPress.frame != frame_serial) {
+		sat->GetTankPressures(tankPress.value);
+		tankPress.frame = frame_serial;
+	}
+	p = tankPress.value;
+}
+
+void PCMStatusCache::GetTankQuantities(TankQuantities &q)
+{
+	if (!frameActive) {
+		sat->GetTankQuantities(q);
+		return;
+	}
+	if (tankQuantities.frame != frame_serial) {
+		sat->GetTankQuantities(tankQuantities.value);
+		tankQuantities.frame = frame_serial;
+	}
+	q = tankQuantities.value;
+}
+
+void PCMStatusCache::GetSPSStatus(SPSStatus &s)
+{
+	if (!frameActive) {
+		sat->GetSPSStatus(s);
+		return;
+	}
+	if (spsStatus.frame != frame_serial) {
+		sat->GetSPSStatus(spsStatus.value);
+		spsStatus.frame = frame_serial;
+	}
+	s = spsStatus.value;
+}
+
+void PCMStatusCache::GetFuelCellStatus(int index, FuelCellStatus &fc)
+{
+	if (!frameActive) {
+		sat->GetFuelCellStatus(index, fc);
+		return;
+	}
+
+	Entry<FuelCellStatus> &e = fcStatus[index - 1];
+
+	if (e.frame != frame_serial) {
+		sat->GetFuelCellStatus(index, e.value);
+		e.frame = frame_serial;
+	}
+	fc = e.value;
+}
+
+void PCMStatusCache::GetPyroStatus(PyroStatus &p)
+{
+	if (!frameActive) {
+		sat->GetPyroStatus(p);
+		return;
+	}
+	if (pyroStatus.frame != frame_serial) {
+		sat->GetPyroStatus(pyroStatus.value);
+		pyroStatus.frame = frame_serial;
+	}
+	p = pyroStatus.value;
+}
+
+void PCMStatusCache::GetSECSStatus(SECSStatus &s)
+{
+	if (!frameActive) {
+		sat->GetSECSStatus(s);
+		return;
+	}
+	if (secsStatus.frame != frame_serial) {
+		sat->GetSECSStatus(secsStatus.value);
+		secsStatus.frame = frame_serial;
+	}
+	s = secsStatus.value;
+}
+
+void PCMStatusCache::GetRCSStatus(int index, RCSStatus &rs)
+{
+	if (!frameActive) {
+		sat->GetRCSStatus(index, rs);
+		return;
+	}
+
+	Entry<RCSStatus> &e = rcsStatus[index];
+
+	if (e.frame != frame_serial) {
+		sat->GetRCSStatus(index, e.value);
+		e.frame = frame_serial;
+	}
+	rs = e.value;
+}
+
 PCM::PCM()
 {
 	sat = NULL;
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0; 
-	mcc_size = 0; mcc_offset = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = 0;
 	frame_addr = 0;
 	frame_count = 0;
+	frame_serial = 0;
+	status = NULL;
 	m_socket = INVALID_SOCKET;
+	socketSink = NULL;
+	fileSink = NULL;
+	decimated = false;
+	frames_skipped = 0;
+	stream_time = 0;
+	word_length = hbr_engine.WordTime();
+	dumpSink = NULL;
 }
 
 PCM::~PCM()
 {
+	if (downlink.GetSent() > 0 || frames_skipped > 0) {
+		char buffer[256];
+		sprintf(buffer, "(PCM) Downlink: %llu words sent, %llu words dropped, %llu frames skipped", downlink.GetSent(), downlink.GetDropped(), frames_skipped);
+		oapiWriteLog(buffer);
+	}
+	if (archive.IsOpen()) {
+		char buffer[256];
+		sprintf(buffer, "(PCM) Archive: %llu frames recorded, %llu rewinds", archive.GetFrames(), archive.GetRewinds());
+		oapiWriteLog(buffer);
+	}
+
+	// The transports delete the sinks
+	if (socketSink) {
+		downlink.RemoveSink(socketSink);
+	}
+	if (fileSink) {
+		downlink.RemoveSink(fileSink);
+	}
+	if (dumpSink) {
+		dump.RemoveSink(dumpSink);
+	}
+
+	delete status;
+
 	if (m_socket != INVALID_SOCKET) {
 		shutdown(m_socket, 2); // Shutdown both streams
 		closesocket(m_socket);
@@ -2051,11 +2441,14 @@ void PCM::Init(Saturn *vessel){
 	sat = vessel;
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
-	mcc_size = 0; mcc_offset = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = MINUS_INFINITY;
 	word_addr = 0;
+
+	delete status;
+	status = new PCMStatusCache(sat, frame_serial);
+
 	int iResult = WSAStartup( MAKEWORD(2,2), &wsaData );
 	if ( iResult != NO_ERROR ){
 		sprintf(wsk_emsg,"TELECOM: Error at WSAStartup()");
@@ -2164,37 +2557,178 @@ void PCM::TimeStep(double simt){
 	*/
 
 	// Generate PCM datastream
-	if(LowBitrateLogic()){
-		tx_size = (int)((simt - last_update) / 0.005);
-		// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
-		if(tx_size > 0){
-			last_update = simt;
-			if(tx_size < 1024){
-				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_lbr();
-					tx_offset++;
-				}
-				perform_io(simt);
-			}
+	bool lbr = LowBitrateLogic();
+	int words_per_frame = lbr ? CSMLBRFormat::Words : CSMHBRFormat::Words;
+	double elapsed = simt - last_update;
+
+	// Don't try to catch up across a time jump
+	if (elapsed > 60.0) {
+		elapsed = 0.0;
+		last_update = simt;
+	}
+
+	word_length = lbr ? lbr_engine.WordTime() : hbr_engine.WordTime();
+	tx_size = (int)(elapsed / word_length);
+	// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
+	if(tx_size > 0){
+		last_update = simt;
+		stream_time = simt - tx_size * word_length;
+
+		//
+		// Every word is generated, unless there are too many to keep up with, or decimation
+		// is enabled and more than a frame is due. Then the current frame is finished, the
+		// frames in between are skipped, and the last frame is generated.
+		//
+
+		int remaining = words_per_frame - word_addr;
+		if ((decimated || tx_size > PCM_MAX_STEP_WORDS) && tx_size > remaining + words_per_frame) {
+			int skip = (tx_size - remaining) / words_per_frame - 1;
+
+			if (!decimated && frames_skipped == 0) {
+				char buffer[256];
+				sprintf(buffer, "(PCM) Downlink can't keep up with time acceleration, %d frames skipped", skip);
+				oapiWriteLog(buffer);
+			}
+
+			generate_words(remaining, lbr);
+			skip_frames(skip, lbr);
+			generate_words(tx_size - remaining - skip * words_per_frame, lbr);
 		}
-		return; // Don't waste time checking for HBR
-	}
-	else{
-		tx_size = (int)((simt - last_update) / 0.00015625);
-		// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
-		if(tx_size > 0){
-			last_update = simt;
-			if(tx_size < 1024){
-				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_hbr();
-					tx_offset++;
-				}			
-				perform_io(simt);
-			}
+		else {
+			generate_words(tx_size, lbr);
+		}
+		perform_io(simt);
+	}
+}
+
+void PCM::generate_words(int count, bool lbr)
+{
+	int words_per_frame = lbr ? CSMLBRFormat::Words : CSMHBRFormat::Words;
+
+	while (count > 0) {
+		int n = (count < 1024) ? count : 1024;
+		int first = word_addr;
+
+		status->SetFrameActive(true);
+		if (lbr) {
+			lbr_engine.Generate(*this, tx_data, n);
+		}
+		else {
+			hbr_engine.Generate(*this, tx_data, n);
+		}
+		status->SetFrameActive(false);
+
+		// The transport thread sends it on
+		downlink.Push(tx_data, n);
+		sat->dataRecorder.RecordWords(tx_data, n, !lbr);
+
+		// Stamp the words with the time they were due, not the end of the timestep
+		if (archive.IsOpen()) {
+			double lag = last_update - stream_time;
+			archive.Write(tx_data, n, first, words_per_frame, word_length, sat->GetMissionTime() - lag, stream_time, oapiGetSimMJD() - lag / 86400.0);
 		}
+		stream_time += n * word_length;
+		count -= n;
+	}
+}
+
+void PCM::skip_frames(int count, bool lbr)
+{
+	int words_per_frame = lbr ? CSMLBRFormat::Words : CSMHBRFormat::Words;
+
+	stream_time += count * words_per_frame * word_length;
+
+	// The tape keeps running, the skipped frames are recorded blank
+	sat->dataRecorder.RecordWords(NULL, count * words_per_frame, !lbr);
+
+	if (lbr) {
+		lbr_engine.SkipFrames(*this, count);
+	}
+	else {
+		hbr_engine.SkipFrames(*this, count);
+	}
+	frames_skipped += count;
+}
+
+bool PCM::OpenDownlinkFile(const char *fname)
+{
+	FILE *f = fopen(fname, "wb");
+	if (!f) {
+		char buffer[512];
+		sprintf(buffer, "(PCM) Can't open downlink file %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	if (fileSink) {
+		downlink.RemoveSink(fileSink);
+	}
+	fileSink = new PCMFileSink(f);
+	downlink.AddSink(fileSink);
+	return true;
+}
+
+bool PCM::OpenDumpFile(const char *fname)
+{
+	FILE *f = fopen(fname, "wb");
+	if (!f) {
+		char buffer[512];
+		sprintf(buffer, "(PCM) Can't open tape recorder dump file %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	if (dumpSink) {
+		dump.RemoveSink(dumpSink);
+	}
+	dumpSink = new PCMFileSink(f);
+	dump.AddSink(dumpSink);
+	return true;
+}
+
+bool PCM::OpenArchive(const char *fname)
+{
+	if (!archive.Open(fname, PCM_ARCHIVE_CSM)) {
+		char buffer[512];
+		sprintf(buffer, "(PCM) Can't open telemetry archive %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+	return true;
+}
+
+// 51DS1A-E COMPUTER DIGITAL DATA (40 BITS)
+
+unsigned char PCM::agc_word(int ccode)
+{
+	unsigned char data;
+
+	switch (ccode) {
+	case 0:
+	{
+		ChannelValue ch13;
+		ch13 = sat->agc.GetOutputChannel(013);
+		data = (sat->agc.GetOutputChannel(034) & 077400) >> 8;
+		if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
+		return data;
+	}
+	case 1:
+		return (sat->agc.GetOutputChannel(034) & 0377);
+	case 2:
+		// PARITY OF CH 34 GOES IN TOP BIT HERE!
+		return (sat->agc.GetOutputChannel(035) & 077400) >> 8;
+	case 3:
+		return (sat->agc.GetOutputChannel(035) & 0377);
+	case 4:
+		// PARITY OF CH 35 GOES IN TOP BIT HERE!
+		return (sat->agc.GetOutputChannel(034) & 077400) >> 8;
 	}
+	return 0;
+}
+
+void PCM::downrupt()
+{
+	sat->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);
 }
 
 // Scale data to 255 steps for transmission in the PCM datastream.
@@ -2258,75 +2792,75 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 13:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 14:		// ENG CHAMBER PRESS
-							sat->GetSPSStatus( spsStatus );
+							status->GetSPSStatus( spsStatus );
 							return(scale_data(spsStatus.chamberPressurePSI, 0, 150));
 						case 15:		// ECS RAD OUT TEMP
 							return(scale_data(sat->ECSRadOutTempSensor.Voltage(), 0.0, 5.0));
 						case 16:		// HE TK TEMP
 							return(scale_data(0,-100,200));
 						case 17:		// SM ENG PKG B TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 18:		// CM HE TK A PRESS
-							sat->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
+							status->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 19:		// SM ENG PKG C TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 20:		// SM ENG PKG D TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 21:		// CM HE TK B PRESS
-							sat->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
+							status->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 22:		// DOCKING PROBE TEMP
 							return(scale_data(0,-100,300));
 						case 23:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 24:		// SM HE TK A PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 25:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 26:		// OX TK 1 QTY -TOTAL AUX
 							return(scale_data(0,0,50));
 						case 27:		// SM HE TK B PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 28:		// OX TK 2 QTY
 							return(scale_data(0,0,60));
 						case 29:		// FU TK 1 QTY -TOTAL AUX
 							return(scale_data(0,0,50));
 						case 30:		// SM HE TK C PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 31:		// FU TK 2 QTY
 							return(scale_data(0,0,60));
 						case 32:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 33:		// SM HE TK D PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.HeliumPressurePSI, 0, 5000));
 						case 34:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 35:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 36:		// H2 TK 1 PRESS
-							sat->GetTankPressures( smTankPress );
+							status->GetTankPressures( smTankPress );
 							return(scale_data(smTankPress.H2Tank1PressurePSI, 0, 350));
 						case 37:		// SPS VLV BODY TEMP
 							return(scale_data(0,0,200));
 						case 38:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 39:		// H2 TK 2 PRESS
-							sat->GetTankPressures( smTankPress );
+							status->GetTankPressures( smTankPress );
 							return(scale_data(smTankPress.H2Tank2PressurePSI, 0, 350));
 						case 40:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 41:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 42:		// O2 TK 2 QTY
-							sat->GetTankQuantities( tankQuantities );
+							status->GetTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.O2Tank2Quantity * 100.0, 0, 100));
 						case 43:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -2375,10 +2909,10 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 65:		// SIDE HS BOND LOC 1 TEMP
 							return(scale_data(0,-260,600));
 						case 66:		// O2 TK 2 PRESS
-							sat->GetTankPressures( smTankPress );
+							status->GetTankPressures( smTankPress );
 							return(scale_data(smTankPress.O2Tank2PressurePSI, 50, 1050));
 						case 67:		// FC 3 RAD IN TEMP
-							sat->GetFuelCellStatus(3, fcStatus);
+							status->GetFuelCellStatus(3, fcStatus);
 							return(scale_data(fcStatus.RadiatorTempInF, -50, 300));
 						case 68:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -2479,14 +3013,14 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 116:		// SCI EXP #11
 							return(scale_data(0,0,100));
 						case 117:		// SPS FU FEED LINE TEMP
-							sat->GetSPSStatus(spsStatus);
+							status->GetSPSStatus(spsStatus);
 							return(scale_data(spsStatus.PropellantLineTempF,0,200));
 						case 118:		// SCI EXP #12
 							return(scale_data(0,0,100));
 						case 119:		// SCI EXP #13
 							return(scale_data(0,0,100));
 						case 120:		// SPS OX FEED LINE TEMP
-							sat->GetSPSStatus(spsStatus);
+							status->GetSPSStatus(spsStatus);
 							return(scale_data(spsStatus.OxidizerLineTempF,0,200));
 						case 121:		// SCI EXP #14
 							return(scale_data(0,0,100));
@@ -2499,23 +3033,23 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 125:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 126:		// FC 1 RAD OUT TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 						case 127:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 128:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 129:		// FC 2 RAD OUT TEMP
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 						case 130:		// FC 1 RAD IN TEMP
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempInF, -50, 300));
 						case 131:		// FC 2 RAD IN TEMP
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempInF, -50, 300));
 						case 132:		// FC 3 RAD OUT TEMP
-							sat->GetFuelCellStatus( 3, fcStatus );
+							status->GetFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.RadiatorTempOutF, -50, 300));
 						case 133:		// GLY EVAP OUT STEAM TEMP
 							return(scale_data(sat->GlyEvapOutSteamTempSensor.Voltage(), 0.0, 5.0));
@@ -2524,7 +3058,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 135:		// URINE DUMP NOZZLE TEMP
 							return(scale_data(0,0,100));
 						case 136:		// SM ENG PKG A TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.PackageTempF, 0, 300));
 						case 137:		// BAY 3 OX TK SURFACE TEMP
 							return(scale_data(0,-100,200));
@@ -2535,28 +3069,28 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 140:		// BAY 6 FU TK SURFACE TEMP
 							return(scale_data(0,-100,200));
 						case 141:		// H2 TK 1 QTY
-							sat->GetTankQuantities(tankQuantities);
+							status->GetTankQuantities(tankQuantities);
 							return(scale_data(tankQuantities.H2Tank1Quantity * 100.0, 0, 100));
 						case 142:		// BAY 2 OX TK SURFACE TEMP
 							return(scale_data(0,-100,200));
 						case 143:		// OX LINE ENTRY SUMP TK TEMP
 							return(scale_data(0,-100,200));
 						case 144:		// H2 TK 2 QTY
-							sat->GetTankQuantities( tankQuantities );
+							status->GetTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.H2Tank2Quantity * 100.0, 0, 100));
 						case 145:		// FU LINE ENTRY SUMP TK TEMP
 							return(scale_data(0,-100,200));
 						case 146:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 147:		// O2 TK 1 QTY
-							sat->GetTankQuantities( tankQuantities );
+							status->GetTankQuantities( tankQuantities );
 							return(scale_data(tankQuantities.O2Tank1Quantity * 100.0, 0, 100));
 						case 148:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 149:		// DOSIMETER RATE
 							return(scale_data(0,0,5));
 						case 150:		// O2 TK 1 PRESS
-							sat->GetTankPressures( smTankPress );
+							status->GetTankPressures( smTankPress );
 							return(scale_data(smTankPress.O2Tank1PressurePSI, 50, 1050));
 						default:
 							sprintf(sat->debugString(),"MEASURE: UNKNOWN 10-A-%d",ccode);
@@ -2574,18 +3108,18 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 4:			// ECS SURGE TANK PRESS
 							return(scale_data(sat->O2SurgeTankPressSensor.Voltage(), 0.0, 5.0));
 						case 5:			// PYRO BUS B VOLTS
-							sat->GetPyroStatus( pyroStatus );
+							status->GetPyroStatus( pyroStatus );
 							return(scale_data(pyroStatus.BusBVoltage, 0, 40 ));
 						case 6:			// LES LOGIC BUS B VOLTS
-							sat->GetSECSStatus( secsStatus );
+							status->GetSECSStatus( secsStatus );
 							return(scale_data( secsStatus.BusBVoltage, 0, 40 ));
 						case 7:			// UNKNOWN - HBR ONLY
 							return(0);
 						case 8:			// LES LOGIC BUS A VOLTS
-							sat->GetSECSStatus( secsStatus );
+							status->GetSECSStatus( secsStatus );
 							return(scale_data( secsStatus.BusBVoltage, 0, 40 ));
 						case 9:			// PYRO BUS A VOLTS
-							sat->GetSECSStatus( secsStatus );
+							status->GetSECSStatus( secsStatus );
 							return(scale_data( secsStatus.BusAVoltage, 0, 40 ));
 						case 10:		// SPS HE TK PRESS
 							return(scale_data(sat->GetSPSPropellant()->GetHeliumPressurePSI(), 0, 5000));
@@ -2614,20 +3148,20 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 22:		// CM HE MANIF 2 PRESS
 							return(scale_data(0,0,400));
 						case 23:		// SM OX MANF A PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 24:		// SM OX MANF B PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 25:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 26:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 27:		// SM OX MANF C PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI,0,300));
 						case 28:		// SM OX MANF D PRESS
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.PropellantPressurePSI, 0, 300));
 						case 29:		// FC 1 N2 PRESS
 							return(scale_data(0,0,75));
@@ -2706,22 +3240,22 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 66:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 67:		// FC 1 O2 PRESS
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 						case 68:		// FC 2 O2 PRESS
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 						case 69:		// FC 3 O2 PRESS
-							sat->GetFuelCellStatus( 3, fcStatus );
+							status->GetFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.O2PressurePSI, 0, 75));
 						case 70:		// FC 1 H2 PRESS
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 71:		// FC 2 H2 PRESS
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 72:		// FC 3 H2 PRESS
-							sat->GetFuelCellStatus( 3, fcStatus );
+							status->GetFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.H2PressurePSI, 0, 75));
 						case 73:		// BAT CHARGER AMPS
 							return scale_data(sat->sce.GetVoltage(1, 0), 0.0, 5.0);
@@ -2732,22 +3266,22 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 76:		// FC 1 CUR
 							return scale_data(sat->sce.GetVoltage(1, 4), 0.0, 5.0);
 						case 77:		// FC 1 H2 FLOW
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 						case 78:		// FC 2 H2 FLOW
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 						case 79:		// FC 3 H2 FLOW
-							sat->GetFuelCellStatus( 3, fcStatus );
+							status->GetFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.H2FlowLBH, 0, 0.2));
 						case 80:		// FC 1 O2 FLOW
-							sat->GetFuelCellStatus( 1, fcStatus );
+							status->GetFuelCellStatus( 1, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 81:		// FC 2 O2 FLOW
-							sat->GetFuelCellStatus( 2, fcStatus );
+							status->GetFuelCellStatus( 2, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 82:		// FC 3 O2 FLOW
-							sat->GetFuelCellStatus( 3, fcStatus );
+							status->GetFuelCellStatus( 3, fcStatus );
 							return(scale_data(fcStatus.O2FlowLBH, 0, 1.6));
 						case 83:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -2894,10 +3428,10 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 154:		// SCE NEG SUPPLY VOLTS
 							return(scale_data(0, -30, 0));
 						case 155:		// CM HE TK A TEMP
-							sat->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
+							status->GetRCSStatus( RCS_CM_RING_1, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 300));
 						case 156:		// CM HE TK B TEMP
-							sat->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
+							status->GetRCSStatus( RCS_CM_RING_2, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 300));
 						case 157:		// SEC GLY PUMP OUT PRESS
 							return(scale_data(sat->SecGlyPumpOutPressSensor.Voltage(), 0.0, 5.0));
@@ -2912,16 +3446,16 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 162:		// UNKNOWN - HBR ONLY
 							return(0);
 						case 163:		// SM HE TK A TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_A, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 164:		// SM HE TK B TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_B, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 165:		// SM HE TK C TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_C, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 166:		// SM HE TK D TEMP
-							sat->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
+							status->GetRCSStatus( RCS_SM_QUAD_D, rcsStatus );
 							return(scale_data(rcsStatus.HeliumTempF, 0, 100));
 						case 167:		// UNKNOWN - HBR ONLY
 							return(0);
@@ -3108,7 +3642,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   6 = CREW ABORT B
 							   7 = EDS ABORT A
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.CrewAbortA << 2);
 							data |= (secsStatus.EDSAbortLogicOutputB << 3);
@@ -3121,7 +3655,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   4 = EDS ABORT VOTE 3
 							   5 = DSE TAPE MOTION
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.EDSAbortLogicInput1 << 0);
 							data |= (secsStatus.EDSAbortLogicInput2 << 1);
@@ -3134,7 +3668,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							    6 = CSM-LM LOCK RING SEP RELAY A
 								7 = CSM-LM LOCK RING SEP RELAY B
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.CSMLEMLockRingSepRelaySignalA << 5);
 							data |= (secsStatus.CSMLEMLockRingSepRelaySignalB << 6);
@@ -3161,7 +3695,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   7 = CM RCS PRESS SIG A
 							   8 = TRANS CTL +Y CMD
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.CMSMSepRelayCloseA << 0);
 							data |= (secsStatus.RCSActivateSignalA << 2);
@@ -3176,7 +3710,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   7 = SLA SEP RELAY B
 							   8 = TRANS CTL +Z CMD
 								*/;
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.CMSMSepRelayCloseB << 0);
 							data |= (secsStatus.RCSActivateSignalB << 2);
@@ -3189,7 +3723,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   3 = DIRECT RCS #1
 							   4 = DIRECT RCS #2
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.FwdHeatshieldJettA << 0);
 							return data;
@@ -3206,7 +3740,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 						case 26:
 							/* 5 = FWD HS JET B
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.FwdHeatshieldJettB << 4);
 							return data;
@@ -3223,7 +3757,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   5 = MAIN CHUTE DISC RELAY A
 							   8 = MAIN DEPLOY RELAY A
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.DrogueSepRelayA << 0);
 							data |= (secsStatus.MainChuteDiscRelayA << 4);
@@ -3234,7 +3768,7 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 							   6 = DROGUE SEP RELAY B
 							   8 = MAIN CHUTE DISC RELAY B
 								*/
-							sat->GetSECSStatus(secsStatus);
+							status->GetSECSStatus(secsStatus);
 
 							data |= (secsStatus.MainDeployRelayB << 2);
 							data |= (secsStatus.DrogueSepRelayB << 5);
@@ -3366,1792 +3900,142 @@ unsigned char PCM::measure(int channel, int type, int ccode){
 	return (0);
 }
 
-void PCM::generate_stream_lbr(){
-	unsigned char data=0;
-	// 40 words per frame, 5 frames, 1 frame per second
-	switch(word_addr){
-		case 0: // SYNC 1
-			// Trigger telemetry END PULSE
-			sat->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);
-			// And continue
-			tx_data[tx_offset] = 05;
-			break;
-		case 1: // SYNC 2
-			tx_data[tx_offset] = 0171;
-			break;
-		case 2: // SYNC 3
-			tx_data[tx_offset] = 0267;
-			break;
-		case 3: // SYNC 4 & FRAME COUNT
-			tx_data[tx_offset] = (0300|frame_count);
+void PCM::perform_io(double simt){
+	// Do TCP IO	
+	switch(conn_state){
+		case 0: // UNINITIALIZED
 			break;
-		case 4: 
-			switch(frame_count){
-				case 0: // 11A1 ECS: SUIT MANF ABS PRESS					
-					tx_data[tx_offset] = measure(11,TLM_A,1);
-					break;
-				case 1: // 11A109 EPS: BAT B CURR
-					tx_data[tx_offset] = measure(11,TLM_A,109);
-					break;
-				case 2: // 11A46 RCS: SM HE MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,46);
-					break;
-				case 3: // 11A154 CMI: SCE NEG SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,154);
-					break;
-				case 4: // 11A91 EPS: BAT BUS A VOLTS					
-					tx_data[tx_offset] = measure(11,TLM_A,91);
-					break;
+		case 1: // INITALIZED, LISTENING
+			// Do we have queued uplink data?
+			if (!uplink.Empty()) {
+				// sprintf(oapiDebugString(), "UPLINK %d LRX %f LRXINT %f", uplink.Size(), last_rx, ((simt - last_rx) / 0.005));
+				// Should we recieve?
+				if ((fabs(simt - last_rx) / 0.1) < 1 || sat->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
+					return; // No
+				}
+				last_rx = simt;
+				// Yes. Take a byte
+				uplink.Pop(rx_data[rx_offset]);
+				// If uplink isn't blocked
+				if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
+					// Handle it
+					handle_uplink();
+				}
+			}else{
+				// Try to accept
+				AcceptSocket = accept( m_socket, NULL, NULL );
+				if(AcceptSocket != INVALID_SOCKET){
+					conn_state = 2; // Accept this!
+					wsk_error = 0; // For now
+					socketSink = new PCMSocketSink(AcceptSocket);
+					downlink.AddSink(socketSink);
+				}
 			}
+			// Otherwise loop and try again.
 			break;
-		case 5:
-			switch(frame_count){
-				case 0: // 11A2 ECS: SUIT COMP DELTA P
-					tx_data[tx_offset] = measure(11,TLM_A,2);
-					break;
-				case 1: // 11A110 EPS: BAT C CURR
-					tx_data[tx_offset] = measure(11,TLM_A,110);
-					break;
-				case 2: // 11A47 EPS: LM HEATER CURRENT
-					tx_data[tx_offset] = measure(11,TLM_A,47);
-					break;
-				case 3: // 11A155 RCS: CM HE TK A TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,155);
-					break;
-				case 4: // 11A92 RCS: SM FU MANF A PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,92);
-					break;
+		case 2: // CONNECTED			
+			int bytesRecv;
+
+			// The downlink is sent by the transport thread, check how that went
+			if(socketSink->Failed()){
+				long errnumber = socketSink->GetError();
+				switch(errnumber){
+					case 10038: // Socket isn't a socket
+					case 10053: // Software caused connection abort
+					case 10054: // Connection reset by peer
+						break;
+
+					default:           // If unknown
+						wsk_error = 1; // do this
+						sprintf(wsk_emsg,"TELECOM: send() failed: %ld",errnumber);
+						break;
+				}
+				close_connection(); // Accept another
+				return;
 			}
-			break;
-		case 6:
-			switch(frame_count){
-				case 0: // 11A3 ECS: GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,3);
-					break;
-				case 1: // 11A111 ECS: SM FU MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,111);
-					break;
-				case 2: // 11A48 PCM HI LEVEL 85 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,48);
-					break;
-				case 3: // 11A156 CM HE TK B TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,156);
-					break;
-				case 4: // 11A93 BAT BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,93);
-					break;
+			// Should we recieve?
+			if ((fabs(simt - last_rx) / 0.005) < 1 || sat->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
+				return; // No
 			}
-			break;
-		case 7:
-			switch(frame_count){
-				case 0: // 11A4 ECS SURGE TANK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,4);
-					break;
-				case 1: // 11A112 SM FU MANF D PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,112);
-					break;
-				case 2: // 11A49 PC HI LEVEL 15 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,49);
-					break;
-				case 3: // 11A157 SEC GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,157);
-					break;
-				case 4: // 11A94 SM FU MANF B PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,94);
-					break;
+			last_rx = simt;
+			bytesRecv = recv( AcceptSocket, (char *)(rx_data+rx_offset), 1, 0 );
+			if(bytesRecv == SOCKET_ERROR){
+				long errnumber = WSAGetLastError();
+				switch(errnumber){
+					// KNOWN CODES that we can ignore
+					case 10035: // Operation Would Block
+						// We can ignore this entirely. It's not an error.
+						break;
+
+					case 10053: // Software caused connection abort
+					case 10038: // Socket isn't a socket
+					case 10054: // Connection reset by peer
+						close_connection(); // Accept another
+						break;
+
+					default:           // If unknown
+						wsk_error = 1; // do this
+						sprintf(wsk_emsg,"TELECOM: recv() failed: %ld",errnumber);
+						close_connection(); // Accept another
+						break;					
+				}
+				// Do we have queued uplink data instead?
+				if (!uplink.Empty()) {
+					// Yes. Take a byte
+					uplink.Pop(rx_data[rx_offset]);
+					// If the telemetry data-path is disconnected, discard the data
+					if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
+						// otherwise handle it
+						handle_uplink();
+					}
+				}
+			}else{
+				// If the telemetry data-path is disconnected
+				if(sat->UPTLMSwitch1.GetState() == TOGGLESWITCH_DOWN){
+					return; // Discard the data
+				}
+				if(bytesRecv > 0){
+					handle_uplink();
+				} else {
+					// Do we have queued uplink data instead?
+					if (!uplink.Empty()) {
+						// Yes. Take a byte
+						uplink.Pop(rx_data[rx_offset]);
+						// Handle it
+						handle_uplink();
+					}
+				}
 			}
+			break;			
+	}
+}
+
+// Stop sending to the telemetry client and wait for another one. The sink closes the socket.
+void PCM::close_connection() {
+	downlink.RemoveSink(socketSink);
+	socketSink = NULL;
+	conn_state = 1;
+	uplink_state = 0; rx_offset = 0;
+}
+
+// Handle data moved to buffer from either the socket or mcc buffer
+void PCM::handle_uplink() {
+	switch (uplink_state) {
+	case 0: // NEW COMMAND START
+		int va, sa;
+		va = ((rx_data[rx_offset] & 070) >> 3);
+		sa = rx_data[rx_offset] & 07;
+		// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
+		if (va != 04) { break; }
+		switch (sa) {
+		case 0: // TEST
+			rx_offset++; uplink_state = 10;
 			break;
-		case 8: // 51DS1A COMPUTER DIGITAL DATA (40 BITS) 
-		case 28:
-		{
-			unsigned char data;
-			ChannelValue ch13;
-			ch13 = sat->agc.GetOutputChannel(013);
-			data = (sat->agc.GetOutputChannel(034) & 077400) >> 8;
-			if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
-			/*
-			sprintf(oapiDebugString(),"CMC DATA: %o (%lo %lo)",data,sat->agc.GetOutputChannel(034),
-				sat->agc.GetOutputChannel(035));
-				*/
-			tx_data[tx_offset] = data;
-			break;
-		}
-		case 9: // 51DS1B COMPUTER DIGITAL DATA (40 BITS)
-		case 29:
-			data = (sat->agc.GetOutputChannel(034)&0377);
-			tx_data[tx_offset] = data; 
+		case 3: // CMC-UPDATA
+			rx_offset++; uplink_state = 20;
 			break;
-		case 10: // 51DS1C COMPUTER DIGITAL DATA (40 BITS) 
-		case 30:
-			// PARITY OF CH 34 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(035)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-		case 11: // 51DS1D COMPUTER DIGITAL DATA (40 BITS) 
-		case 31:
-			data = (sat->agc.GetOutputChannel(035)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 12: // 51DS1E COMPUTER DIGITAL DATA (40 BITS) 
-		case 32:
-			// PARITY OF CH 35 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(034)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-		case 13: // 51DP2 UP-DATA-LINK VALIDITY BITS (4 BITS)
-		case 33:
-			tx_data[tx_offset] = 0; 
-			break;
-		case 14:
-			switch(frame_count){
-				case 0: // 10A123 FC 2 COND EXH TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,123);
-					break;
-				case 1: // 10A126 FC 1 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,126);
-					break;
-				case 2: // 10A129 FC 2 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,129);
-					break;
-				case 3: // 10A132 FC 3 RAD OUT TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,132);
-					break;
-				case 4: // 10A135 URINE DUMP NOZZLE TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,135);
-					break;
-			}
-			break;
-		case 15:
-			switch(frame_count){
-				case 0: // 10A138 TM BIAS 2.5 VDC
-					tx_data[tx_offset] = measure(10,TLM_A,138);
-					break;
-				case 1: // 10A141 EPS: H2 TK 1 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,141);
-					break;
-				case 2: // 10A144 H2 TK 2 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,144);
-					break;
-				case 3: // 10A147 O2 TK 1 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,147);
-					break;
-				case 4: // 10A150 O2 TK 1 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,150);
-					break;
-			}
-			break;
-		case 16:
-			switch(frame_count){
-				case 0: // 10A3
-					tx_data[tx_offset] = measure(10,TLM_A,3);
-					break;
-				case 1: // 10A6
-					tx_data[tx_offset] = measure(10,TLM_A,6);
-					break;
-				case 2: // 10A9
-					tx_data[tx_offset] = measure(10,TLM_A,9);
-					break;
-				case 3: // 10A12
-					tx_data[tx_offset] = measure(10,TLM_A,12);
-					break;
-				case 4: // 10A15
-					tx_data[tx_offset] = measure(10,TLM_A,15);
-					break;
-			}
-			break;
-		case 17:
-			switch(frame_count){
-				case 0: // 10A18
-					tx_data[tx_offset] = measure(10,TLM_A,18);
-					break;
-				case 1: // 10A21
-					tx_data[tx_offset] = measure(10,TLM_A,21);
-					break;
-				case 2: // 10A24
-					tx_data[tx_offset] = measure(10,TLM_A,24);
-					break;
-				case 3: // 10A27
-					tx_data[tx_offset] = measure(10,TLM_A,27);
-					break;
-				case 4: // 10A30
-					tx_data[tx_offset] = measure(10,TLM_A,30);
-					break;
-			}
-			break;
-		case 18:
-			switch(frame_count){
-				case 0: // 10A33 
-					tx_data[tx_offset] = measure(10,TLM_A,33);
-					break;
-				case 1: // 10A36 H2 TK 1 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,36);
-					break;
-				case 2: // 10A39 H2 TK 2 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,39);
-					break;
-				case 3: // 10A42 O2 TK 2 QTY
-					tx_data[tx_offset] = measure(10,TLM_A,42);
-					break;
-				case 4: // 10A45
-					tx_data[tx_offset] = measure(10,TLM_A,45);
-					break;
-			}
-			break;
-		case 19:
-			switch(frame_count){
-				case 0: // 10A48 
-					tx_data[tx_offset] = measure(10,TLM_A,48);
-					break;
-				case 1: // 10A51
-					tx_data[tx_offset] = measure(10,TLM_A,51);
-					break;
-				case 2: // 10A54 O2 TK 1 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,54);
-					break;
-				case 3: // 10A57 O2 TK 2 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,57);
-					break;
-				case 4: // 10A60 H2 TK 1 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,60);
-					break;
-			}
-			break;
-		case 20:
-			// Trigger telemetry END PULSE
-			sat->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);
-			// and continue
-			switch(frame_count){
-				case 0: // 10DP1 
-					tx_data[tx_offset] = measure(10,TLM_DP,1);
-					break;
-				case 1: // 11DP6
-					tx_data[tx_offset] = measure(11,TLM_DP,6); 
-					break;
-				case 2: // 11DP27
-					tx_data[tx_offset] = measure(11,TLM_DP,27); 
-					break;
-				case 3: // 11DP15
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 4: // 11DP20
-					tx_data[tx_offset] = measure(11,TLM_DP,20); 
-					break;
-			}
-			break;
-		case 21:
-			switch(frame_count){
-				case 0: // SRC 0
-					tx_data[tx_offset] = measure(0,TLM_SRC,0); 
-					break;
-				case 1: // 11DP7
-					tx_data[tx_offset] = measure(11,TLM_DP,7); 
-					break;
-				case 2: // 11DP28
-					tx_data[tx_offset] = measure(11,TLM_DP,28); 
-					break;
-				case 3: // 11DP16
-					tx_data[tx_offset] = measure(11,TLM_DP,16); 
-					break;
-				case 4: // 11DP21
-					tx_data[tx_offset] = measure(11,TLM_DP,21); 
-					break;
-			}
-			break;
-		case 22:
-			switch(frame_count){
-				case 0: // 11A39
-					tx_data[tx_offset] = measure(11,TLM_A,39); 
-					break;
-				case 1: // 11A147 AC BUS 1 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,147); 
-					break;
-				case 2: // 11A84
-					tx_data[tx_offset] = measure(11,TLM_A,84); 
-					break;
-				case 3: // 11A21
-					tx_data[tx_offset] = measure(11,TLM_A,21); 
-					break;
-				case 4: // 11A129
-					tx_data[tx_offset] = measure(11,TLM_A,129); 
-					break;
-			}
-			break;
-		case 23:
-			switch(frame_count){
-				case 0: // 11A40
-					tx_data[tx_offset] = measure(11,TLM_A,40); 
-					break;
-				case 1: // 11A48
-					tx_data[tx_offset] = measure(11,TLM_A,48); 
-					break;
-				case 2: // 11A85
-					tx_data[tx_offset] = measure(11,TLM_A,85); 
-					break;
-				case 3: // 11A22
-					tx_data[tx_offset] = measure(11,TLM_A,22); 
-					break;
-				case 4: // 11A130
-					tx_data[tx_offset] = measure(11,TLM_A,130); 
-					break;
-			}
-			break;
-		case 24:
-			switch(frame_count){
-				case 0: // 11A73 BAT CHRGR AMPS
-					tx_data[tx_offset] = measure(11,TLM_A,73); 
-					break;
-				case 1: // 11A10
-					tx_data[tx_offset] = measure(11,TLM_A,10); 
-					break;
-				case 2: // 11A118
-					tx_data[tx_offset] = measure(11,TLM_A,118); 
-					break;
-				case 3: // 11A55
-					tx_data[tx_offset] = measure(11,TLM_A,55); 
-					break;
-				case 4: // 11A163
-					tx_data[tx_offset] = measure(11,TLM_A,163); 
-					break;
-			}
-			break;
-		case 25:
-			switch(frame_count){
-				case 0: // 11A74 BAT A CUR
-					tx_data[tx_offset] = measure(11,TLM_A,74); 
-					break;
-				case 1: // 11A11
-					tx_data[tx_offset] = measure(11,TLM_A,11); 
-					break;
-				case 2: // 11A119
-					tx_data[tx_offset] = measure(11,TLM_A,119); 
-					break;
-				case 3: // 11A56 AC BUS 2 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,56); 
-					break;
-				case 4: // 11A164
-					tx_data[tx_offset] = measure(11,TLM_A,164); 
-					break;
-			}
-			break;
-		case 26:
-			switch(frame_count){
-				case 0: // 11A75
-					tx_data[tx_offset] = measure(11,TLM_A,75); 
-					break;
-				case 1: // 11A12
-					tx_data[tx_offset] = measure(11,TLM_A,12); 
-					break;
-				case 2: // 11A120
-					tx_data[tx_offset] = measure(11,TLM_A,120); 
-					break;
-				case 3: // 11A57
-					tx_data[tx_offset] = measure(11,TLM_A,57); 
-					break;
-				case 4: // 11A165
-					tx_data[tx_offset] = measure(11,TLM_A,165); 
-					break;
-			}
-			break;
-		case 27:
-			switch(frame_count){
-				case 0: // 11A76
-					tx_data[tx_offset] = measure(11,TLM_A,76); 
-					break;
-				case 1: // 11A13
-					tx_data[tx_offset] = measure(11,TLM_A,13); 
-					break;
-				case 2: // 11A121
-					tx_data[tx_offset] = measure(11,TLM_A,121); 
-					break;
-				case 3: // 11A58
-					tx_data[tx_offset] = measure(11,TLM_A,58); 
-					break;
-				case 4: // 11A166
-					tx_data[tx_offset] = measure(11,TLM_A,166); 
-					break;
-			}
-			break;
-		case 34:
-			switch(frame_count){
-				case 0: // 11DP3
-					tx_data[tx_offset] = measure(11,TLM_DP,3); 
-					break;
-				case 1: // 11DP8
-					tx_data[tx_offset] = measure(11,TLM_DP,8); 
-					break;
-				case 2: // 11DP13
-					tx_data[tx_offset] = measure(11,TLM_DP,13); 
-					break;
-				case 3: // 11DP29
-					tx_data[tx_offset] = measure(11,TLM_DP,29); 
-					break;
-				case 4: // 11DP22
-					tx_data[tx_offset] = measure(11,TLM_DP,22); 
-					break;
-			}
-			break;
-		case 35:
-			switch(frame_count){
-				case 0: // SRC 1
-					tx_data[tx_offset] = measure(0,TLM_SRC,1); 
-					break;
-				case 1: // 11DP9
-					tx_data[tx_offset] = measure(11,TLM_DP,9); 
-					break;
-				case 2: // 11DP14
-					tx_data[tx_offset] = measure(11,TLM_DP,14); 
-					break;
-				case 3: // 11DP17
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 4: // 11DP23
-					tx_data[tx_offset] = measure(11,TLM_DP,23); 
-					break;
-			}
-			break;
-		case 36:
-			switch(frame_count){
-				case 0: // 10A63 H2 TK 2 TEMP
-					tx_data[tx_offset] = measure(10,TLM_A,63); 
-					break;
-				case 1: // 10A66 O2 TK 2 PRESS
-					tx_data[tx_offset] = measure(10,TLM_A,66); 
-					break;
-				case 2: // 10A69
-					tx_data[tx_offset] = measure(10,TLM_A,69); 
-					break;
-				case 3: // 10A72
-					tx_data[tx_offset] = measure(10,TLM_A,72); 
-					break;
-				case 4: // 10A75
-					tx_data[tx_offset] = measure(10,TLM_A,75); 
-					break;
-			}
-			break;
-		case 37:
-			switch(frame_count){
-				case 0: // 10A78
-					tx_data[tx_offset] = measure(10,TLM_A,78); 
-					break;
-				case 1: // 10A81
-					tx_data[tx_offset] = measure(10,TLM_A,81); 
-					break;
-				case 2: // 10A84
-					tx_data[tx_offset] = measure(10,TLM_A,84); 
-					break;
-				case 3: // 10A87
-					tx_data[tx_offset] = measure(10,TLM_A,87); 
-					break;
-				case 4: // 10A90
-					tx_data[tx_offset] = measure(10,TLM_A,90); 
-					break;
-			}
-			break;
-		case 38:
-			switch(frame_count){
-				case 0: // 10A93
-					tx_data[tx_offset] = measure(10,TLM_A,93); 
-					break;
-				case 1: // 10A96
-					tx_data[tx_offset] = measure(10,TLM_A,96); 
-					break;
-				case 2: // 10A99
-					tx_data[tx_offset] = measure(10,TLM_A,99); 
-					break;
-				case 3: // 10A102
-					tx_data[tx_offset] = measure(10,TLM_A,102); 
-					break;
-				case 4: // 10A105
-					tx_data[tx_offset] = measure(10,TLM_A,105); 
-					break;
-			}
-			break;
-		case 39:
-			switch(frame_count){
-				case 0: // 10A108
-					tx_data[tx_offset] = measure(10,TLM_A,108); 
-					break;
-				case 1: // 10A111
-					tx_data[tx_offset] = measure(10,TLM_A,11);  
-					break;
-				case 2: // 10A114
-					tx_data[tx_offset] = measure(10,TLM_A,114); 
-					break;
-				case 3: // 10A117
-					tx_data[tx_offset] = measure(10,TLM_A,117); 
-					break;
-				case 4: // 10A120
-					tx_data[tx_offset] = measure(10,TLM_A,120); 
-					break;
-			}
-			break;
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
-			break;
-	}
-	word_addr++;
-	if(word_addr > 39){
-		word_addr = 0;
-		frame_addr++;
-		if(frame_addr > 49){
-			frame_addr = 0;
-		}
-		frame_count++;
-		if(frame_count > 4){
-			frame_count = 0;
-		}
-	}
-}
-
-void PCM::generate_stream_hbr(){
-	unsigned char data=0;
-	// 128 words per frame, 50 frames pre second
-	switch(word_addr){
-		case 0: // SYNC 1
-			tx_data[tx_offset] = 05;
-			break;
-		case 1: // SYNC 2
-			tx_data[tx_offset] = 0171;
-			break;
-		case 2: // SYNC 3
-			tx_data[tx_offset] = 0267;
-			break;
-		case 3: // SYNC 4 & FRAME COUNT
-			tx_data[tx_offset] = (0300|frame_addr);
-			break;
-		case 4: // 22A1 ASTRO 1 EKG AXIS 2
-		case 36:
-		case 68:
-		case 100:
-			tx_data[tx_offset] = measure(22,TLM_A,1);
-			break;
-		case 5: // 22A2 ASTRO 1 EKG AXIS 3
-		case 37:
-		case 69:
-		case 101:
-			tx_data[tx_offset] = measure(22,TLM_A,2);
-			break;
-		case 6: // 22A3 ASTRO 1 EKG AXIS 1
-		case 38:
-		case 70:
-		case 102:
-			tx_data[tx_offset] = measure(22,TLM_A,3);
-			break;
-		case 7: // 22A4 PITCH DIFF CLUTCH CURRENT
-		case 39:
-		case 71:
-		case 103:
-			tx_data[tx_offset] = measure(22,TLM_A,4);
-			break;
-		case 8:
-			switch(frame_count){
-				case 0: // 11A1 SUIT MANF ABS PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,1); 
-					break;
-				case 1: // 11A37 SUIT-CABIN DELTA PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,37); 
-					break;
-				case 2: // 11A73 BAT CHARGER AMPS
-					tx_data[tx_offset] = measure(11,TLM_A,73); 
-					break;
-				case 3: // 11A109 BAT B CUR
-					tx_data[tx_offset] = measure(11,TLM_A,109); 
-					break;
-				case 4: // 11A145
-					tx_data[tx_offset] = measure(11,TLM_A,145); 
-					break;
-			}
-			break;
-		case 9: 
-			switch(frame_count){
-				case 0: // 11A2 SUIT COMP DELTA P
-					tx_data[tx_offset] = measure(11,TLM_A,2); 
-					break;
-				case 1: // 11A38 ALPHA CT RATE CHAN 1
-					tx_data[tx_offset] = measure(11,TLM_A,38); 
-					break;
-				case 2: // 11A74 BAT A CUR
-					tx_data[tx_offset] = measure(11,TLM_A,74); 
-					break;
-				case 3: // 11A110 BAT C CUR
-					tx_data[tx_offset] = measure(11,TLM_A,110); 
-					break;
-				case 4: // 11A146
-					tx_data[tx_offset] = measure(11,TLM_A,146); 
-					break;
-			}
-			break;
-		case 10:
-			switch(frame_count){
-				case 0: // 11A3 GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,3); 
-					break;
-				case 1: // 11A39 SM HE MANF A PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,39); 
-					break;
-				case 2: // 11A75 BAT RELAY BUS VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,75); 
-					break;
-				case 3: // 11A111 SM FU MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,111); 
-					break;
-				case 4: // 11A147 AC BUS 1 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,147); 
-					break;
-			}
-			break;
-		case 11:
-			switch(frame_count){
-				case 0: // 11A4 ECS SURGE TANK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,4); 
-					break;
-				case 1: // 11A40 SM HE MANF B PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,40); 
-					break;
-				case 2: // 11A76 FC 1 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,76); 
-					break;
-				case 3: // 11A112 SM FU MANF D PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,112); 
-					break;
-				case 4: // 11A148 SCE POS SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,148); 
-					break;
-			}
-			break;
-		case 12: // 12A1 MGA SERVO ERR IN PHASE
-		case 76:
-			tx_data[tx_offset] = measure(12,TLM_A,1); 
-			break;
-		case 13: // 12A2 IGA SERVO ERR IN PHASE
-		case 77:
-			tx_data[tx_offset] = measure(12,TLM_A,2); 
-			break;
-		case 14: // 12A3 OGA SERVO ERR IN PHASE
-		case 78:
-			tx_data[tx_offset] = measure(12,TLM_A,3); 
-			break;
-		case 15: // 12A4 ROLL ATT ERR
-		case 79:
-			tx_data[tx_offset] = measure(12,TLM_A,4); 
-			break;
-		case 16:
-			switch(frame_count){
-				case 0: // 11A5 PYRO BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,5); 
-					break;
-				case 1: // 11A41 ALPHA CT RATE CHAN 2
-					tx_data[tx_offset] = measure(11,TLM_A,41); 
-					break;
-				case 2: // 11A77 FC 1 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,77); 
-					break;
-				case 3: // 11A113
-					tx_data[tx_offset] = measure(11,TLM_A,113); 
-					break;
-				case 4: // 11A149
-					tx_data[tx_offset] = measure(11,TLM_A,149); 
-					break;
-			}
-			break;
-		case 17: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 18: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 19: 
-			switch(frame_count){
-				case 0: // 10DP1
-					tx_data[tx_offset] = measure(10,TLM_DP,1); 
-					break;
-				case 1: // SRC-0
-					tx_data[tx_offset] = measure(0,TLM_SRC,0); 
-					break;
-				case 2: // SRC-1
-					tx_data[tx_offset] = measure(0,TLM_SRC,1); 
-					break;
-				case 3: // (Zeroes?)
-					tx_data[tx_offset] = 0;
-					break;
-				case 4: // (Zeroes?)
-					tx_data[tx_offset] = 0;
-					break;
-			}
-			break;
-		case 20: // 12A5 SCS PITCH BODY RATE
-		case 84:
-			tx_data[tx_offset] = measure(12,TLM_A,5); 
-			break;
-		case 21: // 12A6 SCS YAW BODY RATE
-		case 85:
-			tx_data[tx_offset] = measure(12,TLM_A,6); 
-			break;
-		case 22: // 12A7 SCS ROLL BODY RATE
-		case 86:
-			tx_data[tx_offset] = measure(12,TLM_A,7); 
-			break;
-		case 23: // 12A8 PITCH GIMBL POS 1 OR 2
-		case 87:
-			tx_data[tx_offset] = measure(12,TLM_A,8); 
-			break;
-		case 24:
-			switch(frame_count){
-				case 0: // 11A6 LES LOGIC BUS B VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,6); 
-					break;
-				case 1: // 11A42 ALPHA CT RATE CHAN 3
-					tx_data[tx_offset] = measure(11,TLM_A,42); 
-					break;
-				case 2: // 11A78 FC 2 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,78); 
-					break;
-				case 3: // 11A114
-					tx_data[tx_offset] = measure(11,TLM_A,114); 
-					break;
-				case 4: // 11A150
-					tx_data[tx_offset] = measure(11,TLM_A,150); 
-					break;
-			}
-			break;
-		case 25:
-			switch(frame_count){
-				case 0: // 11A7
-					tx_data[tx_offset] = measure(11,TLM_A,7); 
-					break;
-				case 1: // 11A43 PROTON INTEG CT RATE
-					tx_data[tx_offset] = measure(11,TLM_A,43); 
-					break;
-				case 2: // 11A79 FC 3 H2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,79); 
-					break;
-				case 3: // 11A115
-					tx_data[tx_offset] = measure(11,TLM_A,115); 
-					break;
-				case 4: // 11A151
-					tx_data[tx_offset] = measure(11,TLM_A,151); 
-					break;
-			}
-			break;
-		case 26:
-			switch(frame_count){
-				case 0: // 11A8 LES LOGIC BUS A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,8); 
-					break;
-				case 1: // 11A44
-					tx_data[tx_offset] = measure(11,TLM_A,44);  
-					break;
-				case 2: // 11A80 FC 1 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,80); 
-					break;
-				case 3: // 11A116
-					tx_data[tx_offset] = measure(11,TLM_A,116); 
-					break;
-				case 4: // 11A152 FUEL SM/ENG INTERFACE P
-					tx_data[tx_offset] = measure(11,TLM_A,152); 
-					break;
-			}
-			break;
-		case 27:
-			switch(frame_count){
-				case 0: // 11A9 PYRO BUS A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,9); 
-					break;
-				case 1: // 11A45
-					tx_data[tx_offset] = measure(11,TLM_A,45); 
-					break;
-				case 2: // 11A81 FC 2 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,81); 
-					break;
-				case 3: // 11A117
-					tx_data[tx_offset] = measure(11,TLM_A,117); 
-					break;
-				case 4: // 11A153
-					tx_data[tx_offset] = measure(11,TLM_A,153); 
-					break;
-			}
-			break;
-		case 28: // 51A1
-			tx_data[tx_offset] = measure(51,TLM_A,1); 
-			break;
-		case 29: // 51A2
-			tx_data[tx_offset] = measure(51,TLM_A,2); 
-			break;
-		case 30: // 51A3
-			tx_data[tx_offset] = measure(51,TLM_A,3); 
-			break;
-		case 31: // 51DS1A COMPUTER DIGITAL DATA (40 BITS)
-			// The very first pass through this loop will get garbage data because there was no downrupt.
-			// Generating a downrupt at 0 doesn't give the CMC enough time to get data on the busses.
-		{
-			ChannelValue ch13;
-			ch13 = sat->agc.GetOutputChannel(013);
-			data = (sat->agc.GetOutputChannel(034) & 077400) >> 8;
-			if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
-			/*
-			sprintf(oapiDebugString(),"CMC DATA: %o (%lo %lo)",data,sat->agc.GetOutputChannel(034),
-				sat->agc.GetOutputChannel(035));
-			*/
-			tx_data[tx_offset] = data;
-			break;
-		}
-		case 32: // 51DS1B COMPUTER DIGITAL DATA (40 BITS)
-			data = (sat->agc.GetOutputChannel(034)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 33: // 51DS1C COMPUTER DIGITAL DATA (40 BITS)
-			// PARITY OF CH 34 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(035)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-		case 34: // 51DS1C COMPUTER DIGITAL DATA (40 BITS)
-			data = (sat->agc.GetOutputChannel(035)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 35: // 51DS1E COMPUTER DIGITAL DATA (40 BITS)
-			// PARITY OF CH 35 GOES IN TOP BIT HERE!
-			data = (sat->agc.GetOutputChannel(034)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			// Trigger telemetry END PULSE
-			sat->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);
-			break;
-		case 40:
-			switch(frame_count){
-				case 0: // 11A10 HE TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,10); 
-					break;
-				case 1: // 11A46 SM HE MANF C PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,46); 
-					break;
-				case 2: // 11A82 FC 3 O2 FLOW
-					tx_data[tx_offset] = measure(11,TLM_A,82); 
-					break;
-				case 3: // 11A118 SEC EVAP OUT LIQ TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,118); 
-					break;
-				case 4: // 11A154 SCE NEG SUPPLY VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,154); 
-					break;
-			}
-			break;
-		case 41:
-			switch(frame_count){
-				case 0: // 11A11 OX TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,11); 
-					break;
-				case 1: // 11A47 LM HEATER CURRENT
-					tx_data[tx_offset] = measure(11,TLM_A,47); 
-					break;
-				case 2: // 11A83
-					tx_data[tx_offset] = measure(11,TLM_A,83); 
-					break;
-				case 3: // 11A119 SENSOR EXCITATION 5V
-					tx_data[tx_offset] = measure(11,TLM_A,119); 
-					break;
-				case 4: // 11A155 CM HE TK A TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,155); 
-					break;
-			}
-			break;
-		case 42:
-			switch(frame_count){
-				case 0: // 11A12 SPS FU TK PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,12); 
-					break;
-				case 1: // 11A48 PCM HI LEVEL 85 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,48); 
-					break;
-				case 2: // 11A84 FC 2 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,84); 
-					break;
-				case 3: // 11A120 SENSOR EXCITATION 10V
-					tx_data[tx_offset] = measure(11,TLM_A,120); 
-					break;
-				case 4: // 11A156 CM HE TK B TEMP
-					tx_data[tx_offset] = measure(11,TLM_A,156); 
-					break;
-			}
-			break;
-		case 43:
-			switch(frame_count){
-				case 0: // 11A13 GLY ACCUM QTY
-					tx_data[tx_offset] = measure(11,TLM_A,13); 
-					break;
-				case 1: // 11A49 PCM LO LEVEL 15 PCT REF
-					tx_data[tx_offset] = measure(11,TLM_A,49); 
-					break;
-				case 2: // 11A85 FC 3 CUR
-					tx_data[tx_offset] = measure(11,TLM_A,85); 
-					break;
-				case 3: // 11A121 USB RCVR AGC VOLTAGE
-					tx_data[tx_offset] = measure(11,TLM_A,121); 
-					break;
-				case 4: // 11A157 SEC GLY PUMP OUT PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,157); 
-					break;
-			}
-			break;
-		case 44: // 12A9 CM X-AXIS ACCEL
-		case 108:
-			tx_data[tx_offset] = measure(12,TLM_A,9); 
-			break;
-		case 45: // 12A10 YAW GIMBL POS 1 OR 2
-		case 109:
-			tx_data[tx_offset] = measure(12,TLM_A,10); 
-			break;
-		case 46: // 12A11 CM Y-AXIS ACCEL
-		case 110:
-			tx_data[tx_offset] = measure(12,TLM_A,11); 
-			break;
-		case 47: // 12A12 CM Z-AXIS ACCEL
-		case 111:
-			tx_data[tx_offset] = measure(12,TLM_A,12); 
-			break;
-		case 48:
-			switch(frame_count){
-				case 0: // 11A14 ECS O2 FLOW O2 SUPPLY MANF
-					tx_data[tx_offset] = measure(11,TLM_A,14);  
-					break;
-				case 1: // 11A50 USB RCVR PHASE ERR
-					tx_data[tx_offset] = measure(11,TLM_A,50); 
-					break;
-				case 2: // 11A86
-					tx_data[tx_offset] = measure(11,TLM_A,86); 
-					break;
-				case 3: // 11A122
-					tx_data[tx_offset] = measure(11,TLM_A,122); 
-					break;
-				case 4: // 11A158
-					tx_data[tx_offset] = measure(11,TLM_A,158); 
-					break;
-			}
-			break;
-		case 49: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 50: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 51: // MAGICAL WORD 1
-			// 10A1
-			// 10A4
-			// 10A7
-			// ...
-			// 10A148
-			tx_data[tx_offset] = measure(10,TLM_A,1+(frame_addr*3));
-			break;
-		case 52: // 12A13
-		case 116:
-			tx_data[tx_offset] = measure(12,TLM_A,13); 
-			break;
-		case 53: // 12A14
-		case 117:
-			tx_data[tx_offset] = measure(12,TLM_A,14); 
-			break;
-		case 54: // 12A15
-		case 118:
-			tx_data[tx_offset] = measure(12,TLM_A,15); 
-			break;
-		case 55: // 12A16
-		case 119:
-			tx_data[tx_offset] = measure(12,TLM_A,16); 
-			break;
-		case 56:
-			switch(frame_count){
-				case 0: // 11A15
-					tx_data[tx_offset] = measure(11,TLM_A,15); 
-					break;
-				case 1: // 11A51
-					tx_data[tx_offset] = measure(11,TLM_A,51); 
-					break;
-				case 2: // 11A87
-					tx_data[tx_offset] = measure(11,TLM_A,87); 
-					break;
-				case 3: // 11A123
-					tx_data[tx_offset] = measure(11,TLM_A,123); 
-					break;
-				case 4: // 11A159
-					tx_data[tx_offset] = measure(11,TLM_A,159); 
-					break;
-			}
-			break;
-		case 57:
-			switch(frame_count){
-				case 0: // 11A16
-					tx_data[tx_offset] = measure(11,TLM_A,16); 
-					break;
-				case 1: // 11A52
-					tx_data[tx_offset] = measure(11,TLM_A,52); 
-					break;
-				case 2: // 11A88
-					tx_data[tx_offset] = measure(11,TLM_A,88); 
-					break;
-				case 3: // 11A124
-					tx_data[tx_offset] = measure(11,TLM_A,124); 
-					break;
-				case 4: // 11A160
-					tx_data[tx_offset] = measure(11,TLM_A,160); 
-					break;
-			}
-			break;
-		case 58:
-			switch(frame_count){
-				case 0: // 11A17
-					tx_data[tx_offset] = measure(11,TLM_A,17); 
-					break;
-				case 1: // 11A53
-					tx_data[tx_offset] = measure(11,TLM_A,53); 
-					break;
-				case 2: // 11A89
-					tx_data[tx_offset] = measure(11,TLM_A,89); 
-					break;
-				case 3: // 11A125
-					tx_data[tx_offset] = measure(11,TLM_A,125); 
-					break;
-				case 4: // 11A161
-					tx_data[tx_offset] = measure(11,TLM_A,161); 
-					break;
-			}
-			break;
-		case 59:
-			switch(frame_count){
-				case 0: // 11A18
-					tx_data[tx_offset] = measure(11,TLM_A,18); 
-					break;
-				case 1: // 11A54
-					tx_data[tx_offset] = measure(11,TLM_A,54); 
-					break;
-				case 2: // 11A90
-					tx_data[tx_offset] = measure(11,TLM_A,90); 
-					break;
-				case 3: // 11A126
-					tx_data[tx_offset] = measure(11,TLM_A,126); 
-					break;
-				case 4: // 11A162
-					tx_data[tx_offset] = measure(11,TLM_A,162); 
-					break;
-			}
-			break;
-		case 60: // 51A4
-			tx_data[tx_offset] = measure(51,TLM_A,4); 
-			break;
-		case 61: // 51A5
-			tx_data[tx_offset] = measure(51,TLM_A,5); 
-			break;
-		case 62: // 51A6
-			tx_data[tx_offset] = measure(51,TLM_A,6); 
-			break;
-		case 63: // 51A7
-			tx_data[tx_offset] = measure(51,TLM_A,7); 
-			break;
-		case 64:
-			switch(frame_count){
-				case 0: // 11DP2A
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP6
-					tx_data[tx_offset] = measure(11,TLM_DP,6); 
-					break;
-				case 2: // 11DP13
-					tx_data[tx_offset] = measure(11,TLM_DP,13); 
-					break;
-				case 3: // 11DP20
-					tx_data[tx_offset] = measure(11,TLM_DP,20); 
-					break;
-				case 4: // 11DP27
-					tx_data[tx_offset] = measure(11,TLM_DP,27); 
-					break;
-			}
-			break;
-		case 65:
-			switch(frame_count){
-				case 0: // 11DP2B
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP7
-					tx_data[tx_offset] = measure(11,TLM_DP,7); 
-					break;
-				case 2: // 11DP14
-					tx_data[tx_offset] = measure(11,TLM_DP,14); 
-					break;
-				case 3: // 11DP21
-					tx_data[tx_offset] = measure(11,TLM_DP,21); 
-					break;
-				case 4: // 11DP28
-					tx_data[tx_offset] = measure(11,TLM_DP,28); 
-					break;
-			}
-			break;
-		case 66:
-			switch(frame_count){
-				case 0: // 11DP2C
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP8
-					tx_data[tx_offset] = measure(11,TLM_DP,8); 
-					break;
-				case 2: // 11DP15
-					tx_data[tx_offset] = measure(11,TLM_DP,15); 
-					break;
-				case 3: // 11DP22
-					tx_data[tx_offset] = measure(11,TLM_DP,22); 
-					break;
-				case 4: // 11DP29
-					tx_data[tx_offset] = measure(11,TLM_DP,29); 
-					break;
-			}
-			break;
-		case 67:
-			switch(frame_count){
-				case 0: // 11DP2D
-					tx_data[tx_offset] = measure(11,TLM_DP,2); 
-					break;
-				case 1: // 11DP9
-					tx_data[tx_offset] = measure(11,TLM_DP,9); 
-					break;
-				case 2: // 11DP16
-					tx_data[tx_offset] = measure(11,TLM_DP,16); 
-					break;
-				case 3: // 11DP23
-					tx_data[tx_offset] = measure(11,TLM_DP,23); 
-					break;
-				case 4: // 11DP30
-					tx_data[tx_offset] = measure(11,TLM_DP,30); 
-					break;
-			}
-			break;
-		case 72: 
-			switch(frame_count){
-				case 0: // 11A19
-					tx_data[tx_offset] = measure(11,TLM_A,19); 
-					break;
-				case 1: // 11A55
-					tx_data[tx_offset] = measure(11,TLM_A,55);  
-					break;
-				case 2: // 11A91
-					tx_data[tx_offset] = measure(11,TLM_A,91); 
-					break;
-				case 3: // 11A127
-					tx_data[tx_offset] = measure(11,TLM_A,127); 
-					break;
-				case 4: // 11A163
-					tx_data[tx_offset] = measure(11,TLM_A,163); 
-					break;
-			}
-			break;
-		case 73:
-			switch(frame_count){
-				case 0: // 11A20
-					tx_data[tx_offset] = measure(11,TLM_A,20); 
-					break;
-				case 1: // 11A56 AC BUS 2 PH A VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,56); 
-					break;
-				case 2: // 11A92
-					tx_data[tx_offset] = measure(11,TLM_A,92); 
-					break;
-				case 3: // 11A128
-					tx_data[tx_offset] = measure(11,TLM_A,128); 
-					break;
-				case 4: // 11A164
-					tx_data[tx_offset] = measure(11,TLM_A,164); 
-					break;
-			}
-			break;
-		case 74:
-			switch(frame_count){
-				case 0: // 11A21
-					tx_data[tx_offset] = measure(11,TLM_A,21); 
-					break;
-				case 1: // 11A57 MNA VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,57); 
-					break;
-				case 2: // 11A93
-					tx_data[tx_offset] = measure(11,TLM_A,93); 
-					break;
-				case 3: // 11A129
-					tx_data[tx_offset] = measure(11,TLM_A,129); 
-					break;
-				case 4: // 11A165
-					tx_data[tx_offset] = measure(11,TLM_A,165); 
-					break;
-			}
-			break;
-		case 75:
-			switch(frame_count){
-				case 0: // 11A22
-					tx_data[tx_offset] = measure(11,TLM_A,22); 
-					break;
-				case 1: // 11A58 MNB VOLTS
-					tx_data[tx_offset] = measure(11,TLM_A,58); 
-					break;
-				case 2: // 11A94
-					tx_data[tx_offset] = measure(11,TLM_A,94); 
-					break;
-				case 3: // 11A130
-					tx_data[tx_offset] = measure(11,TLM_A,130); 
-					break;
-				case 4: // 11A166
-					tx_data[tx_offset] = measure(11,TLM_A,166); 
-					break;
-			}
-			break;
-		case 80:
-			switch(frame_count){
-				case 0: // 11A23
-					tx_data[tx_offset] = measure(11,TLM_A,23); 
-					break;
-				case 1: // 11A59
-					tx_data[tx_offset] = measure(11,TLM_A,59); 
-					break;
-				case 2: // 11A95
-					tx_data[tx_offset] = measure(11,TLM_A,95); 
-					break;
-				case 3: // 11A131
-					tx_data[tx_offset] = measure(11,TLM_A,131); 
-					break;
-				case 4: // 11A167
-					tx_data[tx_offset] = measure(11,TLM_A,167); 
-					break;
-			}
-			break;
-		case 81: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 82: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 83: // MAGICAL WORD 2
-			// 10A2
-			// 10A5
-			// 10A8
-			// ...
-			// 10A149
-			tx_data[tx_offset] = measure(10,TLM_A,2+(frame_addr*3));
-			break;
-		case 88:
-			switch(frame_count){
-				case 0: // 11A24
-					tx_data[tx_offset] = measure(11,TLM_A,24); 
-					break;
-				case 1: // 11A60
-					tx_data[tx_offset] = measure(11,TLM_A,60); 
-					break;
-				case 2: // 11A96
-					tx_data[tx_offset] = measure(11,TLM_A,96); 
-					break;
-				case 3: // 11A132
-					tx_data[tx_offset] = measure(11,TLM_A,132); 
-					break;
-				case 4: // 11A168
-					tx_data[tx_offset] = measure(11,TLM_A,168); 
-					break;
-			}
-			break;
-		case 89:
-			switch(frame_count){
-				case 0: // 11A25
-					tx_data[tx_offset] = measure(11,TLM_A,25); 
-					break;
-				case 1: // 11A61
-					tx_data[tx_offset] = measure(11,TLM_A,61); 
-					break;
-				case 2: // 11A97
-					tx_data[tx_offset] = measure(11,TLM_A,97); 
-					break;
-				case 3: // 11A133
-					tx_data[tx_offset] = measure(11,TLM_A,133); 
-					break;
-				case 4: // 11A169
-					tx_data[tx_offset] = measure(11,TLM_A,169); 
-					break;
-			}
-			break;
-		case 90:
-			switch(frame_count){
-				case 0: // 11A26
-					tx_data[tx_offset] = measure(11,TLM_A,26); 
-					break;
-				case 1: // 11A62
-					tx_data[tx_offset] = measure(11,TLM_A,62); 
-					break;
-				case 2: // 11A98
-					tx_data[tx_offset] = measure(11,TLM_A,98); 
-					break;
-				case 3: // 11A134
-					tx_data[tx_offset] = measure(11,TLM_A,134); 
-					break;
-				case 4: // 11A170
-					tx_data[tx_offset] = measure(11,TLM_A,170); 
-					break;
-			}
-			break;
-		case 91:
-			switch(frame_count){
-				case 0: // 11A27
-					tx_data[tx_offset] = measure(11,TLM_A,27); 
-					break;
-				case 1: // 11A63
-					tx_data[tx_offset] = measure(11,TLM_A,63); 
-					break;
-				case 2: // 11A99
-					tx_data[tx_offset] = measure(11,TLM_A,99); 
-					break;
-				case 3: // 11A135
-					tx_data[tx_offset] = measure(11,TLM_A,135); 
-					break;
-				case 4: // 11A171
-					tx_data[tx_offset] = measure(11,TLM_A,171); 
-					break;
-			}
-			break;
-		case 92: // 51A8
-			tx_data[tx_offset] = measure(51,TLM_A,8); 
-			break;
-		case 93: // 51A9
-			tx_data[tx_offset] = measure(51,TLM_A,9); 
-			break;
-		case 94: // 51A10
-			tx_data[tx_offset] = measure(51,TLM_A,10); 
-			break;
-		case 95: // 51A11
-			tx_data[tx_offset] = measure(51,TLM_A,11); 
-			break;
-		case 96:
-			switch(frame_count){
-				case 0: // 11DP3
-					tx_data[tx_offset] = measure(11,TLM_DP,3); 
-					break;
-				case 1: // 11DP10
-					tx_data[tx_offset] = measure(11,TLM_DP,10); 
-					break;
-				case 2: // 11DP17
-					tx_data[tx_offset] = measure(11,TLM_DP,17); 
-					break;
-				case 3: // 11DP24
-					tx_data[tx_offset] = measure(11,TLM_DP,24); 
-					break;
-				case 4: // 11DP31
-					tx_data[tx_offset] = measure(11,TLM_DP,31); 
-					break;
-			}
-			break;
-		case 97:
-			switch(frame_count){
-				case 0: // 11DP4
-					tx_data[tx_offset] = measure(11,TLM_DP,4); 
-					break;
-				case 1: // 11DP11
-					tx_data[tx_offset] = measure(11,TLM_DP,11); 
-					break;
-				case 2: // 11DP18
-					tx_data[tx_offset] = measure(11,TLM_DP,18); 
-					break;
-				case 3: // 11DP25
-					tx_data[tx_offset] = measure(11,TLM_DP,25); 
-					break;
-				case 4: // 11DP32
-					tx_data[tx_offset] = measure(11,TLM_DP,32); 
-					break;
-			}
-			break;
-		case 98:
-			switch(frame_count){
-				case 0: // 11DP5
-					tx_data[tx_offset] = measure(11,TLM_DP,5); 
-					break;
-				case 1: // 11DP12
-					tx_data[tx_offset] = measure(11,TLM_DP,12); 
-					break;
-				case 2: // 11DP19
-					tx_data[tx_offset] = measure(11,TLM_DP,19); 
-					break;
-				case 3: // 11DP26
-					tx_data[tx_offset] = measure(11,TLM_DP,26); 
-					break;
-				case 4: // 11DP33
-					tx_data[tx_offset] = measure(11,TLM_DP,33); 
-					break;
-			}
-			break;
-		case 99: // 51DP2
-			tx_data[tx_offset] = measure(51,TLM_DP,2); 
-			break;
-		case 104:
-			switch(frame_count){
-				case 0: // 11A28
-					tx_data[tx_offset] = measure(11,TLM_A,28); 
-					break;
-				case 1: // 11A64
-					tx_data[tx_offset] = measure(11,TLM_A,64); 
-					break;
-				case 2: // 11A100
-					tx_data[tx_offset] = measure(11,TLM_A,100); 
-					break;
-				case 3: // 11A136
-					tx_data[tx_offset] = measure(11,TLM_A,136); 
-					break;
-				case 4: // 11A172
-					tx_data[tx_offset] = measure(11,TLM_A,172); 
-					break;
-			}
-			break;
-		case 105:
-			switch(frame_count){
-				case 0: // 11A29 FC1 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,29); 
-					break;
-				case 1: // 11A65
-					tx_data[tx_offset] = measure(11,TLM_A,65); 
-					break;
-				case 2: // 11A101
-					tx_data[tx_offset] = measure(11,TLM_A,101); 
-					break;
-				case 3: // 11A137
-					tx_data[tx_offset] = measure(11,TLM_A,137); 
-					break;
-				case 4: // 11A173
-					tx_data[tx_offset] = measure(11,TLM_A,173); 
-					break;
-			}
-			break;
-		case 106:
-			switch(frame_count){
-				case 0: // 11A30 FC2 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,30); 
-					break;
-				case 1: // 11A66
-					tx_data[tx_offset] = measure(11,TLM_A,66); 
-					break;
-				case 2: // 11A102
-					tx_data[tx_offset] = measure(11,TLM_A,102); 
-					break;
-				case 3: // 11A138
-					tx_data[tx_offset] = measure(11,TLM_A,138); 
-					break;
-				case 4: // 11A174
-					tx_data[tx_offset] = measure(11,TLM_A,174); 
-					break;
-			}
-			break;
-		case 107:
-			switch(frame_count){
-				case 0: // 11A31
-					tx_data[tx_offset] = measure(11,TLM_A,31); 
-					break;
-				case 1: // 11A67 FC1 O2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,67); 
-					break;
-				case 2: // 11A103
-					tx_data[tx_offset] = measure(11,TLM_A,103); 
-					break;
-				case 3: // 11A139
-					tx_data[tx_offset] = measure(11,TLM_A,139); 
-					break;
-				case 4: // 11A175
-					tx_data[tx_offset] = measure(11,TLM_A,175); 
-					break;
-			}
-			break;
-		case 112:
-			switch(frame_count){
-				case 0: // 11A32 
-					tx_data[tx_offset] = measure(11,TLM_A,32); 
-					break;
-				case 1: // 11A68 FC2 O2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,68); 
-					break;
-				case 2: // 11A104
-					tx_data[tx_offset] = measure(11,TLM_A,104); 
-					break;
-				case 3: // 11A140
-					tx_data[tx_offset] = measure(11,TLM_A,140); 
-					break;
-				case 4: // 11A176
-					tx_data[tx_offset] = measure(11,TLM_A,176); 
-					break;
-			}
-			break;
-		case 113: // 22DP1
-			tx_data[tx_offset] = measure(22,TLM_DP,1); 
-			break;
-		case 114: // 22DP2
-			tx_data[tx_offset] = measure(22,TLM_DP,2); 
-			break;
-		case 115: // MAGICAL WORD 3
-			// 10A3
-			// 10A6
-			// 10A9
-			// ...
-			// 10A150
-			tx_data[tx_offset] = measure(10,TLM_A,3+(frame_addr*3));
-			break;
-		case 120:
-			switch(frame_count){
-				case 0: // 11A33 
-					tx_data[tx_offset] = measure(11,TLM_A,33); 
-					break;
-				case 1: // 11A69
-					tx_data[tx_offset] = measure(11,TLM_A,69); 
-					break;
-				case 2: // 11A105
-					tx_data[tx_offset] = measure(11,TLM_A,105); 
-					break;
-				case 3: // 11A141
-					tx_data[tx_offset] = measure(11,TLM_A,141); 
-					break;
-				case 4: // 11A177
-					tx_data[tx_offset] = measure(11,TLM_A,177); 
-					break;
-			}
-			break;
-		case 121:
-			switch(frame_count){
-				case 0: // 11A34
-					tx_data[tx_offset] = measure(11,TLM_A,34); 
-					break;
-				case 1: // 11A70
-					tx_data[tx_offset] = measure(11,TLM_A,70); 
-					break;
-				case 2: // 11A106
-					tx_data[tx_offset] = measure(11,TLM_A,106); 
-					break;
-				case 3: // 11A142
-					tx_data[tx_offset] = measure(11,TLM_A,142); 
-					break;
-				case 4: // 11A178
-					tx_data[tx_offset] = measure(11,TLM_A,178); 
-					break;
-			}
-			break;
-		case 122:
-			switch(frame_count){
-				case 0: // 11A35 FC3 N2 PRESS
-					tx_data[tx_offset] = measure(11,TLM_A,35); 
-					break;
-				case 1: // 11A71
-					tx_data[tx_offset] = measure(11,TLM_A,71); 
-					break;
-				case 2: // 11A107
-					tx_data[tx_offset] = measure(11,TLM_A,107); 
-					break;
-				case 3: // 11A143
-					tx_data[tx_offset] = measure(11,TLM_A,143); 
-					break;
-				case 4: // 11A179
-					tx_data[tx_offset] = measure(11,TLM_A,179); 
-					break;
-			}
-			break;
-		case 123:
-			switch(frame_count){
-				case 0: // 11A36
-					tx_data[tx_offset] = measure(11,TLM_A,36); 
-					break;
-				case 1: // 11A72
-					tx_data[tx_offset] = measure(11,TLM_A,72); 
-					break;
-				case 2: // 11A108
-					tx_data[tx_offset] = measure(11,TLM_A,108); 
-					break;
-				case 3: // 11A143
-					tx_data[tx_offset] = measure(11,TLM_A,143); 
-					break;
-				case 4: // 11A180
-					tx_data[tx_offset] = measure(11,TLM_A,180); 
-					break;
-			}
-			break;
-		case 124: // 51A12
-			tx_data[tx_offset] = measure(51,TLM_A,12); 
-			break;
-		case 125: // 51A13
-			tx_data[tx_offset] = measure(51,TLM_A,13); 
-			break;
-		case 126: // 51A14
-			tx_data[tx_offset] = measure(51,TLM_A,14); 
-			break;
-		case 127: // 51A15
-			tx_data[tx_offset] = measure(51,TLM_A,15); 
-			break;
-
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
-			break;
-	}
-	word_addr++;
-	if(word_addr > 127){
-		word_addr = 0;
-		frame_addr++;
-		if(frame_addr > 49){
-			frame_addr = 0;
-		}
-		frame_count++;
-		if(frame_count > 4){
-			frame_count = 0;
-		}
-	}
-}
-
-void PCM::perform_io(double simt){
-	// Do TCP IO	
-	switch(conn_state){
-		case 0: // UNINITIALIZED
-			break;
-		case 1: // INITALIZED, LISTENING
-			// Do we have data from MCC?
-			if (mcc_size > 0) {
-				// sprintf(oapiDebugString(), "MCCSIZE %d LRX %f LRXINT %f", mcc_size, last_rx, ((simt - last_rx) / 0.005));
-				// Should we recieve?
-				if ((fabs(simt - last_rx) / 0.1) < 1 || sat->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
-					return; // No
-				}
-				last_rx = simt;
-				// Yes. Take a byte
-				rx_data[rx_offset] = mcc_data[mcc_offset];
-				mcc_offset++;
-				// If uplink isn't blocked
-				if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
-					// Handle it
-					handle_uplink();
-				}
-				// Are we done?
-				if (mcc_offset >= mcc_size) {
-					// We reached the end of the MCC buffer.
-					mcc_offset = mcc_size = 0;
-				}
-			}else{
-				// Try to accept
-				AcceptSocket = accept( m_socket, NULL, NULL );
-				if(AcceptSocket != INVALID_SOCKET){
-					conn_state = 2; // Accept this!
-					wsk_error = 0; // For now
-				}
-			}
-			// Otherwise loop and try again.
-			break;
-		case 2: // CONNECTED			
-			int bytesSent,bytesRecv;
-
-			bytesSent = send(AcceptSocket, (char *)tx_data, tx_size, 0 );
-			if(bytesSent == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10038: // Socket isn't a socket
-					case 10053: // Software caused connection abort
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
-
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"TELECOM: send() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-			}
-			// Should we recieve?
-			if ((fabs(simt - last_rx) / 0.005) < 1 || sat->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
-				return; // No
-			}
-			last_rx = simt;
-			bytesRecv = recv( AcceptSocket, (char *)(rx_data+rx_offset), 1, 0 );
-			if(bytesRecv == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
-				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
-					case 10053: // Software caused connection abort
-					case 10038: // Socket isn't a socket
-					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;
-
-					default:           // If unknown
-						wsk_error = 1; // do this
-						sprintf(wsk_emsg,"TELECOM: recv() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
-				}
-				// Do we have data from MCC instead?
-				if (mcc_size > 0) {
-					// Yes. Take a byte
-					rx_data[rx_offset] = mcc_data[mcc_offset];
-					mcc_offset++;
-					// If the telemetry data-path is disconnected, discard the data
-					if (sat->UPTLMSwitch1.GetState() != TOGGLESWITCH_DOWN) {
-						// otherwise handle it
-						handle_uplink();
-					}
-					// Are we done?
-					if (mcc_offset >= mcc_size) {
-						// We reached the end of the MCC buffer.
-						mcc_offset = mcc_size = 0;
-					}
-				}
-			}else{
-				// If the telemetry data-path is disconnected
-				if(sat->UPTLMSwitch1.GetState() == TOGGLESWITCH_DOWN){
-					return; // Discard the data
-				}
-				if(bytesRecv > 0){
-					handle_uplink();
-				} else {
-					// Do we have data from MCC instead?
-					if (mcc_size > 0) {
-						// Yes. Take a byte
-						rx_data[rx_offset] = mcc_data[mcc_offset];
-						mcc_offset++;
-						// Handle it
-						handle_uplink();
-						// Are we done?
-						if (mcc_offset >= mcc_size) {
-							// We reached the end of the MCC buffer.
-							mcc_offset = mcc_size = 0;
-						}
-					}
-				}
-			}
-			break;			
-	}
-}
-
-// Handle data moved to buffer from either the socket or mcc buffer
-void PCM::handle_uplink() {
-	switch (uplink_state) {
-	case 0: // NEW COMMAND START
-		int va, sa;
-		va = ((rx_data[rx_offset] & 070) >> 3);
-		sa = rx_data[rx_offset] & 07;
-		// *** VEHICLE ADDRESS HARDCODED HERE *** (NASA DID THIS TOO)
-		if (va != 04) { break; }
-		switch (sa) {
-		case 0: // TEST
-			rx_offset++; uplink_state = 10;
-			break;
-		case 3: // CMC-UPDATA
-			rx_offset++; uplink_state = 20;
-			break;
-		case 4: // CTE-UPDATE
-			rx_offset++; uplink_state = 30;
+		case 4: // CTE-UPDATE
+			rx_offset++; uplink_state = 30;
 			break;
 		case 5: // RTC-SALVO
 			rx_offset++; uplink_state = 40;
@@ -5202,80 +4086,119 @@ void PCM::handle_uplink() {
 	}
 }
 
-DSEChunk::DSEChunk() :
-	chunkData( 0 ),
-	chunkSize( 0 ),
-	chunkValidBytes( 0 ),
-	chunkType( DSEEMPTY )
+static const char DSETapeMagic[8] = { 'N', 'A', 'S', 'S', 'P', 'D', 'S', 'E' };
+
+static unsigned int DSETapeImageSize()
 {
-	// Nothing to do.
+	return sizeof(DSETapeHeader) + tapeSize * (sizeof(DSEChunk) + dseChunkSizeHBR);
 }
 
-DSEChunk::~DSEChunk()
+DSE::DSE() :
+	tapeImage( 0 ),
+	tape( 0 ),
+	tapeData( 0 ),
+	tapeFile( INVALID_HANDLE_VALUE ),
+	tapeMapping( 0 ),
+	tapePosition( 0.0 ),
+	recordChunk( -1 ),
+	recordHBR( true ),
+	tapeSpeedInchesPerSecond( 0.0 ),
+	desiredTapeSpeed( 0.0 ),
+	tapeMotion( 0.0 ),
+	state( STOPPED )
 {
-	deleteData();
+	lastEventTime = 0;
 }
 
-void DSEChunk::deleteData()
+DSE::~DSE()
 {
-	if ( chunkData )
-	{
-		delete[] chunkData;
-	}
-
-	chunkData = 0;
-	chunkSize = 0;
-	chunkValidBytes = 0;
-	chunkType = DSEEMPTY;
+	FreeTape();
 }
 
-void DSEChunk::Erase( const DSEChunkType dataType )
+void DSE::Init(Saturn *vessel)
 {
-	unsigned int requiredData = 0;
-
-	switch ( dataType )
-	{
-	case DSEHBR:
-		requiredData = dseChunkSizeHBR;
-		break;
+	sat = vessel;
+}
 
-	case DSELBR:
-		requiredData = dseChunkSizeLBR;
-		break;
+//
+// The whole tape is one block, so it's allocated once instead of chunk by chunk.
+//
 
-	default:
-		deleteData();
-		return;
-	}
+bool DSE::AllocateTape()
+{
+	if (tapeImage)
+		return true;
 
-	if ( chunkSize < requiredData )
-	{
-		deleteData();
+	unsigned char *image = new unsigned char[DSETapeImageSize()];
+	memset(image, 0, DSETapeImageSize());
 
-		chunkData = new unsigned char[requiredData];
-		chunkSize = requiredData;
-	}
+	tapeImage = (DSETapeHeader *)image;
+	memcpy(tapeImage->magic, DSETapeMagic, sizeof(DSETapeMagic));
+	tapeImage->tapeSize = tapeSize;
+	tapeImage->chunkSize = dseChunkSizeHBR;
 
-	chunkType = dataType;
-	chunkValidBytes = 0;
+	tape = (DSEChunk *)(image + sizeof(DSETapeHeader));
+	tapeData = image + sizeof(DSETapeHeader) + tapeSize * sizeof(DSEChunk);
+	return true;
 }
 
-DSE::DSE() :
-	tapeSpeedInchesPerSecond( 0.0 ),
-	desiredTapeSpeed( 0.0 ),
-	tapeMotion( 0.0 ),
-	state( STOPPED )
+void DSE::FreeTape()
 {
-	lastEventTime = 0;
-}
+	if (tapeMapping) {
+		UnmapViewOfFile(tapeImage);
+		CloseHandle(tapeMapping);
+		CloseHandle(tapeFile);
+		tapeMapping = 0;
+		tapeFile = INVALID_HANDLE_VALUE;
+	}
+	else {
+		delete[] (unsigned char *)tapeImage;
+	}
 
-DSE::~DSE()
-{
+	tapeImage = 0;
+	tape = 0;
+	tapeData = 0;
 }
 
-void DSE::Init(Saturn *vessel)
+bool DSE::OpenTapeFile(const char *fname)
 {
-	sat = vessel;
+	char buffer[512];
+
+	HANDLE f = CreateFileA(fname, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (f == INVALID_HANDLE_VALUE) {
+		sprintf(buffer, "(DSE) Can't open tape file %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	// Mapping the file grows it to the size of the tape, new space reads as erased tape
+	HANDLE m = CreateFileMappingA(f, NULL, PAGE_READWRITE, 0, DSETapeImageSize(), NULL);
+	void *view = m ? MapViewOfFile(m, FILE_MAP_WRITE, 0, 0, DSETapeImageSize()) : NULL;
+	if (!view) {
+		if (m) CloseHandle(m);
+		CloseHandle(f);
+		sprintf(buffer, "(DSE) Can't map tape file %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	FreeTape();
+
+	tapeFile = f;
+	tapeMapping = m;
+	tapeImage = (DSETapeHeader *)view;
+
+	unsigned char *image = (unsigned char *)view;
+	tape = (DSEChunk *)(image + sizeof(DSETapeHeader));
+	tapeData = image + sizeof(DSETapeHeader) + tapeSize * sizeof(DSEChunk);
+
+	if (memcmp(tapeImage->magic, DSETapeMagic, sizeof(DSETapeMagic)) || tapeImage->tapeSize != tapeSize || tapeImage->chunkSize != dseChunkSizeHBR) {
+		memset(image, 0, DSETapeImageSize());
+		memcpy(tapeImage->magic, DSETapeMagic, sizeof(DSETapeMagic));
+		tapeImage->tapeSize = tapeSize;
+		tapeImage->chunkSize = dseChunkSizeHBR;
+	}
+	return true;
 }
 
 bool DSE::TapeMotion()
@@ -5296,11 +4219,27 @@ const double playSpeed = 120.0;
 const double hbrRecord = 15.0;
 const double lbrRecord = 3.75;
 
+//
+// HBR data is played back at 4:1, LBR data at 32:1.
+//
+
+double DSE::PlaySpeed()
+{
+	int c = (int)(tapePosition / dseChunkLength);
+
+	if (tape && c >= 0 && c < (int)tapeSize && tape[c].chunkType == DSEHBR)
+		return hbrRecord * 4.0;
+
+	return playSpeed;
+}
+
 void DSE::Play()
 {
-	if ( state != PLAYING || desiredTapeSpeed < playSpeed  )
+	recordChunk = -1;
+
+	if ( state != PLAYING || desiredTapeSpeed != PlaySpeed() )
 	{
-		desiredTapeSpeed = playSpeed;
+		desiredTapeSpeed = PlaySpeed();
 		state = STARTING_PLAY;
 	} else
 		state = PLAYING;
@@ -5308,6 +4247,8 @@ void DSE::Play()
 
 void DSE::Stop()
 {
+	recordChunk = -1;
+
 	if ( state != STOPPED || desiredTapeSpeed > 0.0  )
 	{
 		desiredTapeSpeed = 0.0;
@@ -5339,19 +4280,130 @@ void DSE::Record( bool hbr )
 		state = RECORDING;
 }
 
+//
+// While recording, the tape moves with the data written to it. Recording always
+// starts on a chunk boundary and a chunk only holds data of one bit rate.
+//
+
+void DSE::RecordWords(const unsigned char *data, int count, bool hbr)
+{
+	if (hbr != recordHBR) {
+		recordHBR = hbr;
+		if (state == RECORDING || state == STARTING_RECORD || state == SLOWING_RECORD) {
+			Record(hbr);
+		}
+	}
+
+	if (state != RECORDING || !sat->TapeRecorderForwardSwitch.IsUp() || !AllocateTape())
+		return;
+
+	unsigned short type = hbr ? DSEHBR : DSELBR;
+	unsigned int size = hbr ? dseChunkSizeHBR : dseChunkSizeLBR;
+
+	while (count > 0) {
+		int c = (int)(tapePosition / dseChunkLength);
+
+		if (c != recordChunk || tape[c].chunkType != type) {
+			if (tapePosition > c * dseChunkLength) {
+				c++;
+			}
+			if (c >= (int)tapeSize) {
+				// End of tape
+				tapePosition = tapeSize * dseChunkLength;
+				Stop();
+				return;
+			}
+
+			tape[c].chunkType = type;
+			tape[c].chunkValidBytes = 0;
+			recordChunk = c;
+		}
+
+		DSEChunk &chunk = tape[c];
+		unsigned char *dst = tapeData + c * dseChunkSizeHBR + chunk.chunkValidBytes;
+		int n = size - chunk.chunkValidBytes;
+		if (n > count) n = count;
+
+		if (data) {
+			memcpy(dst, data, n);
+			data += n;
+		}
+		else {
+			memset(dst, 0, n);
+		}
+		chunk.chunkValidBytes += n;
+		count -= n;
+
+		tapePosition = (c + (double)chunk.chunkValidBytes / size) * dseChunkLength;
+		if (chunk.chunkValidBytes >= size) {
+			recordChunk = -1;
+		}
+	}
+}
+
+//
+// Send the data passing the head between two tape positions to the dump channel,
+// in the order it passes the head.
+//
+
+void DSE::PlayBack(double from, double to)
+{
+	if (!tape)
+		return;
+
+	bool forward = to > from;
+	double lo = forward ? from : to;
+	double hi = forward ? to : from;
+
+	int first = (int)(lo / dseChunkLength);
+	int last = (int)(hi / dseChunkLength);
+	if (first < 0) first = 0;
+	if (last >= (int)tapeSize) last = tapeSize - 1;
+
+	unsigned char buffer[1024];
+	unsigned n = 0;
+
+	for (int i = 0; i <= last - first; i++) {
+		int c = forward ? first + i : last - i;
+		const DSEChunk &chunk = tape[c];
+
+		if (chunk.chunkType == DSEEMPTY || chunk.chunkValidBytes == 0)
+			continue;
+
+		unsigned int size = (chunk.chunkType == DSEHBR) ? dseChunkSizeHBR : dseChunkSizeLBR;
+		double start = c * dseChunkLength;
+		int b0 = (int)ceil((lo - start) / dseChunkLength * size);
+		int b1 = (int)ceil((hi - start) / dseChunkLength * size);
+		if (b0 < 0) b0 = 0;
+		if (b1 > chunk.chunkValidBytes) b1 = chunk.chunkValidBytes;
+
+		const unsigned char *src = tapeData + c * dseChunkSizeHBR;
+		for (int b = 0; b < b1 - b0; b++) {
+			buffer[n++] = src[forward ? b0 + b : b1 - 1 - b];
+			if (n == sizeof(buffer)) {
+				sat->pcm.dump.Push(buffer, n);
+				n = 0;
+			}
+		}
+	}
+
+	if (n > 0) {
+		sat->pcm.dump.Push(buffer, n);
+	}
+}
+
 const double tapeAccel = 30.0;
 
 void DSE::TimeStep( double simt, double simdt )
 {
-	/// \todo forward/backward motion
-	/// \todo high/low bitrate
+	bool forward = sat->TapeRecorderForwardSwitch.IsUp();
 
 	switch ( state )
 	{
 	case STOPPED:
 		if (!sat->TapeRecorderForwardSwitch.IsCenter()) {
 			if (sat->TapeRecorderRecordSwitch.IsUp()) {
-				Record(true);
+				Record(recordHBR);
 			} else if (sat->TapeRecorderRecordSwitch.IsDown()) {
 				Play();
 			}
@@ -5362,7 +4414,10 @@ void DSE::TimeStep( double simt, double simdt )
 		if (sat->TapeRecorderForwardSwitch.IsCenter() || sat->TapeRecorderRecordSwitch.IsCenter()) {
 			Stop();
 		} else if (sat->TapeRecorderRecordSwitch.IsUp()) {
-			Record(true);
+			Record(recordHBR);
+		} else {
+			// The tape transport follows the bit rate of the data under the head
+			desiredTapeSpeed = tapeSpeedInchesPerSecond = PlaySpeed();
 		}
 		break;
 
@@ -5413,21 +4468,40 @@ void DSE::TimeStep( double simt, double simdt )
 	default:
 		break;
 	}
+
+	//
+	// Move the tape. While recording forward, RecordWords() moves it.
+	//
+
+	if (tapeSpeedInchesPerSecond > 0.0 && !(state == RECORDING && forward)) {
+		double end = tapeSize * dseChunkLength;
+		double pos = tapePosition + (forward ? 1.0 : -1.0) * tapeSpeedInchesPerSecond * simdt;
+
+		if (pos < 0.0 || pos > end) {
+			pos = (pos < 0.0) ? 0.0 : end;
+			Stop();
+		}
+		if (state == PLAYING) {
+			PlayBack(tapePosition, pos);
+		}
+		tapePosition = pos;
+	}
+
 	lastEventTime = simt;
-	//sprintf(oapiDebugString(), "DSE tapeSpeedips %lf desired %lf tapeMotion %lf state %i", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state);
+	//sprintf(oapiDebugString(), "DSE tapeSpeedips %lf desired %lf tapeMotion %lf state %i pos %lf", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state, tapePosition);
 }
 
 void DSE::LoadState(char *line) {
 	
-	/// \todo DSE Chunks
+	// The tape contents are only kept when there's a tape file
 
-	sscanf(line + 12, "%lf %lf %lf %i %lf", &tapeSpeedInchesPerSecond, &desiredTapeSpeed, &tapeMotion, &state, &lastEventTime);
+	sscanf(line + 12, "%lf %lf %lf %i %lf %lf", &tapeSpeedInchesPerSecond, &desiredTapeSpeed, &tapeMotion, &state, &lastEventTime, &tapePosition);
 }
 
 void DSE::SaveState(FILEHANDLE scn) {
 	char buffer[256];
 
-	sprintf(buffer, "%lf %lf %lf %i %lf", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state, lastEventTime); 
+	sprintf(buffer, "%lf %lf %lf %i %lf %lf", tapeSpeedInchesPerSecond, desiredTapeSpeed, tapeMotion, state, lastEventTime, tapePosition); 
 	oapiWriteScenario_string(scn, "DATARECORDER", buffer);
 }
 
@@ -25,6 +25,12 @@
 
 #include "RF_calc.h"
 #include "paCBGmessageID.h"
+#include "pcmtransport.h"
+#include "pcmarchive.h"
+#include "pcmframe.h"
+#include "pcmuplink.h"
+
+#include <vector>
 
 /* PCM DOWN-TELEMETRY
 
@@ -179,6 +185,33 @@
 #define TLM_E	4
 #define TLM_SRC 5
 
+///
+/// \brief CSM low bit rate format: 1.6 kbps, 40 words per frame.
+///
+struct CSMLBRFormat {
+	enum { Words = 40, FramesPerSecond = 5, Subframes = 5, FrameAddrCycle = 50, FrameCountCycle = 5, CommutatedWords = 0 };
+
+	static const PCMWordDef Map[Words][Subframes];
+	static const PCMWordDef *const Commutated;
+	static bool Downrupt(int word) { return word == 0 || word == 20; };
+};
+
+///
+/// \brief CSM high bit rate format: 51.2 kbps, 128 words per frame.
+///
+struct CSMHBRFormat {
+	enum { Words = 128, FramesPerSecond = 50, Subframes = 5, FrameAddrCycle = 50, FrameCountCycle = 5, CommutatedWords = 3 };
+
+	static const PCMWordDef Map[Words][Subframes];
+	static const PCMWordDef *const Commutated;
+
+	// The very first pass through the frame gets garbage data because there was no downrupt.
+	// Generating a downrupt at 0 doesn't give the CMC enough time to get data on the busses.
+	static bool Downrupt(int word) { return word == 35; };
+};
+
+class PCMStatusCache;
+
 // DS20060326 Telecommunications system objects
 class Saturn;
 
@@ -188,17 +221,14 @@ class Saturn;
 // Note that Apollo 15 and later used upgraded recorders which ran at half the speed with double the data density.
 //
 
-/// High-bit-rate chunk holds 160 bytes.
-const unsigned int dseChunkSizeHBR = 160;
+/// High-bit-rate chunk holds 640 bytes, 0.1 seconds of 51.2 kbps data at 15 ips.
+const unsigned int dseChunkSizeHBR = 640;
 
-/// Low-bit-rate chunk holds 80 bytes.
+/// Low-bit-rate chunk holds 80 bytes, 0.4 seconds of 1.6 kbps data at 3.75 ips.
 const unsigned int dseChunkSizeLBR = 80;
 
-///
-/// Data storage chunk. Represents 1.5 inches of tape.
-///
-class DSEChunk
-{
+/// Length of tape in a chunk, in inches.
+const double dseChunkLength = 1.5;
 
 enum DSEChunkType
 {
@@ -207,23 +237,29 @@ enum DSEChunkType
 	DSELBR			/// Low bit-rate chunk (1600bps)
 };
 
-public:
-	DSEChunk();
-	virtual ~DSEChunk();
-	void Erase( const DSEChunkType dataType );
-
-private:
-
-	void deleteData();
-
-	DSEChunkType chunkType;			/// What type of chunk is this?
-	unsigned char *chunkData;		/// Pointer to chunk data.
-	unsigned int chunkSize;			/// Size of chunk.
-	unsigned int chunkValidBytes;	/// Number of valid bytes in the chunk.
+///
+/// Data storage chunk. Represents 1.5 inches of tape, the data itself is kept in
+/// the tape buffer of the DSE.
+///
+struct DSEChunk
+{
+	unsigned short chunkType;		/// What type of chunk is this?
+	unsigned short chunkValidBytes;	/// Number of valid bytes in the chunk.
 };
 
 const unsigned int tapeSize = 18000;
 
+///
+/// The tape buffer starts with this header, followed by the chunk table and then
+/// dseChunkSizeHBR bytes of data for each chunk. That's also the layout of a tape file.
+///
+struct DSETapeHeader
+{
+	char magic[8];
+	unsigned int tapeSize;
+	unsigned int chunkSize;
+};
+
 ///
 /// DSE holds 27,000 inches of tape, or 18,000 chunks.
 ///
@@ -271,12 +307,36 @@ public:
 	///
 	void TimeStep( double simt, double simdt );
 
+	///
+	/// The tape speed follows the bit rate of the words.
+	/// \brief Record PCM words. NULL data records blank words.
+	///
+	void RecordWords(const unsigned char *data, int count, bool hbr);
+
+	///
+	/// The file is memory mapped, so the recording survives the session.
+	/// \brief Use a tape file instead of a buffer in memory.
+	///
+	bool OpenTapeFile(const char *fname);
+
 	void LoadState(char *line);
 	void SaveState(FILEHANDLE scn);
 
 protected:
+	bool AllocateTape();
+	void FreeTape();
+	void PlayBack(double from, double to);
+	double PlaySpeed();
+
 	Saturn *sat;					    /// Ship we're installed in
-	DSEChunk tape[tapeSize];			/// Simulated tape.
+	DSETapeHeader *tapeImage;			/// Tape buffer, allocated on first use or mapped from a file.
+	DSEChunk *tape;						/// Simulated tape, the chunk table in the tape buffer.
+	unsigned char *tapeData;			/// Chunk data in the tape buffer.
+	HANDLE tapeFile;					/// Tape file, if any.
+	HANDLE tapeMapping;					/// File mapping of the tape file.
+	double tapePosition;				/// Head position in inches from the start of the tape.
+	int recordChunk;					/// Chunk being recorded, -1 if none.
+	bool recordHBR;						/// Recording at high bit rate.
 	double tapeSpeedInchesPerSecond;	/// Tape speed in inches per second.
 	double desiredTapeSpeed;			/// Desired tape speed in inches per second.
 	double tapeMotion;					/// Tape motion from 0.0 to 1.0.
@@ -350,11 +410,14 @@ public:
 	int conn_state;                 // Connection State
 	int uplink_state;               // Uplink State
 	void perform_io(double simt);   // Get data from here to there
+	void close_connection();        // Drop the telemetry client
 	void handle_uplink();	// Handle incoming data
-	void generate_stream_lbr();     // Generate LBR datastream
-	void generate_stream_hbr();     // Same for HBR datastream
+	void generate_words(int count, bool lbr); // Generate words and queue them for downlink
+	void skip_frames(int count, bool lbr); // Advance the frame counters without generating
 	unsigned char scale_data(double data, double low, double high); // Scale data for PCM transmission
 	unsigned char measure(int channel, int type, int ccode);
+	unsigned char agc_word(int ccode); // 51DS1A-E computer digital data
+	void downrupt();				// Trigger telemetry END PULSE
 
 	// Error control
 	int wsk_error;                  // Winsock error
@@ -366,14 +429,37 @@ public:
 	int word_addr;                  // Word address of outgoing packet
 	int frame_addr;                 // Frame address
 	int frame_count;				// Frame counter
+	int frame_serial;				// Incremented for every downlink frame
 	int tx_size;                    // Number of words to send
-	int tx_offset;                  // Offset to use
 	int rx_offset;					// RX offset to use
-	int mcc_offset;					// RX offset into MCC data block
-	int mcc_size;					// Size of MCC data block
 	unsigned char tx_data[1024];    // Characters to be transmitted
 	unsigned char rx_data[1024];    // Characters recieved
-	unsigned char mcc_data[2048];	// MCC-provided incoming data
+	PCMUplinkQueue uplink;			// Uplink loads queued in-process by MCC and the MFDs
+
+	// Downlink transport
+	PCMTransport downlink;			// Ring buffer and transport thread
+	PCMSocketSink *socketSink;		// Connected telemetry client
+	PCMFileSink *fileSink;			// Raw downlink file
+	bool decimated;					// Only emit whole frames at a reduced rate under time acceleration
+	unsigned long long frames_skipped; // Frames not generated because of decimation or overload
+	bool OpenDownlinkFile(const char *fname);
+	void SetDecimated(bool d) { decimated = d; };
+
+	// Telemetry archive
+	PCMArchiveWriter archive;		// Frames recorded for post-flight analysis
+	double stream_time;				// simt of the next downlink word
+	double word_length;				// Seconds per downlink word at the current bit rate
+	bool OpenArchive(const char *fname);
+
+	// DSE playback
+	PCMTransport dump;				// Tape recorder dump, separate from the realtime downlink
+	PCMFileSink *dumpSink;			// Tape recorder dump file
+	bool OpenDumpFile(const char *fname);
+
+	// Frame formats
+	PCMFrameEngine<CSMLBRFormat, PCM> lbr_engine;
+	PCMFrameEngine<CSMHBRFormat, PCM> hbr_engine;
+	PCMStatusCache *status;			// Vessel status read once per frame
 
 	bool registerSocket(SOCKET sock);
 
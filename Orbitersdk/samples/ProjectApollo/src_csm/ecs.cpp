@@ -930,7 +930,7 @@ void SaturnSideHatch::Timestep(double simdt) {
 	}
 
 	if (sidehatch_state.Process(simdt)) {
-		saturn->SetAnimation(anim_SideHatchVC, sidehatch_state.State());
+		saturn->QueueAnimation(anim_SideHatchVC, sidehatch_state.State());
 	}
 
 	int act_state = 0;
@@ -943,26 +943,26 @@ void SaturnSideHatch::Timestep(double simdt) {
 	}
 
 	if (gearBoxSelector->GetState() == 2) {
-		saturn->SetAnimation(anim_gearboxsel, 1.0);
+		saturn->QueueAnimation(anim_gearboxsel, 1.0);
 
 	} else if (gearBoxSelector->GetState() == 1) {
-		saturn->SetAnimation(anim_gearboxsel, 0.5);
+		saturn->QueueAnimation(anim_gearboxsel, 0.5);
 
 	} else {
-		saturn->SetAnimation(anim_gearboxsel, 0.0);
+		saturn->QueueAnimation(anim_gearboxsel, 0.0);
 	}
 
 	if (act_state == 2) {
-		saturn->SetAnimation(anim_actuatorsel, 1.0);
+		saturn->QueueAnimation(anim_actuatorsel, 1.0);
 
 	} else if (act_state == 1) {
-		saturn->SetAnimation(anim_actuatorsel, 0.5);
+		saturn->QueueAnimation(anim_actuatorsel, 0.5);
 
 	} else {
-		saturn->SetAnimation(anim_actuatorsel, 0.0);
+		saturn->QueueAnimation(anim_actuatorsel, 0.0);
 	}
 
-	saturn->SetAnimation(anim_ventvalve, vent_state / 7);
+	saturn->QueueAnimation(anim_ventvalve, vent_state / 7);
 }
 
 void SaturnSideHatch::SwitchToggled(PanelSwitchItem *s) {
@@ -1018,10 +1018,10 @@ void SaturnSideHatch::DefineAnimationsVC(UINT idx)
 	ach_actuatorsel = saturn->AddAnimationComponent(anim_actuatorsel, 0.0f, 1.0f, &mgt_actuatorsel, ach_SideHatchVC);
 	ach_ventvalve = saturn->AddAnimationComponent(anim_ventvalve, 0.0f, 1.0f, &mgt_ventvalve, ach_SideHatchVC);
 
-	saturn->SetAnimation(anim_SideHatchVC, sidehatch_state.State());
-	saturn->SetAnimation(anim_gearboxsel, 0.5);
-	saturn->SetAnimation(anim_actuatorsel, 0.5);
-	saturn->SetAnimation(anim_ventvalve, 0.5);
+	saturn->ApplyAnimation(anim_SideHatchVC, sidehatch_state.State());
+	saturn->ApplyAnimation(anim_gearboxsel, 0.5);
+	saturn->ApplyAnimation(anim_actuatorsel, 0.5);
+	saturn->ApplyAnimation(anim_ventvalve, 0.5);
 }
 
 SaturnWaterController::SaturnWaterController() {
@@ -1403,7 +1403,7 @@ void SaturnForwardHatch::Toggle()
 				open = true;
 				toggle = 2;
 				OpenSound.play();
-				saturn->SetAnimation(anim_FwdHatchVC, 1.0);
+				saturn->ApplyAnimation(anim_FwdHatchVC, 1.0);
 				saturn->SetFwdHatchMesh();
 				saturn->SetDockingProbeMesh(); // Hide docking probe mesh when CM forward hatch is open
 			}
@@ -1416,7 +1416,7 @@ void SaturnForwardHatch::Toggle()
 			open = false;
 			toggle = 2;
 			CloseSound.play();
-			saturn->SetAnimation(anim_FwdHatchVC, 0.0);
+			saturn->ApplyAnimation(anim_FwdHatchVC, 0.0);
 			saturn->SetFwdHatchMesh();
 			saturn->SetDockingProbeMesh(); // Show docking probe mesh when CM forward hatch is closed
 		}
@@ -1433,7 +1433,7 @@ void SaturnForwardHatch::Timestep(double simdt) {
 	}
 
 	double equalvalve_state = (double)pressureequalvalve->GetState();
-	saturn->SetAnimation(anim_pressequalvlv, equalvalve_state / 3);
+	saturn->QueueAnimation(anim_pressequalvlv, equalvalve_state / 3);
 }
 
 void SaturnForwardHatch::LoadState(char *line) {
@@ -1470,8 +1470,8 @@ void SaturnForwardHatch::DefineAnimationsVC(UINT idx)
 	ach_FwdHatchVC = saturn->AddAnimationComponent(anim_FwdHatchVC, 0.0f, 1.0f, &mgt_fwdhatch);
 	ach_pressequalvlv = saturn->AddAnimationComponent(anim_pressequalvlv, 0.0f, 1.0f, &mgt_pressequalvalve, ach_FwdHatchVC);
 
-	saturn->SetAnimation(anim_FwdHatchVC, open);
-	saturn->SetAnimation(anim_pressequalvlv, 0.5);
+	saturn->ApplyAnimation(anim_FwdHatchVC, open);
+	saturn->ApplyAnimation(anim_pressequalvlv, 0.5);
 }
 
 SaturnPressureEqualizationValve::SaturnPressureEqualizationValve()
@@ -539,10 +539,10 @@ void SaturnSuitPressMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 	double v = GetDisplayValue();
 
 	if (v < 6.0) {
-		OurVessel->SetAnimation(anim_switch, v / 11.0);
+		SetVCAnimation(OurVessel, anim_switch, v / 11.0);
 	}
 	else {
-		OurVessel->SetAnimation(anim_switch, (v / 22.0) + (3.0 / 11.0));
+		SetVCAnimation(OurVessel, anim_switch, (v / 22.0) + (3.0 / 11.0));
 	}
 }
 
@@ -564,10 +564,10 @@ void SaturnCabinPressMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 	double v = GetDisplayValue();
 
 	if (v < 6.0) {
-		OurVessel->SetAnimation(anim_switch, v / 11.0);
+		SetVCAnimation(OurVessel, anim_switch, v / 11.0);
 	}
 	else {
-		OurVessel->SetAnimation(anim_switch, (v / 22.0) + (3.0 / 11.0));
+		SetVCAnimation(OurVessel, anim_switch, (v / 22.0) + (3.0 / 11.0));
 	}
 }
 
@@ -1393,7 +1393,7 @@ void SaturnGPFPIMeter::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	double v = ((GetDisplayValue() - minValue) * 1.04) / (maxValue - minValue);
 
-	Sat->SetAnimation(anim_switch, v);
+	SetVCAnimation(Sat, anim_switch, v);
 }
 
 double SaturnGPFPIPitchMeter::QueryValue()
@@ -1995,19 +1995,19 @@ void SaturnEMSDvSetSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf)
 	if (anim_emsdvsetswitch != -1) {
 		switch ((int)GetPosition()) {
 		case 1:
-			sat->SetAnimation(anim_emsdvsetswitch, 1.0);
+			sat->UpdateAnimation(anim_emsdvsetswitch, 1.0);
 			break;
 		case 2:
-			sat->SetAnimation(anim_emsdvsetswitch, 0.75);
+			sat->UpdateAnimation(anim_emsdvsetswitch, 0.75);
 			break;
 		case 3:
-			sat->SetAnimation(anim_emsdvsetswitch, 0.0);
+			sat->UpdateAnimation(anim_emsdvsetswitch, 0.0);
 			break;
 		case 4:
-			sat->SetAnimation(anim_emsdvsetswitch, 0.25);
+			sat->UpdateAnimation(anim_emsdvsetswitch, 0.25);
 			break;
 		default:
-			sat->SetAnimation(anim_emsdvsetswitch, 0.5);
+			sat->UpdateAnimation(anim_emsdvsetswitch, 0.5);
 			break;
 		}
 	}
@@ -2039,9 +2039,9 @@ void SaturnGuardedCabinPressureReliefLever::DrawSwitchVC(int id, int event, SURF
 	ThumbwheelSwitch::DrawSwitchVC(id, event, surf);
 
 	if (guardState > 0) {
-		OurVessel->SetAnimation(guardAnim, 1.0);
+		UpdateVCAnimation(OurVessel, guardAnim, 1.0);
 	} else {
-		OurVessel->SetAnimation(guardAnim, 0.0);
+		UpdateVCAnimation(OurVessel, guardAnim, 0.0);
 	}
 }
 
@@ -2253,6 +2253,15 @@ bool SuitTestSwitch::CheckMouseClick(int event, int mx, int my)
 	return RotationalSwitch::CheckMouseClick(event, mx + 130, my);
 }
 
+bool SuitTestSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	RotationalSwitch::GetHitRect(x0, y0, x1, y1);
+	x0 -= 130;
+	x1 -= 130;
+	return true;
+}
+
 
 double SaturnOxygenRepressPressMeter::QueryValue()
 {
@@ -2735,7 +2744,7 @@ void SaturnAltimeter::DrawSwitchVC(int id, int event, SURFHANDLE surf) {
 	value = (value * DEG) / 360;
 	if (value < 0) value = 0;
 	if (value > 1) value = 1;
-	Sat->SetAnimation(animNeedle, value);
+	Sat->UpdateAnimation(animNeedle, value);
 	//sprintf(oapiDebugString(), "Alt %lf", Sat->GetAltitude() / 0.3048);
 }
 
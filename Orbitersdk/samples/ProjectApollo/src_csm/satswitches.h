@@ -831,8 +831,10 @@ public:
 
 	void InitGuard(SURFHANDLE surf, SoundLib *soundlib);
 	void DrawSwitch(SURFHANDLE drawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	void DrawSwitchVC(int id, int event, SURFHANDLE surf);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { return false; };
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
 	virtual bool SwitchTo(int newState);
@@ -872,8 +874,10 @@ class SuitTestSwitch: public RotationalSwitch {
 
 public:
 	virtual void DrawSwitch(SURFHANDLE drawSurface);
+	virtual bool GetDrawState(int &drawState) { return false; };
 	virtual void DrawFlash(SURFHANDLE DrawSurface);
 	virtual bool CheckMouseClick(int event, int mx, int my);
+	virtual bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 };
 
 class DSEIndicatorSwitch : public IndicatorSwitch
@@ -917,6 +921,7 @@ public:
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, SECS *s,
 		int xoffset = 0, int yoffset = 0, int lxoffset = 0, int lyoffset = 0);
 	void DoDrawSwitch(SURFHANDLE drawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	void RepaintSwitchVC(SURFHANDLE drawSurface, SURFHANDLE switchsurfacevc);
 protected:
 	SECS * secs;
@@ -44,6 +44,7 @@
 #include "lemcomputer.h"
 #include "LEM.h"
 #include "papi.h"
+#include "panelsurfacecache.h"
 #include "mcc.h"
 #include "mccvessel.h"
 #include "LVDC.h"
@@ -522,6 +523,8 @@ Saturn::Saturn(OBJHANDLE hObj, int fmodel) : ProjectApolloConnectorVessel (hObj,
 	cws.MonitorVessel(this);
 	dockingprobe.RegisterVessel(this);
 
+	PanelSurfaceCache::AddOwner();
+
 	//Initialize the link to the MFD's debug function.
 	debugString = 0;
 	debugConnected = false;
@@ -558,6 +561,12 @@ Saturn::~Saturn()
 {
 	TRACESETUP("~Saturn");
 
+	PanelSurfaceCache::RemoveOwner();
+
+	char buffer[100];
+	sprintf(buffer, "(Saturn) Animation changes per timestep: %.2f average, %d last", MainPanelVC.GetAverageAnimationUpdates(), MainPanelVC.GetAnimationUpdates());
+	oapiWriteLog(buffer);
+
 	if (sivb)
 	{
 		delete sivb;
@@ -1469,6 +1478,8 @@ void Saturn::clbkPostStep (double simt, double simdt, double mjd)
 	{
 		MainPanelVC.OnPostStep(simt, simdt, mjd);
 	}
+	// Pass all animation changes of this timestep to Orbiter
+	MainPanelVC.FlushAnimations();
 
 	sprintf(buffer, "End time(0) %lld", time(0)); 
 	TRACE(buffer);
@@ -2359,6 +2370,35 @@ bool Saturn::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 			sscanf (line+11, "%d", &value);
 			IsMultiThread=(value>0)?true:false;
 		}
+		else if (!strnicmp (line, "PCMDECIMATED", 12)) {
+			int value;
+			sscanf (line+12, "%d", &value);
+			pcm.SetDecimated(value > 0);
+		}
+		else if (!strnicmp (line, "PCMFILE", 7)) {
+			char fname[256];
+			if (sscanf (line+7, "%255s", fname) == 1) {
+				pcm.OpenDownlinkFile(fname);
+			}
+		}
+		else if (!strnicmp (line, "PCMARCHIVE", 10)) {
+			char fname[256];
+			if (sscanf (line+10, "%255s", fname) == 1) {
+				pcm.OpenArchive(fname);
+			}
+		}
+		else if (!strnicmp (line, "DSEDUMPFILE", 11)) {
+			char fname[256];
+			if (sscanf (line+11, "%255s", fname) == 1) {
+				pcm.OpenDumpFile(fname);
+			}
+		}
+		else if (!strnicmp (line, "DSEFILE", 7)) {
+			char fname[256];
+			if (sscanf (line+7, "%255s", fname) == 1) {
+				dataRecorder.OpenTapeFile(fname);
+			}
+		}
 		else if (!strnicmp(line, "NOMANUALTLI", 11)) {
 			//
 			// NOMANUALTLI isn't saved in the scenario, this is solely to allow you
@@ -996,6 +996,21 @@ public:
 	/// \param mjd Current MJD.
 	///
 	void clbkPreStep(double simt, double simdt, double mjd);
+
+	///
+	/// \brief Queue an animation change of the timestep, see PanelSwitchesVC::QueueAnimation.
+	///
+	void QueueAnimation(UINT anim, double state) { MainPanelVC.QueueAnimation(this, anim, state); };
+
+	///
+	/// \brief Set an animation state outside of the timestep, see PanelSwitchesVC::ApplyAnimation.
+	///
+	void ApplyAnimation(UINT anim, double state) { MainPanelVC.ApplyAnimation(this, anim, state); };
+
+	///
+	/// \brief Set an animation state from a VC redraw event, see PanelSwitchesVC::UpdateAnimation.
+	///
+	void UpdateAnimation(UINT anim, double state) { MainPanelVC.UpdateAnimation(this, anim, state); };
 	bool clbkLoadPanel (int id);
 	int clbkConsumeDirectKey(char *keystate);
 	int clbkConsumeBufferedKey(DWORD key, bool down, char *kstate);
@@ -1371,6 +1386,11 @@ public:
 	virtual SICSystems *GetSIC() { return NULL; }
 	SECS *GetSECS() { return &secs; }
 
+	///
+	/// \brief Thread-safe in-process uplink to the CMC, used by MCC and the MFDs.
+	///
+	PCMUplinkQueue *GetUplinkQueue() { return &pcm.uplink; };
+
 	void ClearMeshes();
 
 protected:
@@ -33,11 +33,13 @@
 #include "resource.h"
 
 #define LOADBMP(id) (LoadBitmap (g_Param.hDLL, MAKEINTRESOURCE (id)))
+#define LOADSRF(id) (PanelSurfaceCache::LoadBitmapSurface (g_Param.hDLL, id))
 
 #include "nasspdefs.h"
 #include "nasspsound.h"
 
 #include "toggleswitch.h"
+#include "panelsurfacecache.h"
 #include "apolloguidance.h"
 #include "dsky.h"
 #include "csmcomputer.h"
@@ -277,7 +279,7 @@ void Saturn::ReleaseSurfaces ()
 {
 	for (int i = 0; i < nsurf; i++) {
 		if (srf[i]) {
-			oapiDestroySurface (srf[i]);
+			PanelSurfaceCache::ReleaseSurface (srf[i]);
 			srf[i] = 0;
 		}
 	}
@@ -297,205 +299,205 @@ void Saturn::InitPanel (int panel)
 	// bloat the DLL.
 	//
 
-	srf[SRF_INDICATOR]								= oapiCreateSurface (LOADBMP (IDB_INDICATOR));
-	srf[SRF_NEEDLE]									= oapiCreateSurface (LOADBMP (IDB_NEEDLE));
-	srf[SRF_DIGITAL]								= oapiCreateSurface (LOADBMP (IDB_DIGITAL));
-	srf[SRF_DIGITAL2]								= oapiCreateSurface (LOADBMP (IDB_DIGITAL2));
-	srf[SRF_SWITCHUP]								= oapiCreateSurface (LOADBMP (IDB_SWITCHUP));
-	srf[SRF_SWITCHLEVER]							= oapiCreateSurface (LOADBMP (IDB_SWLEVER));
-	srf[SRF_SWITCHGUARDS]							= oapiCreateSurface (LOADBMP (IDB_SWITCHGUARDS));
-	srf[SRF_SWITCHGUARDPANEL15]						= oapiCreateSurface (LOADBMP (IDB_SWITCHGUARDPANEL15));
-	srf[SRF_ABORT]									= oapiCreateSurface (LOADBMP (IDB_ABORT));
-	srf[SRF_LV_ENG]									= oapiCreateSurface (LOADBMP (IDB_LV_ENG));
-	srf[SRF_ALTIMETER]								= oapiCreateSurface (LOADBMP (IDB_ALTIMETER));
-	srf[SRF_THRUSTMETER]							= oapiCreateSurface (LOADBMP (IDB_THRUST));
-	srf[SRF_DCVOLTS]								= oapiCreateSurface (LOADBMP (IDB_DCVOLTS));
-	srf[SRF_DCVOLTS_PANEL101]						= oapiCreateSurface (LOADBMP (IDB_DCVOLTS_PANEL101));
-	srf[SRF_DCAMPS]									= oapiCreateSurface (LOADBMP (IDB_DCAMPS));
-	srf[SRF_ACVOLTS]								= oapiCreateSurface (LOADBMP (IDB_ACVOLTS));
-	srf[SRF_SEQUENCERSWITCHES]						= oapiCreateSurface (LOADBMP (IDB_SEQUENCERSWITCHES));
-	srf[SRF_MASTERALARM_BRIGHT]						= oapiCreateSurface (LOADBMP (IDB_MASTER_ALARM_BRIGHT));
-	srf[SRF_DSKY]									= oapiCreateSurface (LOADBMP (IDB_DSKY_LIGHTS));
-	srf[SRF_THREEPOSSWITCH]							= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH));
-	srf[SRF_MFDFRAME]								= oapiCreateSurface (LOADBMP (IDB_MFDFRAME));
-	srf[SRF_MFDPOWER]								= oapiCreateSurface (LOADBMP (IDB_MFDPOWER));
-	srf[SRF_SM_RCS_MODE]							= oapiCreateSurface (LOADBMP (IDB_DOCKINGSWITCHES));
-	srf[SRF_ROTATIONALSWITCH]						= oapiCreateSurface (LOADBMP (IDB_ROTATIONALSWITCH));
-	srf[SRF_SUITCABINDELTAPMETER]					= oapiCreateSurface (LOADBMP (IDB_SUITCABINDELTAPMETER));
-	srf[SRF_THREEPOSSWITCH305]						= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH305));
-	srf[SRF_THREEPOSSWITCH305LEFT]					= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH305LEFT));
-	srf[SRF_SWITCH305LEFT]							= oapiCreateSurface (LOADBMP (IDB_SWITCH305LEFT));
-	srf[SRF_DSKYDISP]       						= oapiCreateSurface (LOADBMP (IDB_DSKY_DISP));
-	srf[SRF_FDAI]	        						= oapiCreateSurface (LOADBMP (IDB_FDAI));
-	srf[SRF_FDAIROLL]       						= oapiCreateSurface (LOADBMP (IDB_FDAI_ROLL));
-	srf[SRF_CWSLIGHTS]       						= oapiCreateSurface (LOADBMP (IDB_CWS_LIGHTS));
-	srf[SRF_EVENT_TIMER_DIGITS]    					= oapiCreateSurface (LOADBMP (IDB_EVENT_TIMER));
-	srf[SRF_DSKYKEY]		    					= oapiCreateSurface (LOADBMP (IDB_DSKY_KEY));
-	srf[SRF_ECSINDICATOR]							= oapiCreateSurface (LOADBMP (IDB_ECSINDICATOR));
-	srf[SRF_SWITCHUPSMALL]							= oapiCreateSurface (LOADBMP (IDB_SWITCHUPSMALL));
-	srf[SRF_CMMFDFRAME]								= oapiCreateSurface (LOADBMP (IDB_CMMFDFRAME));
-	srf[SRF_COAS]									= oapiCreateSurface (LOADBMP (IDB_COAS));
-	srf[SRF_THUMBWHEEL_SMALLFONTS]					= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_SMALLFONTS));
-	srf[SRF_THUMBWHEEL_SMALLFONTS_DIAGONAL]			= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_SMALLFONTS_DIAGONAL));
-	srf[SRF_THUMBWHEEL_SMALLFONTS_DIAGONAL_LEFT]	= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_SMALLFONTS_DIAGONAL_LEFT));
-	srf[SRF_CIRCUITBRAKER]          				= oapiCreateSurface (LOADBMP (IDB_CIRCUITBRAKER));
-	srf[SRF_CIRCUITBRAKER_YELLOW]          			= oapiCreateSurface (LOADBMP (IDB_CIRCUITBRAKER_YELLOW));
-	srf[SRF_THREEPOSSWITCH20]						= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH20));
-	srf[SRF_THREEPOSSWITCH30]						= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH30));
-	srf[SRF_THREEPOSSWITCH30LEFT]					= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH30LEFT));
-	srf[SRF_SWITCH20]								= oapiCreateSurface (LOADBMP (IDB_SWITCH20));
-	srf[SRF_SWITCH30]								= oapiCreateSurface (LOADBMP (IDB_SWITCH30));
-	srf[SRF_SWITCH30LEFT]							= oapiCreateSurface (LOADBMP (IDB_SWITCH30LEFT));
-	srf[SRF_SWITCH20LEFT]							= oapiCreateSurface (LOADBMP (IDB_SWITCH20LEFT));
-	srf[SRF_THREEPOSSWITCH20LEFT]					= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH20LEFT));
-	srf[SRF_GUARDEDSWITCH20]						= oapiCreateSurface (LOADBMP (IDB_GUARDEDSWITCH20));
-	srf[SRF_FDAIPOWERROTARY]						= oapiCreateSurface (LOADBMP (IDB_FDAIPOWERROTARY));
-	srf[SRF_DIRECTO2ROTARY]							= oapiCreateSurface (LOADBMP (IDB_DIRECTO2ROTARY));
-	srf[SRF_ECSGLYCOLPUMPROTARY]					= oapiCreateSurface (LOADBMP (IDB_ECSGLYCOLPUMPROTARY));
-	srf[SRF_GTACOVER]								= oapiCreateSurface (LOADBMP (IDB_GTACOVER));
-	srf[SRF_POSTLDGVENTVLVLEVER]					= oapiCreateSurface (LOADBMP (IDB_POSTLDGVENTVLVLEVER));
-	srf[SRF_SPSMAXINDICATOR]						= oapiCreateSurface (LOADBMP (IDB_SPSMAXINDICATOR));
-	srf[SRF_SPSMININDICATOR]						= oapiCreateSurface (LOADBMP (IDB_SPSMININDICATOR));
-	srf[SRF_ECSROTARY]								= oapiCreateSurface (LOADBMP (IDB_ECSROTARY));
-	srf[SRF_CSM_MNPNL_WDW_LES]						= oapiCreateSurface (LOADBMP (IDB_CSM_MNPNL_WDW_LES));
-	srf[SRF_CSM_RNDZ_WDW_LES]						= oapiCreateSurface (LOADBMP (IDB_CSM_RNDZ_WDW_LES));
-	srf[SRF_CSM_RIGHT_WDW_LES]						= oapiCreateSurface (LOADBMP (IDB_CSM_RIGHT_WDW_LES));
-	srf[SRF_CSM_LEFT_WDW_LES]						= oapiCreateSurface (LOADBMP (IDB_CSM_LEFT_WDW_LES));
-	srf[SRF_GLYCOLLEVER]							= oapiCreateSurface (LOADBMP (IDB_GLYCOLLEVER));
-	srf[SRF_FDAIOFFFLAG]       						= oapiCreateSurface (LOADBMP (IDB_FDAIOFFFLAG));
-	srf[SRF_FDAINEEDLES]							= oapiCreateSurface (LOADBMP (IDB_FDAINEEDLES));
-	srf[SRF_THUMBWHEEL_LARGEFONTS]					= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_LARGEFONTS));
-	srf[SRF_SPS_FONT_WHITE]							= oapiCreateSurface (LOADBMP (IDB_SPS_FUEL_FONT_WHITE));
-	srf[SRF_SPS_FONT_BLACK]							= oapiCreateSurface (LOADBMP (IDB_SPS_FUEL_FONT_BLACK));
-	srf[SRF_THUMBWHEEL_SMALL]						= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_SMALL));
-	srf[SRF_THUMBWHEEL_LARGEFONTSINV] 				= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_LARGEFONTSINV));
-	srf[SRF_SWLEVERTHREEPOS] 						= oapiCreateSurface (LOADBMP (IDB_SWLEVERTHREEPOS));
-	srf[SRF_ORDEAL_ROTARY] 							= oapiCreateSurface (LOADBMP (IDB_ORDEAL_ROTARY));
-	srf[SRF_LV_ENG_S1B]								= oapiCreateSurface (LOADBMP (IDB_LV_ENGINE_LIGHTS_S1B));
-	srf[SRF_SPS_INJ_VLV]						    = oapiCreateSurface (LOADBMP (IDB_SPS_INJ_VLV));
-	srf[SRF_THUMBWHEEL_GPI_PITCH]  					= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_GPI_PITCH));
-	srf[SRF_THUMBWHEEL_GPI_YAW]  					= oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_GPI_YAW));
-	srf[SRF_THC]				  					= oapiCreateSurface (LOADBMP (IDB_THC));
-	srf[SRF_EMS_LIGHTS]			  					= oapiCreateSurface (LOADBMP (IDB_EMS_LIGHTS));
-	srf[SRF_SUITRETURN_LEVER]	 					= oapiCreateSurface (LOADBMP (IDB_SUITRETURN_LEVER));
-	srf[SRF_CABINRELIEFUPPERLEVER]	 				= oapiCreateSurface (LOADBMP (IDB_CABINRELIEFUPPERLEVER));
-	srf[SRF_CABINRELIEFLOWERLEVER]	 				= oapiCreateSurface (LOADBMP (IDB_CABINRELIEFLOWERLEVER));
-	srf[SRF_CABINRELIEFGUARDLEVER]	 				= oapiCreateSurface (LOADBMP (IDB_CABINRELIEFGUARDLEVER));
-	srf[SRF_OPTICS_HANDCONTROLLER]	 				= oapiCreateSurface (LOADBMP (IDB_OPTICS_HANDCONTROLLER));
-	srf[SRF_MARK_BUTTONS]	 						= oapiCreateSurface (LOADBMP (IDB_MARK_BUTTONS));
-	srf[SRF_THREEPOSSWITCHSMALL]	 				= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCHSMALL));
-	srf[SRF_OPTICS_DSKY]	 						= oapiCreateSurface (LOADBMP (IDB_OPTICS_DSKY));
-	srf[SRF_MINIMPULSE_HANDCONTROLLER] 				= oapiCreateSurface (LOADBMP (IDB_MINIMPULSE_HANDCONTROLLER));
+	srf[SRF_INDICATOR]								= LOADSRF (IDB_INDICATOR);
+	srf[SRF_NEEDLE]									= LOADSRF (IDB_NEEDLE);
+	srf[SRF_DIGITAL]								= LOADSRF (IDB_DIGITAL);
+	srf[SRF_DIGITAL2]								= LOADSRF (IDB_DIGITAL2);
+	srf[SRF_SWITCHUP]								= LOADSRF (IDB_SWITCHUP);
+	srf[SRF_SWITCHLEVER]							= LOADSRF (IDB_SWLEVER);
+	srf[SRF_SWITCHGUARDS]							= LOADSRF (IDB_SWITCHGUARDS);
+	srf[SRF_SWITCHGUARDPANEL15]						= LOADSRF (IDB_SWITCHGUARDPANEL15);
+	srf[SRF_ABORT]									= LOADSRF (IDB_ABORT);
+	srf[SRF_LV_ENG]									= LOADSRF (IDB_LV_ENG);
+	srf[SRF_ALTIMETER]								= LOADSRF (IDB_ALTIMETER);
+	srf[SRF_THRUSTMETER]							= LOADSRF (IDB_THRUST);
+	srf[SRF_DCVOLTS]								= LOADSRF (IDB_DCVOLTS);
+	srf[SRF_DCVOLTS_PANEL101]						= LOADSRF (IDB_DCVOLTS_PANEL101);
+	srf[SRF_DCAMPS]									= LOADSRF (IDB_DCAMPS);
+	srf[SRF_ACVOLTS]								= LOADSRF (IDB_ACVOLTS);
+	srf[SRF_SEQUENCERSWITCHES]						= LOADSRF (IDB_SEQUENCERSWITCHES);
+	srf[SRF_MASTERALARM_BRIGHT]						= LOADSRF (IDB_MASTER_ALARM_BRIGHT);
+	srf[SRF_DSKY]									= LOADSRF (IDB_DSKY_LIGHTS);
+	srf[SRF_THREEPOSSWITCH]							= LOADSRF (IDB_THREEPOSSWITCH);
+	srf[SRF_MFDFRAME]								= LOADSRF (IDB_MFDFRAME);
+	srf[SRF_MFDPOWER]								= LOADSRF (IDB_MFDPOWER);
+	srf[SRF_SM_RCS_MODE]							= LOADSRF (IDB_DOCKINGSWITCHES);
+	srf[SRF_ROTATIONALSWITCH]						= LOADSRF (IDB_ROTATIONALSWITCH);
+	srf[SRF_SUITCABINDELTAPMETER]					= LOADSRF (IDB_SUITCABINDELTAPMETER);
+	srf[SRF_THREEPOSSWITCH305]						= LOADSRF (IDB_THREEPOSSWITCH305);
+	srf[SRF_THREEPOSSWITCH305LEFT]					= LOADSRF (IDB_THREEPOSSWITCH305LEFT);
+	srf[SRF_SWITCH305LEFT]							= LOADSRF (IDB_SWITCH305LEFT);
+	srf[SRF_DSKYDISP]       						= LOADSRF (IDB_DSKY_DISP);
+	srf[SRF_FDAI]	        						= LOADSRF (IDB_FDAI);
+	srf[SRF_FDAIROLL]       						= LOADSRF (IDB_FDAI_ROLL);
+	srf[SRF_CWSLIGHTS]       						= LOADSRF (IDB_CWS_LIGHTS);
+	srf[SRF_EVENT_TIMER_DIGITS]    					= LOADSRF (IDB_EVENT_TIMER);
+	srf[SRF_DSKYKEY]		    					= LOADSRF (IDB_DSKY_KEY);
+	srf[SRF_ECSINDICATOR]							= LOADSRF (IDB_ECSINDICATOR);
+	srf[SRF_SWITCHUPSMALL]							= LOADSRF (IDB_SWITCHUPSMALL);
+	srf[SRF_CMMFDFRAME]								= LOADSRF (IDB_CMMFDFRAME);
+	srf[SRF_COAS]									= LOADSRF (IDB_COAS);
+	srf[SRF_THUMBWHEEL_SMALLFONTS]					= LOADSRF (IDB_THUMBWHEEL_SMALLFONTS);
+	srf[SRF_THUMBWHEEL_SMALLFONTS_DIAGONAL]			= LOADSRF (IDB_THUMBWHEEL_SMALLFONTS_DIAGONAL);
+	srf[SRF_THUMBWHEEL_SMALLFONTS_DIAGONAL_LEFT]	= LOADSRF (IDB_THUMBWHEEL_SMALLFONTS_DIAGONAL_LEFT);
+	srf[SRF_CIRCUITBRAKER]          				= LOADSRF (IDB_CIRCUITBRAKER);
+	srf[SRF_CIRCUITBRAKER_YELLOW]          			= LOADSRF (IDB_CIRCUITBRAKER_YELLOW);
+	srf[SRF_THREEPOSSWITCH20]						= LOADSRF (IDB_THREEPOSSWITCH20);
+	srf[SRF_THREEPOSSWITCH30]						= LOADSRF (IDB_THREEPOSSWITCH30);
+	srf[SRF_THREEPOSSWITCH30LEFT]					= LOADSRF (IDB_THREEPOSSWITCH30LEFT);
+	srf[SRF_SWITCH20]								= LOADSRF (IDB_SWITCH20);
+	srf[SRF_SWITCH30]								= LOADSRF (IDB_SWITCH30);
+	srf[SRF_SWITCH30LEFT]							= LOADSRF (IDB_SWITCH30LEFT);
+	srf[SRF_SWITCH20LEFT]							= LOADSRF (IDB_SWITCH20LEFT);
+	srf[SRF_THREEPOSSWITCH20LEFT]					= LOADSRF (IDB_THREEPOSSWITCH20LEFT);
+	srf[SRF_GUARDEDSWITCH20]						= LOADSRF (IDB_GUARDEDSWITCH20);
+	srf[SRF_FDAIPOWERROTARY]						= LOADSRF (IDB_FDAIPOWERROTARY);
+	srf[SRF_DIRECTO2ROTARY]							= LOADSRF (IDB_DIRECTO2ROTARY);
+	srf[SRF_ECSGLYCOLPUMPROTARY]					= LOADSRF (IDB_ECSGLYCOLPUMPROTARY);
+	srf[SRF_GTACOVER]								= LOADSRF (IDB_GTACOVER);
+	srf[SRF_POSTLDGVENTVLVLEVER]					= LOADSRF (IDB_POSTLDGVENTVLVLEVER);
+	srf[SRF_SPSMAXINDICATOR]						= LOADSRF (IDB_SPSMAXINDICATOR);
+	srf[SRF_SPSMININDICATOR]						= LOADSRF (IDB_SPSMININDICATOR);
+	srf[SRF_ECSROTARY]								= LOADSRF (IDB_ECSROTARY);
+	srf[SRF_CSM_MNPNL_WDW_LES]						= LOADSRF (IDB_CSM_MNPNL_WDW_LES);
+	srf[SRF_CSM_RNDZ_WDW_LES]						= LOADSRF (IDB_CSM_RNDZ_WDW_LES);
+	srf[SRF_CSM_RIGHT_WDW_LES]						= LOADSRF (IDB_CSM_RIGHT_WDW_LES);
+	srf[SRF_CSM_LEFT_WDW_LES]						= LOADSRF (IDB_CSM_LEFT_WDW_LES);
+	srf[SRF_GLYCOLLEVER]							= LOADSRF (IDB_GLYCOLLEVER);
+	srf[SRF_FDAIOFFFLAG]       						= LOADSRF (IDB_FDAIOFFFLAG);
+	srf[SRF_FDAINEEDLES]							= LOADSRF (IDB_FDAINEEDLES);
+	srf[SRF_THUMBWHEEL_LARGEFONTS]					= LOADSRF (IDB_THUMBWHEEL_LARGEFONTS);
+	srf[SRF_SPS_FONT_WHITE]							= LOADSRF (IDB_SPS_FUEL_FONT_WHITE);
+	srf[SRF_SPS_FONT_BLACK]							= LOADSRF (IDB_SPS_FUEL_FONT_BLACK);
+	srf[SRF_THUMBWHEEL_SMALL]						= LOADSRF (IDB_THUMBWHEEL_SMALL);
+	srf[SRF_THUMBWHEEL_LARGEFONTSINV] 				= LOADSRF (IDB_THUMBWHEEL_LARGEFONTSINV);
+	srf[SRF_SWLEVERTHREEPOS] 						= LOADSRF (IDB_SWLEVERTHREEPOS);
+	srf[SRF_ORDEAL_ROTARY] 							= LOADSRF (IDB_ORDEAL_ROTARY);
+	srf[SRF_LV_ENG_S1B]								= LOADSRF (IDB_LV_ENGINE_LIGHTS_S1B);
+	srf[SRF_SPS_INJ_VLV]						    = LOADSRF (IDB_SPS_INJ_VLV);
+	srf[SRF_THUMBWHEEL_GPI_PITCH]  					= LOADSRF (IDB_THUMBWHEEL_GPI_PITCH);
+	srf[SRF_THUMBWHEEL_GPI_YAW]  					= LOADSRF (IDB_THUMBWHEEL_GPI_YAW);
+	srf[SRF_THC]				  					= LOADSRF (IDB_THC);
+	srf[SRF_EMS_LIGHTS]			  					= LOADSRF (IDB_EMS_LIGHTS);
+	srf[SRF_SUITRETURN_LEVER]	 					= LOADSRF (IDB_SUITRETURN_LEVER);
+	srf[SRF_CABINRELIEFUPPERLEVER]	 				= LOADSRF (IDB_CABINRELIEFUPPERLEVER);
+	srf[SRF_CABINRELIEFLOWERLEVER]	 				= LOADSRF (IDB_CABINRELIEFLOWERLEVER);
+	srf[SRF_CABINRELIEFGUARDLEVER]	 				= LOADSRF (IDB_CABINRELIEFGUARDLEVER);
+	srf[SRF_OPTICS_HANDCONTROLLER]	 				= LOADSRF (IDB_OPTICS_HANDCONTROLLER);
+	srf[SRF_MARK_BUTTONS]	 						= LOADSRF (IDB_MARK_BUTTONS);
+	srf[SRF_THREEPOSSWITCHSMALL]	 				= LOADSRF (IDB_THREEPOSSWITCHSMALL);
+	srf[SRF_OPTICS_DSKY]	 						= LOADSRF (IDB_OPTICS_DSKY);
+	srf[SRF_MINIMPULSE_HANDCONTROLLER] 				= LOADSRF (IDB_MINIMPULSE_HANDCONTROLLER);
 	srf[SRF_EMS_SCROLL_LEO]							= oapiCreateSurface (LOADBMP (IDB_EMS_SCROLL_LEO));
-	srf[SRF_EMS_SCROLL_BORDER]						= oapiCreateSurface (LOADBMP (IDB_EMS_SCROLL_BORDER));
+	srf[SRF_EMS_SCROLL_BORDER]						= LOADSRF (IDB_EMS_SCROLL_BORDER);
 	srf[SRF_EMS_RSI_BKGRND]                         = oapiCreateSurface (LOADBMP (IDB_EMS_RSI_BKGRND));
-	srf[SRF_EMSDVSETSWITCH]							= oapiCreateSurface (LOADBMP (IDB_EMSDVSETSWITCH));
-	srf[SRF_ALTIMETER2]								= oapiCreateSurface (LOADBMP (IDB_ALTIMETER2));
-	srf[SRF_OXYGEN_SURGE_TANK_VALVE]				= oapiCreateSurface (LOADBMP (IDB_OXYGEN_SURGE_TANK_VALVE));
-	srf[SRF_GLYCOL_TO_RADIATORS_KNOB]				= oapiCreateSurface (LOADBMP (IDB_GLYCOL_TO_RADIATORS_KNOB));
-	srf[SRF_ACCUM_ROTARY]							= oapiCreateSurface (LOADBMP (IDB_ACCUM_ROTARY));
-	srf[SRF_GLYCOL_ROTARY]							= oapiCreateSurface (LOADBMP (IDB_GLYCOL_ROTARY));
-	srf[SRF_PRESS_RELIEF_VALVE]						= oapiCreateSurface (LOADBMP (IDB_PRESS_RELIEF_VALVE));
-	srf[SRF_CABIN_REPRESS_VALVE]					= oapiCreateSurface (LOADBMP (IDB_CABIN_REPRESS_VALVE));
-	srf[SRF_SELECTOR_INLET_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_SELECTOR_INLET_ROTARY));							
-	srf[SRF_SELECTOR_OUTLET_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_SELECTOR_OUTLET_ROTARY));
-	srf[SRF_EMERGENCY_PRESS_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_EMERGENCY_PRESS_ROTARY));
-	srf[SRF_SUIT_FLOW_CONTROL_LEVER]				= oapiCreateSurface (LOADBMP (IDB_CSM_SUIT_FLOW_CONTROL_LEVER));
-	srf[SRF_CSM_SEC_CABIN_TEMP_VALVE]				= oapiCreateSurface (LOADBMP (IDB_CSM_SEC_CABIN_TEMP_VALVE));
-	srf[SRF_CSM_FOOT_PREP_WATER_LEVER]				= oapiCreateSurface (LOADBMP (IDB_CSM_FOOT_PREP_WATER_LEVER));
-	srf[SRF_CSM_LM_TUNNEL_VENT_VALVE]				= oapiCreateSurface (LOADBMP (IDB_CSM_LM_TUNNEL_VENT_VALVE));
-	srf[SRF_CSM_WASTE_MGMT_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_CSM_WASTE_MGMT_ROTARY));
-	srf[SRF_CSM_DEMAND_REG_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_CSM_DEMAND_REG_ROTARY));
-	srf[SRF_CSM_SUIT_TEST_LEVER]					= oapiCreateSurface (LOADBMP (IDB_CSM_SUIT_TEST_LEVER));
-	srf[SRF_CSM_GEAR_BOX_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_CSM_GEAR_BOX_ROTARY));
-	srf[SRF_CSM_PUMP_HANDLE_ROTARY]					= oapiCreateSurface (LOADBMP (IDB_CSM_PUMP_HANDLE_ROTARY));
-	srf[SRF_CSM_VENT_VALVE_HANDLE]					= oapiCreateSurface (LOADBMP (IDB_CSM_VENT_VALVE_HANDLE));
-	srf[SRF_CSM_PUMP_HANDLE_ROTARY_OPEN]			= oapiCreateSurface (LOADBMP (IDB_CSM_PUMP_HANDLE_ROTARY_OPEN));
-	srf[SRF_CSM_PANEL_351_SWITCH]					= oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_351_SWITCH));
-	srf[SRF_CSM_PANEL_600]							= oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_600));
-	srf[SRF_CSM_PANEL_600_SWITCH]					= oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_600_SWITCH));
-	srf[SRF_CSM_PANEL_382_COVER]					= oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_382_COVER));
-	srf[SRF_CSM_WASTE_DISPOSAL_ROTARY]				= oapiCreateSurface (LOADBMP (IDB_CSM_WASTE_DISPOSAL_ROTARY));
-	srf[SRF_THREEPOSSWITCH90_LEFT]					= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH90_LEFT));
-	srf[SRF_EMS_SCROLL_BUG]							= oapiCreateSurface (LOADBMP (IDB_EMS_SCROLL_BUG));
-	srf[SRF_SWITCH90]								= oapiCreateSurface (LOADBMP (IDB_SWITCH90));
-	srf[SRF_CSM_CABINPRESSTESTSWITCH]				= oapiCreateSurface (LOADBMP (IDB_CSM_CABINPRESSTESTSWITCH));
-	srf[SRF_ORDEAL_PANEL]							= oapiCreateSurface (LOADBMP (IDB_ORDEAL_PANEL));
-	srf[SRF_CSM_TELESCOPECOVER]						= oapiCreateSurface (LOADBMP (IDB_CSM_TELESCOPECOVER));	
-	srf[SRF_CSM_SEXTANTCOVER]						= oapiCreateSurface (LOADBMP (IDB_CSM_SEXTANTCOVER));
-	srf[SRF_CWS_GNLIGHTS]      						= oapiCreateSurface (LOADBMP (IDB_CWS_GNLIGHTS));
-	srf[SRF_EVENT_TIMER_DIGITS90]					= oapiCreateSurface (LOADBMP (IDB_EVENT_TIMER90));
-	srf[SRF_DIGITAL90]								= oapiCreateSurface (LOADBMP (IDB_DIGITAL90));
-	srf[SRF_CSM_PRESS_EQUAL_HANDLE]                 = oapiCreateSurface (LOADBMP (IDB_CSM_PRESS_EQUAL_HANDLE));
-	srf[SRF_CSM_PANEL_181]                          = oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_181));
-	srf[SRF_CSM_PANEL_277]                          = oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_277));
-	srf[SRF_CSM_PANEL_278_CSM112]                   = oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_278_CSM112));
-	srf[SRF_CSM_PANEL_278_CSM114]                   = oapiCreateSurface (LOADBMP (IDB_CSM_PANEL_278_CSM114));
-	srf[SRF_INDICATOR90]                            = oapiCreateSurface (LOADBMP (IDB_INDICATOR90));
-	srf[SRF_THREEPOSSWITCH90_RIGHT]					= oapiCreateSurface (LOADBMP (IDB_THREEPOSSWITCH90_RIGHT));
-	srf[SRF_CRYO_SWITCHES_J]                        = oapiCreateSurface (LOADBMP (IDB_CRYO_SWITCHES_J));
-	srf[SRF_CRYO_IND_J]                             = oapiCreateSurface (LOADBMP (IDB_CRYO_IND_J));
-	srf[SRF_SWITCHGUARDS90_RIGHT]                   = oapiCreateSurface (LOADBMP (IDB_SWITCHGUARDS90_RIGHT));
+	srf[SRF_EMSDVSETSWITCH]							= LOADSRF (IDB_EMSDVSETSWITCH);
+	srf[SRF_ALTIMETER2]								= LOADSRF (IDB_ALTIMETER2);
+	srf[SRF_OXYGEN_SURGE_TANK_VALVE]				= LOADSRF (IDB_OXYGEN_SURGE_TANK_VALVE);
+	srf[SRF_GLYCOL_TO_RADIATORS_KNOB]				= LOADSRF (IDB_GLYCOL_TO_RADIATORS_KNOB);
+	srf[SRF_ACCUM_ROTARY]							= LOADSRF (IDB_ACCUM_ROTARY);
+	srf[SRF_GLYCOL_ROTARY]							= LOADSRF (IDB_GLYCOL_ROTARY);
+	srf[SRF_PRESS_RELIEF_VALVE]						= LOADSRF (IDB_PRESS_RELIEF_VALVE);
+	srf[SRF_CABIN_REPRESS_VALVE]					= LOADSRF (IDB_CABIN_REPRESS_VALVE);
+	srf[SRF_SELECTOR_INLET_ROTARY]					= LOADSRF (IDB_SELECTOR_INLET_ROTARY);							
+	srf[SRF_SELECTOR_OUTLET_ROTARY]					= LOADSRF (IDB_SELECTOR_OUTLET_ROTARY);
+	srf[SRF_EMERGENCY_PRESS_ROTARY]					= LOADSRF (IDB_EMERGENCY_PRESS_ROTARY);
+	srf[SRF_SUIT_FLOW_CONTROL_LEVER]				= LOADSRF (IDB_CSM_SUIT_FLOW_CONTROL_LEVER);
+	srf[SRF_CSM_SEC_CABIN_TEMP_VALVE]				= LOADSRF (IDB_CSM_SEC_CABIN_TEMP_VALVE);
+	srf[SRF_CSM_FOOT_PREP_WATER_LEVER]				= LOADSRF (IDB_CSM_FOOT_PREP_WATER_LEVER);
+	srf[SRF_CSM_LM_TUNNEL_VENT_VALVE]				= LOADSRF (IDB_CSM_LM_TUNNEL_VENT_VALVE);
+	srf[SRF_CSM_WASTE_MGMT_ROTARY]					= LOADSRF (IDB_CSM_WASTE_MGMT_ROTARY);
+	srf[SRF_CSM_DEMAND_REG_ROTARY]					= LOADSRF (IDB_CSM_DEMAND_REG_ROTARY);
+	srf[SRF_CSM_SUIT_TEST_LEVER]					= LOADSRF (IDB_CSM_SUIT_TEST_LEVER);
+	srf[SRF_CSM_GEAR_BOX_ROTARY]					= LOADSRF (IDB_CSM_GEAR_BOX_ROTARY);
+	srf[SRF_CSM_PUMP_HANDLE_ROTARY]					= LOADSRF (IDB_CSM_PUMP_HANDLE_ROTARY);
+	srf[SRF_CSM_VENT_VALVE_HANDLE]					= LOADSRF (IDB_CSM_VENT_VALVE_HANDLE);
+	srf[SRF_CSM_PUMP_HANDLE_ROTARY_OPEN]			= LOADSRF (IDB_CSM_PUMP_HANDLE_ROTARY_OPEN);
+	srf[SRF_CSM_PANEL_351_SWITCH]					= LOADSRF (IDB_CSM_PANEL_351_SWITCH);
+	srf[SRF_CSM_PANEL_600]							= LOADSRF (IDB_CSM_PANEL_600);
+	srf[SRF_CSM_PANEL_600_SWITCH]					= LOADSRF (IDB_CSM_PANEL_600_SWITCH);
+	srf[SRF_CSM_PANEL_382_COVER]					= LOADSRF (IDB_CSM_PANEL_382_COVER);
+	srf[SRF_CSM_WASTE_DISPOSAL_ROTARY]				= LOADSRF (IDB_CSM_WASTE_DISPOSAL_ROTARY);
+	srf[SRF_THREEPOSSWITCH90_LEFT]					= LOADSRF (IDB_THREEPOSSWITCH90_LEFT);
+	srf[SRF_EMS_SCROLL_BUG]							= LOADSRF (IDB_EMS_SCROLL_BUG);
+	srf[SRF_SWITCH90]								= LOADSRF (IDB_SWITCH90);
+	srf[SRF_CSM_CABINPRESSTESTSWITCH]				= LOADSRF (IDB_CSM_CABINPRESSTESTSWITCH);
+	srf[SRF_ORDEAL_PANEL]							= LOADSRF (IDB_ORDEAL_PANEL);
+	srf[SRF_CSM_TELESCOPECOVER]						= LOADSRF (IDB_CSM_TELESCOPECOVER);	
+	srf[SRF_CSM_SEXTANTCOVER]						= LOADSRF (IDB_CSM_SEXTANTCOVER);
+	srf[SRF_CWS_GNLIGHTS]      						= LOADSRF (IDB_CWS_GNLIGHTS);
+	srf[SRF_EVENT_TIMER_DIGITS90]					= LOADSRF (IDB_EVENT_TIMER90);
+	srf[SRF_DIGITAL90]								= LOADSRF (IDB_DIGITAL90);
+	srf[SRF_CSM_PRESS_EQUAL_HANDLE]                 = LOADSRF (IDB_CSM_PRESS_EQUAL_HANDLE);
+	srf[SRF_CSM_PANEL_181]                          = LOADSRF (IDB_CSM_PANEL_181);
+	srf[SRF_CSM_PANEL_277]                          = LOADSRF (IDB_CSM_PANEL_277);
+	srf[SRF_CSM_PANEL_278_CSM112]                   = LOADSRF (IDB_CSM_PANEL_278_CSM112);
+	srf[SRF_CSM_PANEL_278_CSM114]                   = LOADSRF (IDB_CSM_PANEL_278_CSM114);
+	srf[SRF_INDICATOR90]                            = LOADSRF (IDB_INDICATOR90);
+	srf[SRF_THREEPOSSWITCH90_RIGHT]					= LOADSRF (IDB_THREEPOSSWITCH90_RIGHT);
+	srf[SRF_CRYO_SWITCHES_J]                        = LOADSRF (IDB_CRYO_SWITCHES_J);
+	srf[SRF_CRYO_IND_J]                             = LOADSRF (IDB_CRYO_IND_J);
+	srf[SRF_SWITCHGUARDS90_RIGHT]                   = LOADSRF (IDB_SWITCHGUARDS90_RIGHT);
 
 
 	//
 	// Flashing borders.
 	//
 
-	srf[SRF_BORDER_31x31]			= oapiCreateSurface (LOADBMP (IDB_BORDER_31x31));
-	srf[SRF_BORDER_34x29]			= oapiCreateSurface (LOADBMP (IDB_BORDER_34x29));
-	srf[SRF_BORDER_34x61]			= oapiCreateSurface (LOADBMP (IDB_BORDER_34x61));
-	srf[SRF_BORDER_55x111]			= oapiCreateSurface (LOADBMP (IDB_BORDER_55x111));
-	srf[SRF_BORDER_46x75]			= oapiCreateSurface (LOADBMP (IDB_BORDER_46x75));
-	srf[SRF_BORDER_39x38]			= oapiCreateSurface (LOADBMP (IDB_BORDER_39x38));
-	srf[SRF_BORDER_92x40]			= oapiCreateSurface (LOADBMP (IDB_BORDER_92x40));
-	srf[SRF_BORDER_34x33]			= oapiCreateSurface (LOADBMP (IDB_BORDER_34x33));
-	srf[SRF_BORDER_29x29]			= oapiCreateSurface (LOADBMP (IDB_BORDER_29x29));
-	srf[SRF_BORDER_34x31]			= oapiCreateSurface (LOADBMP (IDB_BORDER_34x31));
-	srf[SRF_BORDER_50x158]			= oapiCreateSurface (LOADBMP (IDB_BORDER_50x158));
-	srf[SRF_BORDER_38x52]			= oapiCreateSurface (LOADBMP (IDB_BORDER_38x52));
-	srf[SRF_BORDER_34x34]			= oapiCreateSurface (LOADBMP (IDB_BORDER_34x34));
-	srf[SRF_BORDER_90x90]			= oapiCreateSurface (LOADBMP (IDB_BORDER_90x90));
-	srf[SRF_BORDER_84x84]			= oapiCreateSurface (LOADBMP (IDB_BORDER_84x84));
-	srf[SRF_BORDER_70x70]			= oapiCreateSurface (LOADBMP (IDB_BORDER_70x70));
-	srf[SRF_BORDER_23x20]			= oapiCreateSurface (LOADBMP (IDB_BORDER_23x20));
-	srf[SRF_BORDER_78x78]			= oapiCreateSurface (LOADBMP (IDB_BORDER_78x78));
-	srf[SRF_BORDER_32x160]			= oapiCreateSurface (LOADBMP (IDB_BORDER_32x160));
-	srf[SRF_BORDER_72x72]			= oapiCreateSurface (LOADBMP (IDB_BORDER_72x72));
-	srf[SRF_BORDER_75x64]			= oapiCreateSurface (LOADBMP (IDB_BORDER_75x64));
-	srf[SRF_BORDER_58x58]			= oapiCreateSurface (LOADBMP (IDB_BORDER_58x58));
-	srf[SRF_BORDER_160x32]			= oapiCreateSurface (LOADBMP (IDB_BORDER_160x32));
-	srf[SRF_BORDER_57x57]			= oapiCreateSurface (LOADBMP (IDB_BORDER_57x57));
-	srf[SRF_BORDER_47x47]			= oapiCreateSurface (LOADBMP (IDB_BORDER_47x47));
-	srf[SRF_BORDER_48x48]			= oapiCreateSurface (LOADBMP (IDB_BORDER_48x48));
-	srf[SRF_BORDER_65x65]			= oapiCreateSurface (LOADBMP (IDB_BORDER_65x65));
-	srf[SRF_BORDER_87x111]			= oapiCreateSurface (LOADBMP (IDB_BORDER_87x111));
-	srf[SRF_BORDER_23x23]			= oapiCreateSurface (LOADBMP (IDB_BORDER_23x23));
-	srf[SRF_BORDER_118x118]			= oapiCreateSurface (LOADBMP (IDB_BORDER_118x118));
-	srf[SRF_BORDER_38x38]			= oapiCreateSurface (LOADBMP (IDB_BORDER_38x38));
-	srf[SRF_BORDER_116x116]			= oapiCreateSurface (LOADBMP (IDB_BORDER_116x116));
-	srf[SRF_BORDER_45x36]			= oapiCreateSurface (LOADBMP (IDB_BORDER_45x36));
-	srf[SRF_BORDER_17x36]			= oapiCreateSurface (LOADBMP (IDB_BORDER_17x36));
-	srf[SRF_BORDER_33x43]			= oapiCreateSurface (LOADBMP (IDB_BORDER_33x43));
-	srf[SRF_BORDER_36x17]			= oapiCreateSurface (LOADBMP (IDB_BORDER_36x17));
-	srf[SRF_BORDER_38x37]			= oapiCreateSurface (LOADBMP (IDB_BORDER_38x37));
-	srf[SRF_BORDER_150x80]			= oapiCreateSurface (LOADBMP (IDB_BORDER_150x80));
-	srf[SRF_BORDER_200x80]			= oapiCreateSurface (LOADBMP (IDB_BORDER_200x80));
-	srf[SRF_BORDER_72x109]			= oapiCreateSurface (LOADBMP (IDB_BORDER_72x109));
-	srf[SRF_BORDER_200x300]			= oapiCreateSurface (LOADBMP (IDB_BORDER_200x300));
-	srf[SRF_BORDER_150x200]			= oapiCreateSurface (LOADBMP (IDB_BORDER_150x200));
-	srf[SRF_BORDER_240x240]			= oapiCreateSurface (LOADBMP (IDB_BORDER_240x240));
-	srf[SRF_BORDER_55x91]			= oapiCreateSurface (LOADBMP (IDB_BORDER_55x91));
-	srf[SRF_BORDER_673x369]			= oapiCreateSurface (LOADBMP (IDB_BORDER_673x369));
-	srf[SRF_BORDER_673x80]			= oapiCreateSurface (LOADBMP (IDB_BORDER_673x80));
-	srf[SRF_BORDER_110x29]			= oapiCreateSurface (LOADBMP (IDB_BORDER_110x29));
-	srf[SRF_BORDER_29x30]			= oapiCreateSurface (LOADBMP (IDB_BORDER_29x30));
-	srf[SRF_BORDER_62x129]			= oapiCreateSurface (LOADBMP (IDB_BORDER_62x129));
-	srf[SRF_BORDER_194x324]			= oapiCreateSurface (LOADBMP (IDB_BORDER_194x324));
-	srf[SRF_BORDER_36x69]			= oapiCreateSurface (LOADBMP (IDB_BORDER_36x69));
-	srf[SRF_BORDER_62x31]			= oapiCreateSurface (LOADBMP (IDB_BORDER_62x31));
-	srf[SRF_BORDER_45x49]			= oapiCreateSurface (LOADBMP (IDB_BORDER_45x49));
-	srf[SRF_BORDER_28x32]			= oapiCreateSurface (LOADBMP (IDB_BORDER_28x32));
+	srf[SRF_BORDER_31x31]			= LOADSRF (IDB_BORDER_31x31);
+	srf[SRF_BORDER_34x29]			= LOADSRF (IDB_BORDER_34x29);
+	srf[SRF_BORDER_34x61]			= LOADSRF (IDB_BORDER_34x61);
+	srf[SRF_BORDER_55x111]			= LOADSRF (IDB_BORDER_55x111);
+	srf[SRF_BORDER_46x75]			= LOADSRF (IDB_BORDER_46x75);
+	srf[SRF_BORDER_39x38]			= LOADSRF (IDB_BORDER_39x38);
+	srf[SRF_BORDER_92x40]			= LOADSRF (IDB_BORDER_92x40);
+	srf[SRF_BORDER_34x33]			= LOADSRF (IDB_BORDER_34x33);
+	srf[SRF_BORDER_29x29]			= LOADSRF (IDB_BORDER_29x29);
+	srf[SRF_BORDER_34x31]			= LOADSRF (IDB_BORDER_34x31);
+	srf[SRF_BORDER_50x158]			= LOADSRF (IDB_BORDER_50x158);
+	srf[SRF_BORDER_38x52]			= LOADSRF (IDB_BORDER_38x52);
+	srf[SRF_BORDER_34x34]			= LOADSRF (IDB_BORDER_34x34);
+	srf[SRF_BORDER_90x90]			= LOADSRF (IDB_BORDER_90x90);
+	srf[SRF_BORDER_84x84]			= LOADSRF (IDB_BORDER_84x84);
+	srf[SRF_BORDER_70x70]			= LOADSRF (IDB_BORDER_70x70);
+	srf[SRF_BORDER_23x20]			= LOADSRF (IDB_BORDER_23x20);
+	srf[SRF_BORDER_78x78]			= LOADSRF (IDB_BORDER_78x78);
+	srf[SRF_BORDER_32x160]			= LOADSRF (IDB_BORDER_32x160);
+	srf[SRF_BORDER_72x72]			= LOADSRF (IDB_BORDER_72x72);
+	srf[SRF_BORDER_75x64]			= LOADSRF (IDB_BORDER_75x64);
+	srf[SRF_BORDER_58x58]			= LOADSRF (IDB_BORDER_58x58);
+	srf[SRF_BORDER_160x32]			= LOADSRF (IDB_BORDER_160x32);
+	srf[SRF_BORDER_57x57]			= LOADSRF (IDB_BORDER_57x57);
+	srf[SRF_BORDER_47x47]			= LOADSRF (IDB_BORDER_47x47);
+	srf[SRF_BORDER_48x48]			= LOADSRF (IDB_BORDER_48x48);
+	srf[SRF_BORDER_65x65]			= LOADSRF (IDB_BORDER_65x65);
+	srf[SRF_BORDER_87x111]			= LOADSRF (IDB_BORDER_87x111);
+	srf[SRF_BORDER_23x23]			= LOADSRF (IDB_BORDER_23x23);
+	srf[SRF_BORDER_118x118]			= LOADSRF (IDB_BORDER_118x118);
+	srf[SRF_BORDER_38x38]			= LOADSRF (IDB_BORDER_38x38);
+	srf[SRF_BORDER_116x116]			= LOADSRF (IDB_BORDER_116x116);
+	srf[SRF_BORDER_45x36]			= LOADSRF (IDB_BORDER_45x36);
+	srf[SRF_BORDER_17x36]			= LOADSRF (IDB_BORDER_17x36);
+	srf[SRF_BORDER_33x43]			= LOADSRF (IDB_BORDER_33x43);
+	srf[SRF_BORDER_36x17]			= LOADSRF (IDB_BORDER_36x17);
+	srf[SRF_BORDER_38x37]			= LOADSRF (IDB_BORDER_38x37);
+	srf[SRF_BORDER_150x80]			= LOADSRF (IDB_BORDER_150x80);
+	srf[SRF_BORDER_200x80]			= LOADSRF (IDB_BORDER_200x80);
+	srf[SRF_BORDER_72x109]			= LOADSRF (IDB_BORDER_72x109);
+	srf[SRF_BORDER_200x300]			= LOADSRF (IDB_BORDER_200x300);
+	srf[SRF_BORDER_150x200]			= LOADSRF (IDB_BORDER_150x200);
+	srf[SRF_BORDER_240x240]			= LOADSRF (IDB_BORDER_240x240);
+	srf[SRF_BORDER_55x91]			= LOADSRF (IDB_BORDER_55x91);
+	srf[SRF_BORDER_673x369]			= LOADSRF (IDB_BORDER_673x369);
+	srf[SRF_BORDER_673x80]			= LOADSRF (IDB_BORDER_673x80);
+	srf[SRF_BORDER_110x29]			= LOADSRF (IDB_BORDER_110x29);
+	srf[SRF_BORDER_29x30]			= LOADSRF (IDB_BORDER_29x30);
+	srf[SRF_BORDER_62x129]			= LOADSRF (IDB_BORDER_62x129);
+	srf[SRF_BORDER_194x324]			= LOADSRF (IDB_BORDER_194x324);
+	srf[SRF_BORDER_36x69]			= LOADSRF (IDB_BORDER_36x69);
+	srf[SRF_BORDER_62x31]			= LOADSRF (IDB_BORDER_62x31);
+	srf[SRF_BORDER_45x49]			= LOADSRF (IDB_BORDER_45x49);
+	srf[SRF_BORDER_28x32]			= LOADSRF (IDB_BORDER_28x32);
 
 	//
 	// Set color keys where appropriate.
@@ -3226,6 +3228,7 @@ void Saturn::SetSwitches(int panel) {
 	//
 
 	OrbiterAttitudeToggleRow.Init(AID_SM_RCS_MODE, MainPanel);
+	OrbiterAttitudeToggleRow.SetTrackChanges(false);
 	OrbiterAttitudeToggle.Init(28, 33, 23, 20, srf[SRF_SWITCHUPSMALL], srf[SRF_BORDER_23x20], OrbiterAttitudeToggleRow);
 
 	/////////////////////////////
@@ -3383,6 +3386,7 @@ void Saturn::SetSwitches(int panel) {
 	OxygenRepressPackageRotary.Init (212, 0, 78, 78, srf[SRF_ECSROTARY], srf[SRF_BORDER_78x78], OxygenRotariesRow);
 
 	ORDEALSwitchesRow.Init(AID_ORDEALSWITCHES, MainPanel);
+	ORDEALSwitchesRow.SetTrackChanges(false);
 	ORDEALFDAI1Switch.Init	 ( 55,  43, 34, 29, srf[SRF_SWITCHUP], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
 	ORDEALFDAI2Switch.Init	 (168,  43, 34, 29, srf[SRF_SWITCHUP], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
 	ORDEALEarthSwitch.Init	 (264,  43, 34, 29, srf[SRF_THREEPOSSWITCH], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
@@ -3462,6 +3466,7 @@ void Saturn::SetSwitches(int panel) {
 	///////////////////////////
 
 	Panel382Row.Init(AID_CSM_PANEL_382, MainPanel);
+	Panel382Row.SetTrackChanges(false);
 	EvapWaterControlPrimaryRotary.Init         (149, 229, 48, 48, srf[SRF_CABIN_REPRESS_VALVE], srf[SRF_BORDER_48x48], Panel382Row);
 	EvapWaterControlSecondaryRotary.Init       (149,  94, 48, 48, srf[SRF_CABIN_REPRESS_VALVE], srf[SRF_BORDER_48x48], Panel382Row);
 	WaterAccumulator1Rotary.Init               ( 23, 124, 48, 48, srf[SRF_CABIN_REPRESS_VALVE], srf[SRF_BORDER_48x48], Panel382Row);
@@ -3493,11 +3498,13 @@ void Saturn::SetSwitches(int panel) {
 	HatchToggle.SetCallback(new PanelSwitchCallback<SaturnSideHatch>(&SideHatch, &SaturnSideHatch::SwitchToggled));
 
 	HatchPanel600LeftRow.Init(AID_CSM_HATCH_600_LEFT, MainPanel, &GaugePower);
+	HatchPanel600LeftRow.SetTrackChanges(false);
 	HatchEmergencyO2ValveSwitch.Init(26, 34, 62, 129, srf[SRF_CSM_PANEL_600_SWITCH], srf[SRF_BORDER_62x129], HatchPanel600LeftRow, 186, 0);
 	HatchOxygenRepressPressMeter.Init(g_Param.pen[0], g_Param.pen[0], HatchPanel600LeftRow, this);
 	HatchOxygenRepressPressMeter.FrameSurface = srf[SRF_CSM_PANEL_600];
 
 	HatchPanel600RightRow.Init(AID_CSM_HATCH_600_RIGHT, MainPanel);
+	HatchPanel600RightRow.SetTrackChanges(false);
 	HatchRepressO2ValveSwitch.Init(61, 34, 62, 129, srf[SRF_CSM_PANEL_600_SWITCH], srf[SRF_BORDER_62x129], HatchPanel600RightRow, 186, 0);
 
 	Panel600.Init(HatchPanel600LeftRow, this); 	// dummy switch/display for checklist controller
@@ -3532,6 +3539,7 @@ void Saturn::SetSwitches(int panel) {
 		dx = 9;
 		dy = 219;
 		Dsky2SwitchRow.Init(AID_OPTICS_DSKY, MainPanel);
+		Dsky2SwitchRow.SetTrackChanges(false);
 	} else {
 		Dsky2SwitchRow.Init(AID_DSKY2_KEY, MainPanel);
 	}
@@ -4519,9 +4527,14 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 	}*/
 
 	//
-	// Process all the generic switches.
+	// Process all the generic switches. If nothing in the row changed since it was last
+	// drawn, leave the old image on the panel. Rows on areas with special handling above
+	// have change tracking disabled.
 	//
 
+	if (event == PANEL_REDRAW_ALWAYS && MainPanel.IsRowUnchanged(id, PanelFlashOn))
+		return false;
+
 	if (MainPanel.DrawRow(id, surf, PanelFlashOn))
 		return true;
 
@@ -4577,10 +4590,14 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 		return true;
 
 	case AID_DSKY_LIGHTS:
+		if (!dsky.LightsChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		dsky.RenderLights(surf, srf[SRF_DSKY]);
 		return true;
 
 	case AID_DSKY_DISPLAY:
+		if (!dsky.DataChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		dsky.RenderData(surf, srf[SRF_DIGITAL], srf[SRF_DSKYDISP]);
 		return true;
 
@@ -4658,10 +4675,14 @@ bool Saturn::clbkPanelRedrawEvent(int id, int event, SURFHANDLE surf)
 		return true;
 
 	case AID_DSKY2_LIGHTS:
+		if (!dsky2.LightsChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		dsky2.RenderLights(surf, srf[SRF_DSKY]);
 		return true;
 
 	case AID_DSKY2_DISPLAY:
+		if (!dsky2.DataChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		dsky2.RenderData(surf, srf[SRF_DIGITAL], srf[SRF_DSKYDISP]);
 		return true;
 
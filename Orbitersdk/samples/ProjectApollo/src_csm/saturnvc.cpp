@@ -36,6 +36,7 @@
 #include "nasspdefs.h"
 #include "nasspsound.h"
 #include "toggleswitch.h"
+#include "panelsurfacecache.h"
 #include "apolloguidance.h"
 #include "dsky.h"
 #include "csmcomputer.h"
@@ -720,7 +721,7 @@ void Saturn::ReleaseSurfacesVC()
 {
 	for (int i = 0; i < nsurfvc; i++)
 		if (srf[i]) {
-			oapiDestroySurface(srf[i]);
+			PanelSurfaceCache::ReleaseSurface(srf[i]);
 			srf[i] = 0;
 		}
 }
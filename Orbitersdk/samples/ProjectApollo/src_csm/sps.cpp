@@ -526,8 +526,8 @@ void SPSEngine::Timestep(double simt, double simdt) {
 		if (spsgimbal_proc[0] < 0) spsgimbal_proc[0] += 1.0;
 		spsgimbal_proc[1] = yawGimbalActuator.GetPosition() / 360;
 		if (spsgimbal_proc[1] < 0) spsgimbal_proc[1] += 1.0;
-		if (spsgimbal_proc[0] - spsgimbal_proc_last[0] != 0.0) saturn->SetAnimation(anim_SPSGimbalPitch, spsgimbal_proc[0]);
-		if (spsgimbal_proc[1] - spsgimbal_proc_last[1] != 0.0) saturn->SetAnimation(anim_SPSGimbalYaw, spsgimbal_proc[1]);
+		if (spsgimbal_proc[0] - spsgimbal_proc_last[0] != 0.0) saturn->QueueAnimation(anim_SPSGimbalPitch, spsgimbal_proc[0]);
+		if (spsgimbal_proc[1] - spsgimbal_proc_last[1] != 0.0) saturn->QueueAnimation(anim_SPSGimbalYaw, spsgimbal_proc[1]);
 		spsgimbal_proc_last[0] = spsgimbal_proc[0];
 		spsgimbal_proc_last[1] = spsgimbal_proc[1];
 	}
@@ -829,8 +829,8 @@ void SPSEngine::clbkPostCreation() {
 	if (spsgimbal_proc[0] < 0) spsgimbal_proc[0] += 1.0;
 	spsgimbal_proc[1] = yawGimbalActuator.GetPosition() / 360;
 	if (spsgimbal_proc[1] < 0) spsgimbal_proc[1] += 1.0;
-	if (spsgimbal_proc[0] - spsgimbal_proc_last[0] != 0.0) saturn->SetAnimation(anim_SPSGimbalPitch, spsgimbal_proc[0]);
-	if (spsgimbal_proc[1] - spsgimbal_proc_last[1] != 0.0) saturn->SetAnimation(anim_SPSGimbalYaw, spsgimbal_proc[1]);
+	if (spsgimbal_proc[0] - spsgimbal_proc_last[0] != 0.0) saturn->ApplyAnimation(anim_SPSGimbalPitch, spsgimbal_proc[0]);
+	if (spsgimbal_proc[1] - spsgimbal_proc_last[1] != 0.0) saturn->ApplyAnimation(anim_SPSGimbalYaw, spsgimbal_proc[1]);
 	spsgimbal_proc_last[0] = spsgimbal_proc[0];
 	spsgimbal_proc_last[1] = spsgimbal_proc[1];
 }
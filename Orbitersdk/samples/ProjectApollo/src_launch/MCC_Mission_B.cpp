@@ -60,7 +60,7 @@ void MCC::MissionSequence_B()
 			setSubState(2);
 			break;
 		case 2:
-			if (lm->PCM.mcc_size == 0)
+			if (lm->PCM.uplink.Empty())
 			{
 				setSubState(3);
 			}
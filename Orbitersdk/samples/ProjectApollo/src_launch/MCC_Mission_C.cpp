@@ -72,7 +72,7 @@ void MCC::MissionSequence_C()
 			}
 			break;
 		case 6: // Await uplink completion
-			if (cm->pcm.mcc_size == 0) {
+			if (cm->pcm.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				NCOption_Enabled = true;
 				sprintf(NCOption_Text, "Repeat uplink");
@@ -688,12 +688,12 @@ void MCC::TimeStep(double simdt){
 						//Dont switch to a new station if we're transmitting an uplink;
 						bool uplinking = false;
 						if (cm) {
-							if (cm->pcm.mcc_size != 0) {
+							if (!cm->pcm.uplink.Empty()) {
 								uplinking = true;
 							}
 						}
 						if (lm) {
-							if (lm->PCM.mcc_size != 0) { 
+							if (!lm->PCM.uplink.Empty()) { 
 								uplinking = true;
 							}
 						}
@@ -1185,23 +1185,13 @@ void MCC::pushUplinkData(unsigned char data) {
 
 // Uplink string to CM
 int MCC::CM_uplink(const unsigned char *data, int len) {
-	int remsize = 2048;
-	remsize -= cm->pcm.mcc_size;
-	// if (cm->pcm.mcc_size > 0) { return -1; } // If busy, bail
-	if (len > remsize) { return -2; } // Too long!
-	memcpy((cm->pcm.mcc_data+cm->pcm.mcc_size), data, len);
-	cm->pcm.mcc_size += len;
+	if (!cm->GetUplinkQueue()->Enqueue(data, len)) { return -2; } // Too long!
 	return len;
 }
 
 // Uplink string to LM
 int MCC::LM_uplink(const unsigned char *data, int len) {
-	int remsize = 2048;
-	remsize -= lm->PCM.mcc_size;
-	// if (lm->pcm.mcc_size > 0) { return -1; } // If busy, bail
-	if (len > remsize) { return -2; } // Too long!
-	memcpy((lm->PCM.mcc_data + lm->PCM.mcc_size), data, len);
-	lm->PCM.mcc_size += len;
+	if (!lm->GetUplinkQueue()->Enqueue(data, len)) { return -2; } // Too long!
 	return len;
 }
 
@@ -3670,7 +3660,7 @@ void MCC::UpdateMacro(int type, int padtype, bool condition, int updatenumber, i
 			}
 			break;
 		case 5: // Await uplink completion
-			if (cm->pcm.mcc_size == 0) {
+			if (cm->pcm.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				NCOption_Enabled = true;
 				sprintf(NCOption_Text, "Repeat uplink");
@@ -3738,7 +3728,7 @@ void MCC::UpdateMacro(int type, int padtype, bool condition, int updatenumber, i
 			}
 			break;
 		case 5: // Await uplink completion
-			if (cm->pcm.mcc_size == 0) {
+			if (cm->pcm.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				NCOption_Enabled = true;
 				sprintf(NCOption_Text, "Repeat uplink");
@@ -3840,7 +3830,7 @@ void MCC::UpdateMacro(int type, int padtype, bool condition, int updatenumber, i
 			}
 			break;
 		case 5: // Await uplink completion
-			if (lm->PCM.mcc_size == 0) {
+			if (lm->PCM.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				NCOption_Enabled = true;
 				sprintf(NCOption_Text, "Repeat uplink");
@@ -3908,7 +3898,7 @@ void MCC::UpdateMacro(int type, int padtype, bool condition, int updatenumber, i
 			}
 			break;
 		case 5: // Await uplink completion
-			if (lm->PCM.mcc_size == 0) {
+			if (lm->PCM.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				NCOption_Enabled = true;
 				sprintf(NCOption_Text, "Repeat uplink");
@@ -3963,7 +3953,7 @@ void MCC::UpdateMacro(int type, int padtype, bool condition, int updatenumber, i
 			}
 			break;
 		case 3: // Await uplink completion
-			if (lm->PCM.mcc_size == 0) {
+			if (lm->PCM.uplink.Empty()) {
 				addMessage("Uplink completed!");
 				setSubState(4);
 			}
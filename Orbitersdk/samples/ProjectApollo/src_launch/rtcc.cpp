@@ -39,10 +39,12 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/TLIGuidanceSim.h"
 #include "../src_rtccmfd/CSMLMGuidanceSim.h"
 #include "../src_rtccmfd/GeneralizedIterator.h"
+#include "../src_rtccmfd/ParallelFor.h"
 #include "../src_rtccmfd/EnckeIntegrator.h"
 #include "../src_rtccmfd/ReentryNumericalIntegrator.h"
 #include "mcc.h"
 #include "rtcc.h"
+#include <algorithm>
 
 // SCENARIO FILE MACROLOGY
 #define SAVE_BOOL(KEY,VALUE) oapiWriteScenario_int(scn, KEY, VALUE)
@@ -1367,6 +1369,7 @@ RTCC::RTCC()
 {
 	mcc = NULL;
 	MissionFileName[0] = 0;
+	PropagationCacheGeneration = 0;
 	TimeofIgnition = 0.0;
 	SplashLatitude = 0.0;
 	SplashLongitude = 0.0;
@@ -1971,6 +1974,7 @@ void RTCC::LoadMissionConstantsFile(char *file)
 			papiReadScenario_int(Buff, "MHVACG_N", SystemParameters.MHVACG.N);
 		}
 	}
+	PropagationCacheGeneration++;
 }
 
 void RTCC::AP7BlockData(AP7BLKOpt *opt, AP7BLK &pad)
@@ -5356,9 +5360,52 @@ void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMm
 	TLMCCMissionConstants mccconst;
 	TLMCCOutputData out;
 
+	TLMCCInputs(PZMCCPLN.Mode, sv0, CSMmass, LMmass, datatab, medquant, mccconst);
+
+	TLMCCProcessor tlmcc(this);
+	tlmcc.Init(datatab, medquant, mccconst);
+	tlmcc.Main(out);
+
+	TLMCCStoreColumn(PZMCCPLN.Column, out);
+}
+
+void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass, const std::vector<int> &modes, std::vector<TLMCCOutputData> &out)
+{
+	unsigned NumModes = modes.size();
+	//Only the columns from the selected one to column 4 on the display
+	if (PZMCCPLN.Column < 1 || PZMCCPLN.Column > 4) NumModes = 0;
+	else if (NumModes > (unsigned)(5 - PZMCCPLN.Column)) NumModes = 5 - PZMCCPLN.Column;
+
+	out.assign(NumModes, TLMCCOutputData());
+	if (NumModes == 0) return;
+
+	//The processor only reads from the RTCC, so each option can run in its own instance. The iterator partials of each option
+	//are then calculated on its own thread
+	ParallelFor(NumModes, [&](unsigned i)
+	{
+		TLMCCDataTable datatab;
+		TLMCCMEDQuantities medquant;
+		TLMCCMissionConstants mccconst;
+
+		TLMCCInputs(modes[i], sv0, CSMmass, LMmass, datatab, medquant, mccconst);
+
+		TLMCCProcessor tlmcc(this);
+		tlmcc.Init(datatab, medquant, mccconst);
+		tlmcc.Main(out[i]);
+	});
+
+	//Options are stored in the columns in the order they were requested, starting at the selected column
+	for (unsigned i = 0;i < NumModes;i++)
+	{
+		TLMCCStoreColumn(PZMCCPLN.Column + i, out[i]);
+	}
+}
+
+void RTCC::TLMCCInputs(int mode, const EphemerisData &sv0, double CSMmass, double LMmass, TLMCCDataTable &datatab, TLMCCMEDQuantities &medquant, TLMCCMissionConstants &mccconst)
+{
 	datatab = PZSFPTAB.blocks[PZMCCPLN.SFPBlockNum - 1];
 
-	medquant.Mode = PZMCCPLN.Mode;
+	medquant.Mode = mode;
 	medquant.Config = PZMCCPLN.Config;
 	medquant.T_MCC = GMTfromGET(PZMCCPLN.MidcourseGET);
 	medquant.GMTBase = GetGMTBase();
@@ -5405,24 +5452,23 @@ void RTCC::TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMm
 	mccconst.T_t1_max_dps = PZMCCPLN.TT1_DPS_MAX;
 	mccconst.INCL_PR_MAX = PZMCCPLN.INCL_PR_MAX;
 	mccconst.Reentry_range = PZMCCPLN.Reentry_range;
+}
 
-	TLMCCProcessor tlmcc(this);
-	tlmcc.Init(datatab, medquant, mccconst);
-	tlmcc.Main(out);
-
+void RTCC::TLMCCStoreColumn(int column, const TLMCCOutputData &out)
+{
 	//Update display data
-	PZMCCDIS.data[PZMCCPLN.Column - 1] = out.display;
+	PZMCCDIS.data[column - 1] = out.display;
 
 	//Update MPT transfer table
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].R = out.R_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].V = out.V_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].GMT = out.GMT_MCC;
-	PZMCCXFR.sv_man_bef[PZMCCPLN.Column - 1].RBI = out.RBI;
-	PZMCCXFR.V_man_after[PZMCCPLN.Column - 1] = out.V_MCC_apo;
+	PZMCCXFR.sv_man_bef[column - 1].R = out.R_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].V = out.V_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].GMT = out.GMT_MCC;
+	PZMCCXFR.sv_man_bef[column - 1].RBI = out.RBI;
+	PZMCCXFR.V_man_after[column - 1] = out.V_MCC_apo;
 
 	//Update skeleton flight plan table
-	PZMCCSFP.blocks[PZMCCPLN.Column - 1] = out.outtab;
-	PZMCCSFP.blocks[PZMCCPLN.Column - 1].GMTTimeFlag = RTCCPresentTimeGMT();
+	PZMCCSFP.blocks[column - 1] = out.outtab;
+	PZMCCSFP.blocks[column - 1].GMTTimeFlag = RTCCPresentTimeGMT();
 }
 
 bool RTCC::GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG)
@@ -6842,6 +6888,9 @@ void RTCC::LoadState(FILEHANDLE scn) {
 		}
 	}
 
+	//Coast integrations of the previous state can't be used anymore
+	PropagationCacheGeneration++;
+
 	if (EZANCHR1.AnchorVectors[9].Vector.GMT != 0)
 	{
 		PMSVCT(4, RTCC_MPT_CSM, &EZANCHR1.AnchorVectors[9]);
@@ -14853,34 +14902,34 @@ int RTCC::EMDSPACENoMPT(SV sv0, int queid, double gmt, double incl, double ascno
 
 		EZSPACE.GETVector2 = GETfromGMT(sv.GMT);
 
-		EMMENIInputTable emsin;
+		//Both searches start from the same vector, so they are integrated together
+		std::vector<EMMENIInputTable> emsin(sv.RBI == BODY_EARTH ? 2 : 1);
+
+		//Try to find perilune
+		emsin[0].AnchorVector = sv;
+		emsin[0].CutoffIndicator = 4;
+		emsin[0].StopParamRefFrame = 1;
+		emsin[0].MoonRelStopParam = 0.0;
+		emsin[0].MaxIntegTime = 10.0*24.0*3600.0;
 
 		if (sv.RBI == BODY_EARTH)
 		{
 			//Try to find lunar sphere entry
-			emsin.AnchorVector = sv;
-			emsin.CutoffIndicator = 5;
-			emsin.MaxIntegTime = 10.0*24.0*3600.0;
+			emsin[1].AnchorVector = sv;
+			emsin[1].CutoffIndicator = 5;
+			emsin[1].MaxIntegTime = 10.0*24.0*3600.0;
+		}
 
-			EphemerisData sv_SI;
-			EMMENI(emsin);
-			sv_SI = emsin.sv_cutoff;
-			if (emsin.TerminationCode == 5)
-			{
-				EZSPACE.GETSI = GETfromGMT(sv_SI.GMT);
-			}
+		EMMENI(emsin);
+
+		if (sv.RBI == BODY_EARTH && emsin[1].TerminationCode == 5)
+		{
+			EZSPACE.GETSI = GETfromGMT(emsin[1].sv_cutoff.GMT);
 		}
 
-		//Try to find perilune
-		emsin.AnchorVector = sv;
-		emsin.CutoffIndicator = 4;
-		emsin.StopParamRefFrame = 1;
-		emsin.MoonRelStopParam = 0.0;
-		emsin.MaxIntegTime = 10.0*24.0*3600.0;
 		EphemerisData sv1;
-		EMMENI(emsin);
-		sv1 = emsin.sv_cutoff;
-		if (emsin.TerminationCode != 4)
+		sv1 = emsin[0].sv_cutoff;
+		if (emsin[0].TerminationCode != 4)
 		{
 			return 0;
 		}
@@ -16959,6 +17008,17 @@ int RTCC::PMMLDP(PMMLDPInput in, MPTManeuver &man)
 
 void RTCC::PMMCEN(EphemerisData sv, double tmin, double tmax, int opt, double endcond, double dir, EphemerisData &sv_out, int &ITS)
 {
+	PMMCENCacheResult res;
+	PropagationCache<13, PMMCENCacheResult>::Key key = { sv.R.x, sv.R.y, sv.R.z, sv.V.x, sv.V.y, sv.V.z, sv.GMT, (double)sv.RBI, tmin, tmax, (double)opt, endcond, dir };
+
+	PMMCENCache.Validate(PropagationCacheStamp());
+	if (PMMCENCache.Find(key, res))
+	{
+		sv_out = res.sv_out;
+		ITS = res.ITS;
+		return;
+	}
+
 	CoastIntegrator2 pmmcen(this);
 
 	pmmcen.Propagate(sv.R, sv.V, sv.GMT, tmax, tmin, endcond, dir, sv.RBI, opt);
@@ -16968,6 +17028,34 @@ void RTCC::PMMCEN(EphemerisData sv, double tmin, double tmax, int opt, double en
 	sv_out.GMT = pmmcen.T2;
 	sv_out.RBI = pmmcen.outplanet;
 	ITS = pmmcen.ITS;
+
+	res.sv_out = sv_out;
+	res.ITS = ITS;
+	PMMCENCache.Store(key, res);
+}
+
+void RTCC::PMMCEN(PMMCENBatchTable &tab)
+{
+	CoastBatchIntegrator pmmcen(this);
+	unsigned Count = tab.Size();
+
+	//The common step length of the batch gives slightly different results than the single trajectory integrator, so the cache isn't used
+	for (unsigned i = 0;i < Count;i++)
+	{
+		pmmcen.Add(tab.sv[i].R, tab.sv[i].V, tab.sv[i].GMT, tab.tmax[i], tab.tmin[i], tab.endcond[i], tab.dir[i], tab.sv[i].RBI, tab.opt[i]);
+	}
+	pmmcen.Propagate();
+
+	tab.sv_out.resize(Count);
+	tab.ITS.resize(Count);
+	for (unsigned i = 0;i < Count;i++)
+	{
+		tab.sv_out[i].R = pmmcen.R2[i];
+		tab.sv_out[i].V = pmmcen.V2[i];
+		tab.sv_out[i].GMT = pmmcen.T2[i];
+		tab.sv_out[i].RBI = pmmcen.outplanet[i];
+		tab.ITS[i] = pmmcen.ITS[i];
+	}
 }
 
 void RTCC::PMMFUD(int veh, unsigned man, int action, std::string StationID)
@@ -17278,7 +17366,7 @@ void RTCC::PMMUDT(int L, unsigned man, int headsup, int trim)
 	PMSVCT(8, L);
 }
 
-void RTCC::EMSTRAJ(StateVectorTableEntry sv, int L)
+void RTCC::EMSTRAJ(StateVectorTableEntry sv, int L, bool TrajectoryUpdate)
 {
 	MissionPlanTable *table;
 	OrbitEphemerisTable *maineph;
@@ -17311,7 +17399,7 @@ void RTCC::EMSTRAJ(StateVectorTableEntry sv, int L)
 	tctab->StationID = sv.VectorCode;
 
 	//Generate main ephemeris
-	EMSEPH(2, sv, L, gmt);
+	EMSEPH(TrajectoryUpdate ? 3 : 2, sv, L, gmt);
 	if (sv.LandingSiteIndicator)
 	{
 		cctab->NumRev = 0;
@@ -17359,11 +17447,19 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 	//QUEID:
 	//1 = Cutoff mode
 	//2 = Ephemeris mode
+	//3 = Ephemeris mode, continue from the last maneuver before a change in the MPT
 
 	EMSMISSInputTable InTable;
 	EphemerisDataTable2 temptable;
 	ManeuverTimesTable tempmantable;
 	OrbitEphemerisTable *table;
+	bool Resume = false, Resumed = false;
+
+	if (QUEID == 3)
+	{
+		Resume = true;
+		QUEID = 2;
+	}
 	
 	if (L == RTCC_MPT_CSM)
 	{
@@ -17463,8 +17559,16 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 
 	if (QUEID == 2)
 	{
-		table->EPHEM.table.clear();
-		table->MANTIMES.Table.clear();
+		if (Resume)
+		{
+			Resumed = EMSEPHResume(L, InTable);
+		}
+		if (Resumed == false)
+		{
+			table->EPHEM.table.clear();
+			table->MANTIMES.Table.clear();
+			table->CHKPNT.clear();
+		}
 	}
 
 	RTCCNIAuxOutputTable aux;
@@ -17527,6 +17631,17 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 				table->MANTIMES.Table.push_back(tempmantable.Table[0]);
 				tempmantable.Table.clear();
 
+				if (InTable.NIAuxOutputTable.ErrorCode == 0)
+				{
+					EphemerisCheckpoint chk;
+					chk.sv = InTable.AnchorVector;
+					chk.landed = InTable.landed;
+					chk.ManeuverNumber = InTable.NIAuxOutputTable.ManeuverNumber;
+					chk.LUNRSTAY = table->LUNRSTAY;
+					chk.aux = *InTable.AuxTableIndicator;
+					table->CHKPNT.push_back(chk);
+				}
+
 				InTable.EphemerisLeftLimitGMT = InTable.AnchorVector.GMT;
 			}
 			else
@@ -17598,6 +17713,7 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 		table->EPHEM.Header.TL = table->EPHEM.table.front().GMT;
 		table->EPHEM.Header.TR = table->EPHEM.table.back().GMT;
 		table->MANTIMES.TUP = table->EPHEM.Header.TUP;
+		table->CHKMPT = *mpt;
 
 		if (L == RTCC_MPT_CSM)
 		{
@@ -17617,6 +17733,13 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 
 		//Update mission plan table display
 		PMDMPT();
+
+#ifdef _DEBUG
+		if (Resumed)
+		{
+			EMSEPHCheckResume(sv0, L, PresentGMT);
+		}
+#endif
 	}
 	StateVectorTableEntry sv_out;
 	sv_out.LandingSiteIndicator = InTable.NIAuxOutputTable.landed;
@@ -17625,6 +17748,242 @@ StateVectorTableEntry RTCC::EMSEPH(int QUEID, StateVectorTableEntry sv0, int L,
 	return sv_out;
 }
 
+static bool EMSEPHSameVector(const VECTOR3 &a, const VECTOR3 &b)
+{
+	return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+static bool EMSEPHSameVehicleData(const MPTVehicleDataBlock &a, const MPTVehicleDataBlock &b)
+{
+	return a.ConfigCode == b.ConfigCode && a.ConfigChangeInd == b.ConfigChangeInd &&
+		a.CSMArea == b.CSMArea && a.SIVBArea == b.SIVBArea && a.LMAscentArea == b.LMAscentArea && a.LMDescentArea == b.LMDescentArea &&
+		a.CSMMass == b.CSMMass && a.SIVBMass == b.SIVBMass && a.LMAscentMass == b.LMAscentMass && a.LMDescentMass == b.LMDescentMass &&
+		a.CSMRCSFuelRemaining == b.CSMRCSFuelRemaining && a.SPSFuelRemaining == b.SPSFuelRemaining && a.SIVBFuelRemaining == b.SIVBFuelRemaining &&
+		a.LMRCSFuelRemaining == b.LMRCSFuelRemaining && a.LMAPSFuelRemaining == b.LMAPSFuelRemaining && a.LMDPSFuelRemaining == b.LMDPSFuelRemaining;
+}
+
+//Compares the maneuver data that goes into the trajectory integration
+static bool EMSEPHSameManeuver(const MPTManeuver &a, const MPTManeuver &b)
+{
+	if (a.code != b.code || !EMSEPHSameVehicleData(a.CommonBlock, b.CommonBlock)) return false;
+	if (a.AttitudeCode != b.AttitudeCode || a.Thruster != b.Thruster || a.UllageThrusterOpt != b.UllageThrusterOpt || a.AttitudesInput != b.AttitudesInput) return false;
+	if (a.ConfigCodeBefore != b.ConfigCodeBefore || a.TVC != b.TVC || a.TrimAngleInd != b.TrimAngleInd || a.FrozenManeuverInd != b.FrozenManeuverInd) return false;
+	if (a.RefBodyInd != b.RefBodyInd || a.CoordSysInd != b.CoordSysInd || a.HeadsUpDownInd != b.HeadsUpDownInd || a.DockingAngle != b.DockingAngle) return false;
+	if (a.GMTMAN != b.GMTMAN || a.dt_ullage != b.dt_ullage || a.DT_10PCT != b.DT_10PCT || a.dt != b.dt || a.dv != b.dv || a.DPSScaleFactor != b.DPSScaleFactor) return false;
+	if (!EMSEPHSameVector(a.A_T, b.A_T) || !EMSEPHSameVector(a.X_B, b.X_B) || !EMSEPHSameVector(a.Y_B, b.Y_B) || !EMSEPHSameVector(a.Z_B, b.Z_B)) return false;
+	if (!EMSEPHSameVector(a.dV_inertial, b.dV_inertial) || !EMSEPHSameVector(a.dV_LVLH, b.dV_LVLH)) return false;
+	//Words 67 to 84 hold the targeting parameters of TLI and ascent maneuvers
+	if (memcmp(&a.Word67d, &b.Word67d, sizeof(a.Word67d)) || memcmp(&a.Word78d, &b.Word78d, sizeof(a.Word78d))) return false;
+	if (a.Word68 != b.Word68 || a.Word69 != b.Word69 || a.Word70 != b.Word70 || a.Word71 != b.Word71 || a.Word72 != b.Word72 || a.Word73 != b.Word73 ||
+		a.Word74 != b.Word74 || a.Word75 != b.Word75 || a.Word76 != b.Word76 || a.Word77 != b.Word77 || a.Word79 != b.Word79 || a.Word80 != b.Word80 ||
+		a.Word81 != b.Word81 || a.Word82 != b.Word82 || a.Word83 != b.Word83 || a.Word84 != b.Word84) return false;
+	return true;
+}
+
+bool RTCC::EMSEPHResume(int L, EMSMISSInputTable &in)
+{
+	//Finds the last maneuver checkpoint of the main ephemeris which the MPT change didn't affect and sets up the input table to continue from there.
+	//The ephemeris before the checkpoint is kept, returns false if the whole ephemeris has to be generated again
+
+	OrbitEphemerisTable *table;
+	MissionPlanTable *mpt = GetMPTPointer(L);
+
+	if (L == RTCC_MPT_CSM)
+	{
+		table = &EZEPH1;
+	}
+	else
+	{
+		table = &EZEPH2;
+	}
+
+	if (table->CHKPNT.size() == 0 || table->EPHEM.table.size() == 0) return false;
+	//The anchor vector has to be on the current ephemeris
+	if (table->EPHEM.table.front().GMT > in.AnchorVector.GMT || in.landed) return false;
+
+	//Weights and areas before the first maneuver
+	MissionPlanTable *oldmpt = &table->CHKMPT;
+	if (!EMSEPHSameVehicleData(mpt->CommonBlock, oldmpt->CommonBlock) || mpt->TotalInitMass != oldmpt->TotalInitMass || mpt->ConfigurationArea != oldmpt->ConfigurationArea ||
+		mpt->KFactor != oldmpt->KFactor || mpt->LMStagingGMT != oldmpt->LMStagingGMT || mpt->SIVBVentingBeginGET != oldmpt->SIVBVentingBeginGET ||
+		mpt->DeltaDockingAngle != oldmpt->DeltaDockingAngle) return false;
+
+	//Number of leading maneuvers unchanged
+	unsigned n = 0;
+	while (n < mpt->mantable.size() && n < oldmpt->mantable.size() && mpt->TimeToBeginManeuver[n] == oldmpt->TimeToBeginManeuver[n] &&
+		mpt->TimeToEndManeuver[n] == oldmpt->TimeToEndManeuver[n] && EMSEPHSameManeuver(mpt->mantable[n], oldmpt->mantable[n]))
+	{
+		n++;
+	}
+
+	int k;
+	for (k = (int)table->CHKPNT.size() - 1;k >= 0;k--)
+	{
+		const EphemerisCheckpoint &chk = table->CHKPNT[k];
+
+		if (chk.aux.GMT_1 < in.AnchorVector.GMT) return false;
+		if (chk.ManeuverNumber <= n && chk.sv.GMT < in.EphemerisRightLimitGMT) break;
+	}
+	if (k < 0) return false;
+
+	const EphemerisCheckpoint chk = table->CHKPNT[k];
+	const double eps = 0.001;
+	unsigned j;
+
+	//Same left limit as a full run: the present time, or the end of the first maneuver after the anchor vector if that maneuver
+	//begins before the present time, the integration to the present time stops there
+	double LeftLimit = in.EphemerisLeftLimitGMT;
+	for (j = 0;j < table->MANTIMES.Table.size();j++)
+	{
+		if (table->MANTIMES.Table[j].ManData[0] >= in.AnchorVector.GMT)
+		{
+			if (table->MANTIMES.Table[j].ManData[0] < LeftLimit)
+			{
+				LeftLimit = table->MANTIMES.Table[j].ManData[1];
+			}
+			break;
+		}
+	}
+
+	//Vector at the left limit, from the ephemeris before it is cut
+	ELVCTRInputTable interin;
+	ELVCTROutputTable2 interout;
+
+	interin.GMT = LeftLimit;
+	ELVCTR(interin, interout, table->EPHEM, table->MANTIMES, &table->LUNRSTAY);
+	if (interout.ErrorCode) return false;
+
+	//Remove everything after the checkpoint
+	while (table->EPHEM.table.size() > 0 && table->EPHEM.table.back().GMT > chk.sv.GMT + eps)
+	{
+		table->EPHEM.table.pop_back();
+	}
+	while (table->MANTIMES.Table.size() > 0 && table->MANTIMES.Table.back().ManData[1] > chk.sv.GMT + eps)
+	{
+		table->MANTIMES.Table.pop_back();
+	}
+	table->CHKPNT.resize(k + 1);
+
+	//Remove everything before the left limit and start the ephemeris with the vector at it
+	j = 0;
+	while (j < table->EPHEM.table.size() && table->EPHEM.table[j].GMT < LeftLimit + eps)
+	{
+		j++;
+	}
+	table->EPHEM.table.erase(table->EPHEM.table.begin(), table->EPHEM.table.begin() + j);
+	table->EPHEM.table.insert(table->EPHEM.table.begin(), interout.SV);
+
+	//Remove the maneuvers a full run wouldn't integrate, they begin before the anchor vector
+	j = 0;
+	while (j < table->MANTIMES.Table.size() && table->MANTIMES.Table[j].ManData[0] < in.AnchorVector.GMT)
+	{
+		j++;
+	}
+	table->MANTIMES.Table.erase(table->MANTIMES.Table.begin(), table->MANTIMES.Table.begin() + j);
+
+	j = 0;
+	while (j < table->CHKPNT.size() && table->CHKPNT[j].aux.GMT_1 < in.AnchorVector.GMT)
+	{
+		j++;
+	}
+	table->CHKPNT.erase(table->CHKPNT.begin(), table->CHKPNT.begin() + j);
+
+	table->LUNRSTAY = chk.LUNRSTAY;
+
+	//The MPT gets the burn data of the kept maneuvers again, as from a full run
+	for (j = 0;j < table->CHKPNT.size();j++)
+	{
+		RTCCNIAuxOutputTable aux = table->CHKPNT[j].aux;
+		PMMDMT(L, table->CHKPNT[j].ManeuverNumber, &aux);
+	}
+
+	//Continue integration from the end of the maneuver
+	in.AnchorVector = chk.sv;
+	in.landed = chk.landed;
+	in.IgnoreManueverNumber = chk.ManeuverNumber;
+	in.EphemerisLeftLimitGMT = chk.sv.GMT;
+
+	RTCCONLINEMON.TextBuffer[0] = L == RTCC_MPT_CSM ? "CSM" : "LEM";
+	char Buff[64];
+	format_time_rtcc(Buff, chk.sv.GMT);
+	RTCCONLINEMON.TextBuffer[1].assign(Buff);
+	EMGPRINT("EMSEPH", 16);
+
+	return true;
+}
+
+void RTCC::EMSEPHCheckResume(StateVectorTableEntry sv0, int L, double PresentGMT)
+{
+	//Generates the whole ephemeris again after a resumed run and compares it with the resumed one. The step times of the two runs
+	//differ before the checkpoint, so the resumed ephemeris is interpolated at the vectors of the full one. The resumed tables are kept
+
+	OrbitEphemerisTable *table;
+	MissionPlanTable *mpt = GetMPTPointer(L);
+
+	if (L == RTCC_MPT_CSM)
+	{
+		table = &EZEPH1;
+	}
+	else
+	{
+		table = &EZEPH2;
+	}
+
+	OrbitEphemerisTable resumed = *table;
+	MissionPlanTable resumedmpt = *mpt;
+
+	EMSEPH(2, sv0, L, PresentGMT);
+
+	const double eps = 0.001;
+	//Position difference allowed from the different integration steps, 100 ft
+	const double eps_R = 100.0*0.3048;
+	bool same = abs(resumed.EPHEM.Header.TL - table->EPHEM.Header.TL) < eps && abs(resumed.EPHEM.Header.TR - table->EPHEM.Header.TR) < eps &&
+		resumed.MANTIMES.Table.size() == table->MANTIMES.Table.size();
+	double dR_max = 0.0;
+	unsigned i;
+
+	for (i = 0;same && i < resumed.MANTIMES.Table.size();i++)
+	{
+		same = abs(resumed.MANTIMES.Table[i].ManData[0] - table->MANTIMES.Table[i].ManData[0]) < eps &&
+			abs(resumed.MANTIMES.Table[i].ManData[1] - table->MANTIMES.Table[i].ManData[1]) < eps;
+	}
+
+	if (same)
+	{
+		EphemerisInterpolationTable tab;
+		std::vector<double> GMT(table->EPHEM.table.size());
+		std::vector<ELVCTROutputTable2> out;
+
+		ELVCTRLoad(resumed.EPHEM, resumed.MANTIMES, &resumed.LUNRSTAY, tab);
+		for (i = 0;i < GMT.size();i++)
+		{
+			GMT[i] = table->EPHEM.table[i].GMT;
+		}
+		ELVCTR(GMT, 8, out, tab);
+		for (i = 0;i < out.size();i++)
+		{
+			if (out[i].ErrorCode)
+			{
+				same = false;
+				break;
+			}
+			double dR = length(out[i].SV.R - table->EPHEM.table[i].R);
+			if (dR > dR_max) dR_max = dR;
+		}
+		if (dR_max > eps_R) same = false;
+	}
+
+	*table = resumed;
+	*mpt = resumedmpt;
+
+	std::vector<std::string> message;
+	char Buffer[128];
+
+	message.push_back(std::string(L == RTCC_MPT_CSM ? "CSM" : "LEM") + (same ? " RESUMED EPHEMERIS MATCHES REGENERATION" : " RESUMED EPHEMERIS DIFFERS FROM REGENERATION"));
+	sprintf_s(Buffer, "MAX POSITION DIFFERENCE = %.1lf FT", dR_max / 0.3048);
+	message.push_back(Buffer);
+	EMGPRINT("EMSEPH", message);
+}
+
 void RTCC::NewEMSMISS(EMSMISSInputTable *in)
 {
 	RTCC_EMSMISS integrator(this);
@@ -17750,8 +18109,63 @@ int RTCC::EMGVECSTOutput(int L, EphemerisData &sv)
 
 void RTCC::EMMENI(EMMENIInputTable &in)
 {
+	//Integrations building an ephemeris aren't cached, their output is the ephemeris
+	if (in.EphemerisBuildIndicator)
+	{
+		EnckeFreeFlightIntegrator integ(this);
+		integ.Propagate(in);
+		return;
+	}
+
+	EMMENICacheResult res;
+	PropagationCache<21, EMMENICacheResult>::Key key = { in.AnchorVector.R.x, in.AnchorVector.R.y, in.AnchorVector.R.z, in.AnchorVector.V.x, in.AnchorVector.V.y,
+		in.AnchorVector.V.z, in.AnchorVector.GMT, (double)in.AnchorVector.RBI, in.MinIntegTime, in.MaxIntegTime, in.MinEphemDT, in.IsForwardIntegration,
+		in.EarthRelStopParam, in.MoonRelStopParam, (double)in.StopParamRefFrame, in.DensityMultiplier, in.VentPerturbationFactor, (double)in.IntegMode,
+		(double)in.CutoffIndicator, in.Area, in.Weight };
+
+	EMMENICache.Validate(PropagationCacheStamp());
+	if (EMMENICache.Find(key, res))
+	{
+		in.sv_cutoff = res.sv_cutoff;
+		in.TerminationCode = res.TerminationCode;
+		return;
+	}
+
 	EnckeFreeFlightIntegrator integ(this);
 	integ.Propagate(in);
+
+	res.sv_cutoff = in.sv_cutoff;
+	res.TerminationCode = in.TerminationCode;
+	EMMENICache.Store(key, res);
+}
+
+void RTCC::EMMENI(std::vector<EMMENIInputTable> &in)
+{
+	ParallelFor(in.size(), [&](unsigned i)
+	{
+		EMMENI(in[i]);
+	});
+}
+
+unsigned long long RTCC::PropagationCacheStamp()
+{
+	//GMT of the ephemeris and rotation matrices, drag constant, landing site radius for the altitude cutoff
+	double data[4] = { SystemParameters.GMTBASE, SystemParameters.MCADRG, BZLAND.rad[RTCC_LMPOS_BEST], (double)PropagationCacheGeneration };
+	return PropagationCacheHash(data, 4);
+}
+
+void RTCC::GetPropagationCacheCounters(unsigned &hits, unsigned &misses)
+{
+	OrbMech::GetCoastCacheCounters(hits, misses);
+	hits += PMMCENCache.GetHits() + EMMENICache.GetHits();
+	misses += PMMCENCache.GetMisses() + EMMENICache.GetMisses();
+}
+
+void RTCC::ClearPropagationCaches()
+{
+	PMMCENCache.Clear();
+	EMMENICache.Clear();
+	OrbMech::ClearCoastCache();
 }
 
 int RTCC::EMMXTR(double GMT, double rmag, double vmag, double rtasc, double decl, double fpav, double az, VECTOR3 &R, VECTOR3 &V)
@@ -18575,7 +18989,8 @@ RTCC_PMSVCT_15:
 
 	sv1.Vector = sv;
 	sv1.VectorCode = mpt->StationID;
-	EMSTRAJ(sv1, L);
+	//The vector was taken from the current ephemeris, so only the part after the changed maneuvers has to be generated again
+	EMSTRAJ(sv1, L, true);
 }
 
 int RTCC::PMSVEC(int L, double GMT, CELEMENTS &elem, double &KFactor, double &Area, double &Weight, std::string &StaID, int &RBI)
@@ -18972,9 +19387,34 @@ void RTCC::EMGENGEN(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES
 
 	if (stationlist.table.size() == 0) return;
 
-	for (unsigned i = 0;i < stationlist.table.size();i++)
+	//All stations interpolate the same ephemeris
+	EphemerisInterpolationTable tab;
+	ELVCTRLoad(ephemeris, MANTIMES, LUNSTAY, tab);
+
+	//Search the stations on worker threads, each into its own buffer
+	unsigned NumStations = stationlist.table.size();
+	std::vector<std::vector<StationContact>> StationAcquisitions(NumStations);
+	std::vector<std::vector<unsigned>> StationPasses(NumStations);
+
+	ParallelFor(NumStations, [&](unsigned i)
+	{
+		EMXING(ephemeris, tab, stationlist.table[i], body, StationAcquisitions[i], &StationPasses[i]);
+	});
+
+	//Merge in station order. EMXING stops searching a station after the pass which takes the list past 45 contacts, so only take the
+	//passes it would have found with the contacts of the previous stations already in the list
+	for (unsigned i = 0;i < NumStations;i++)
 	{
-		EMXING(ephemeris, MANTIMES, stationlist.table[i], body, acquisitions, LUNSTAY);
+		unsigned num = StationAcquisitions[i].size();
+		for (unsigned j = 0;j < StationPasses[i].size();j++)
+		{
+			if (acquisitions.size() + StationPasses[i][j] > 45)
+			{
+				num = StationPasses[i][j];
+				break;
+			}
+		}
+		acquisitions.insert(acquisitions.end(), StationAcquisitions[i].begin(), StationAcquisitions[i].begin() + num);
 	}
 
 	//Sort
@@ -18996,14 +19436,19 @@ void RTCC::EMGENGEN(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES
 	}
 }
 
-bool RTCC::EMXINGLunarOccultation(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, double gmt, VECTOR3 R_S_equ, double &g_func, LunarStayTimesTable *LUNSTAY)
+bool RTCC::EMXINGLunarOccultation(const EphemerisInterpolationTable &tab, double gmt, VECTOR3 R_S_equ, double &g_func)
 {
 	ELVCTRInputTable interin;
 	ELVCTROutputTable2 interout;
 
 	interin.GMT = gmt;
 	//Interpolate ephemeris
-	ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+	ELVCTR(interin, interout, tab);
+	return EMXINGLunarOccultation(interout, gmt, R_S_equ, g_func);
+}
+
+bool RTCC::EMXINGLunarOccultation(const ELVCTROutputTable2 &interout, double gmt, VECTOR3 R_S_equ, double &g_func)
+{
 	if (interout.ErrorCode > 2) return true;
 	//If radius is smaller than 50 er it can't be occulted by the Moon
 	if (length(interout.SV.R) < 50.0*OrbMech::R_Earth)
@@ -19019,7 +19464,7 @@ bool RTCC::EMXINGLunarOccultation(EphemerisDataTable2 &ephemeris, ManeuverTimesT
 	//Calculate elevation
 	OrbMech::EMXINGElev(interout.SV.R, R_S_equ, N, rho, sinang);
 	//Get moon state vector at interpolation time
-	if (PLEFEM(1, interin.GMT / 3600.0, 0, &sv_E.R, &sv_E.V, &R_ES, NULL))
+	if (PLEFEM(1, gmt / 3600.0, 0, &sv_E.R, &sv_E.V, &R_ES, NULL))
 	{
 		return true;
 	}
@@ -19031,7 +19476,7 @@ bool RTCC::EMXINGLunarOccultation(EphemerisDataTable2 &ephemeris, ManeuverTimesT
 		return false;
 	}
 	//Convert moon state vector to ECT
-	sv_E.GMT = interin.GMT;
+	sv_E.GMT = gmt;
 	if (ELVCNV(sv_E, 0, 1, sv_ET))
 	{
 		return true;
@@ -19044,7 +19489,7 @@ bool RTCC::EMXINGLunarOccultation(EphemerisDataTable2 &ephemeris, ManeuverTimesT
 	return false;
 }
 
-bool RTCC::EMXING(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, const Station &station, int body, std::vector<StationContact> &acquisitions, LunarStayTimesTable *LUNSTAY)
+bool RTCC::EMXING(EphemerisDataTable2 &ephemeris, const EphemerisInterpolationTable &tab, const Station &station, int body, std::vector<StationContact> &acquisitions, std::vector<unsigned> *passes)
 {
 	if (ephemeris.table.size() == 0) return false;
 	//Has to be ECT or MCT
@@ -19098,7 +19543,7 @@ EMXING_LOOP:
 		{
 			GMT_EMAX = OrbMech::LinearInterpolation(f, GMT, last_f, LastGMT, 0.0);
 			interin.GMT = GMT_EMAX;
-			ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+			ELVCTR(interin, interout, tab);
 			if (interout.ErrorCode)
 			{
 				return false;
@@ -19133,7 +19578,7 @@ EMXING_LOOP:
 	{
 		GMT_AOS = OrbMech::LinearInterpolation(sinang, GMT, LastSinang, LastGMT, 0.0);
 		interin.GMT = GMT_AOS;
-		ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+		ELVCTR(interin, interout, tab);
 		if (interout.ErrorCode)
 		{
 			return false;
@@ -19152,7 +19597,7 @@ EMXING_LOOP:
 
 			GMT_AOS = OrbMech::LinearInterpolation(sinang, GMT, LastSinang, LastGMT, 0.0);
 			interin.GMT = GMT_AOS;
-			ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+			ELVCTR(interin, interout, tab);
 			if (interout.ErrorCode)
 			{
 				return false;
@@ -19191,7 +19636,7 @@ EMXING_LOOP:
 		{
 			GMT_EMAX = OrbMech::LinearInterpolation(f, GMT, last_f, LastGMT, 0.0);
 			interin.GMT = GMT_EMAX;
-			ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+			ELVCTR(interin, interout, tab);
 			if (interout.ErrorCode)
 			{
 				return false;
@@ -19231,7 +19676,7 @@ EMXING_LOOP:
 
 				GMT_EMAX = OrbMech::LinearInterpolation(f, GMT, last_f, LastGMT, 0.0);
 				interin.GMT = GMT_EMAX;
-				ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+				ELVCTR(interin, interout, tab);
 				if (interout.ErrorCode)
 				{
 					return false;
@@ -19277,7 +19722,7 @@ EMXING_LOOP:
 	{
 		GMT_LOS = OrbMech::LinearInterpolation(sinang, GMT, LastSinang, LastGMT, 0.0);
 		interin.GMT = GMT_LOS;
-		ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+		ELVCTR(interin, interout, tab);
 		if (interout.ErrorCode)
 		{
 			return false;
@@ -19296,7 +19741,7 @@ EMXING_LOOP:
 
 			GMT_LOS = OrbMech::LinearInterpolation(sinang, GMT, LastSinang, LastGMT, 0.0);
 			interin.GMT = GMT_LOS;
-			ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+			ELVCTR(interin, interout, tab);
 			if (interout.ErrorCode)
 			{
 				return false;
@@ -19333,8 +19778,32 @@ EMXING_LOOP:
 			iter2++;
 		}
 
+		//The occultation is checked at every ephemeris vector from here to the first one at or after LOS, interpolate them all in one batch
+		std::vector<double> OccGMT;
+		std::vector<ELVCTROutputTable2> OccSV;
+		for (unsigned k = iter2;k < ephemeris.table.size();k++)
+		{
+			OccGMT.push_back(ephemeris.table[k].GMT);
+			if (ephemeris.table[k].GMT >= GMT_LOS) break;
+		}
+		ELVCTR(OccGMT, 8, OccSV, tab);
+
+		//Batch results at the ephemeris vectors, interpolated individually at any other time
+		auto Occultation = [&](double gmt, double &g)
+		{
+			auto it = std::lower_bound(OccGMT.begin(), OccGMT.end(), gmt);
+			if (it != OccGMT.end() && *it == gmt)
+			{
+				EMXINGLunarOccultation(OccSV[it - OccGMT.begin()], gmt, R_S_equ, g);
+			}
+			else
+			{
+				EMXINGLunarOccultation(tab, gmt, R_S_equ, g);
+			}
+		};
+
 		//Look if already in AOS at horizon crossing
-		EMXINGLunarOccultation(ephemeris, MANTIMES, GMT_iter2, R_S_equ, g_func, LUNSTAY);
+		Occultation(GMT_iter2, g_func);
 		if (g_func >= 0)
 		{
 			goto RTCC_EMXING_LUNAR_LOS1;
@@ -19347,7 +19816,7 @@ EMXING_LOOP:
 		//Find AOS
 		while (g_func < 0)
 		{
-			EMXINGLunarOccultation(ephemeris, MANTIMES, GMT_iter2, R_S_equ, g_func, LUNSTAY);
+			Occultation(GMT_iter2, g_func);
 			if (g_func >= 0)
 			{
 				break;
@@ -19367,7 +19836,7 @@ EMXING_LOOP:
 		GMT_iter2 = OrbMech::LinearInterpolation(g_func, GMT_iter2, g_func_last, LastGMT_lunar, 0.0);
 		do
 		{
-			EMXINGLunarOccultation(ephemeris, MANTIMES, GMT_iter2, R_S_equ, g_func, LUNSTAY);
+			Occultation(GMT_iter2, g_func);
 			GMT_new = GMT_iter2;
 			GMT_iter2 = OrbMech::LinearInterpolation(g_func, GMT_iter2, g_func_last, LastGMT_lunar, 0.0);
 		} while (abs(GMT_new - GMT_iter2) > 3.0);
@@ -19385,7 +19854,7 @@ EMXING_LOOP:
 		GMT_iter2 = ephemeris.table[iter2].GMT;
 		while (g_func >= 0)
 		{
-			EMXINGLunarOccultation(ephemeris, MANTIMES, GMT_iter2, R_S_equ, g_func, LUNSTAY);
+			Occultation(GMT_iter2, g_func);
 			if (g_func < 0)
 			{
 				break;
@@ -19406,7 +19875,7 @@ EMXING_LOOP:
 		GMT_iter2 = OrbMech::LinearInterpolation(g_func, GMT_iter2, g_func_last, LastGMT_lunar, 0.0);
 		do
 		{
-			EMXINGLunarOccultation(ephemeris, MANTIMES, GMT_iter2, R_S_equ, g_func, LUNSTAY);
+			Occultation(GMT_iter2, g_func);
 			GMT_new = GMT_iter2;
 			GMT_iter2 = OrbMech::LinearInterpolation(g_func, GMT_iter2, g_func_last, LastGMT_lunar, 0.0);
 		} while (abs(GMT_new - GMT_iter2) > 3.0);
@@ -19450,7 +19919,7 @@ EMXING_LOOP:
 			}
 			//Calculate EMAX
 			interin.GMT = current.GMTEMAX;
-			ELVCTR(interin, interout, ephemeris, MANTIMES, LUNSTAY);
+			ELVCTR(interin, interout, tab);
 			OrbMech::EMXINGElev(interout.SV.R, R_S_equ, N, rho, sinang);
 			current.MAXELEV = asin(sinang);
 		}
@@ -19485,6 +19954,11 @@ EMXING_LOOP:
 
 RTCC_EMXING_END:
 
+	if (passes)
+	{
+		passes->push_back(acquisitions.size());
+	}
+
 	if (iter < ephemeris.table.size() && acquisitions.size() <= 45)
 	{
 		goto EMXING_LOOP;
@@ -23108,6 +23582,9 @@ int RTCC::EMMENV(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, d
 		return 1;
 	}
 
+	EphemerisInterpolationTable tab;
+	ELVCTRLoad(ephemeris, MANTIMES, NULL, tab);
+
 	//Find vector at starting GMT
 	while (ephemeris.table[iter].GMT < GMT_begin)
 	{
@@ -23197,7 +23674,7 @@ int RTCC::EMMENV(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, d
 				GMT_old = sv_cur.GMT;
 
 				interin.GMT = GMT;
-				ELVCTR(interin, interout, ephemeris, MANTIMES);
+				ELVCTR(interin, interout, tab);
 				if (interout.ErrorCode)
 				{
 					return 4;
@@ -23227,7 +23704,7 @@ int RTCC::EMMENV(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, d
 			GMT = GMT_old + 10.0;
 
 			interin.GMT = GMT;
-			ELVCTR(interin, interout, ephemeris, MANTIMES);
+			ELVCTR(interin, interout, tab);
 			if (interout.ErrorCode)
 			{
 				return 4;
@@ -23245,7 +23722,7 @@ int RTCC::EMMENV(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, d
 				GMT_old = sv_cur.GMT;
 
 				interin.GMT = GMT;
-				ELVCTR(interin, interout, ephemeris, MANTIMES);
+				ELVCTR(interin, interout, tab);
 				if (interout.ErrorCode)
 				{
 					return 4;
@@ -30794,6 +31271,10 @@ void RTCC::EMGPRINT(std::string source, int i)
 		message.push_back(RTCCONLINEMON.TextBuffer[0] + " EPHEMERIS LIMITS");
 		message.push_back(RTCCONLINEMON.TextBuffer[1] + " TO " + RTCCONLINEMON.TextBuffer[2] + " GMT");
 		break;
+	case 16:
+		message.push_back(RTCCONLINEMON.TextBuffer[0] + " EPHEMERIS KEPT UP TO");
+		message.push_back(RTCCONLINEMON.TextBuffer[1] + " GMT");
+		break;
 	case 17:
 		message.push_back("ERROR RETURN FROM MANEUVER");
 		sprintf_s(Buffer, "INTEGRATOR, ERROR CODE = %d", RTCCONLINEMON.IntBuffer[0]);
@@ -35095,7 +35576,31 @@ void RTCC::QMEPHEM(int EPOCH, int YEAR, int MONTH, int DAY, double HOURS)
 	double J_D = OrbMech::TJUDAT(YEAR, MONTH, DAY);
 	double gmtbase = J_D - 2400000.5;
 	QMGEPH(EPOCH, gmtbase, HOURS);
+	QMCHEPH(EPOCH, gmtbase, YEAR, MONTH, DAY);
 	QMPNREAD(gmtbase);
+	PropagationCacheGeneration++;
+}
+
+void RTCC::QMCHEPH(int epoch, double gmtbase, int YEAR, int MONTH, int DAY)
+{
+	char Buff[128];
+
+	//The series only depend on launch day and epoch, so they are only fitted the first time
+	sprintf_s(Buff, ".\\Config\\ProjectApollo\\RTCC\\%d-%02d-%02d Ephemeris.bin", YEAR, MONTH, DAY);
+	if (MDGCHEB.Load(Buff, epoch, gmtbase - 5.0))
+	{
+		return;
+	}
+
+	MATRIX3 Rot_J_B = OrbMech::J2000EclToBRCS(epoch);
+	MDGCHEB.Generate(epoch, gmtbase - 5.0, [&](double MJD, double *data) { QMGEPHPoint(MJD, Rot_J_B, data); });
+
+	if (!MDGCHEB.Save(Buff))
+	{
+		char LogBuff[256];
+		sprintf(LogBuff, "(RTCC) Couldn't save Sun/Moon ephemeris %s", Buff);
+		oapiWriteLog(LogBuff);
+	}
 }
 
 void RTCC::QMPNREAD(double gmtbase)
@@ -35125,17 +35630,7 @@ void RTCC::QMPNREAD(double gmtbase)
 
 bool RTCC::QMGEPH(int epoch, double gmtbase, double HOURS)
 {
-	MATRIX3 Rot_J_B, Rot_SG_ECL, R_LIB;
-	VECTOR3 R_EM, R_ES, V_EM;
-	double MJD, MoonPos[12], EarthPos[12];
-	OBJHANDLE hMoon, hEarth;
-	CELBODY *cMoon, *cEarth;
-
-	hMoon = oapiGetObjectByName("Moon");
-	hEarth = oapiGetObjectByName("Earth");
-
-	cMoon = oapiGetCelbodyInterface(hMoon);
-	cEarth = oapiGetCelbodyInterface(hEarth);
+	MATRIX3 Rot_J_B;
 
 	//Store beginning time of ephemeris
 	MDGSUN.MJD = gmtbase - 5.0;
@@ -35145,32 +35640,7 @@ bool RTCC::QMGEPH(int epoch, double gmtbase, double HOURS)
 
 	for (int i = 0;i < 71;i++)
 	{
-		MJD = MDGSUN.MJD + 0.5*(double)(i);
-
-		//Moon Ephemeris
-		cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS, MoonPos);
-		R_EM = _V(MoonPos[0], MoonPos[2], MoonPos[1]) / OrbMech::R_Earth;
-		V_EM = _V(MoonPos[3], MoonPos[5], MoonPos[4]) / OrbMech::R_Earth*3600.0;
-		//R_EM = mul(Rot_J_B, R_EM);
-		//V_EM = mul(Rot_J_B, V_EM);
-
-		//Sun Ephemeris
-		cEarth->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
-		R_ES = -OrbMech::Polar2Cartesian(EarthPos[2] * AU, EarthPos[1], EarthPos[0]) / OrbMech::R_Earth;
-		//R_ES = mul(Rot_J_B, R_ES);
-
-		//Libration matrix (already in NBY coordinates, so don't use yet!)
-		Rot_SG_ECL = OrbMech::GetRotationMatrix(BODY_MOON, MJD);
-		Rot_SG_ECL = MatrixRH_LH(Rot_SG_ECL);
-		R_LIB = mul(Rot_J_B, Rot_SG_ECL);
-
-		//Write data
-		MDGSUN.data[i][0] = R_ES.x; MDGSUN.data[i][1] = R_ES.y; MDGSUN.data[i][2] = R_ES.z;
-		MDGSUN.data[i][3] = R_EM.x; MDGSUN.data[i][4] = R_EM.y; MDGSUN.data[i][5] = R_EM.z;
-		MDGSUN.data[i][6] = V_EM.x; MDGSUN.data[i][7] = V_EM.y; MDGSUN.data[i][8] = V_EM.z;
-		MDGSUN.data[i][9] = R_LIB.m11; MDGSUN.data[i][10] = R_LIB.m12; MDGSUN.data[i][11] = R_LIB.m13;
-		MDGSUN.data[i][12] = R_LIB.m21; MDGSUN.data[i][13] = R_LIB.m22; MDGSUN.data[i][14] = R_LIB.m23;
-		MDGSUN.data[i][15] = R_LIB.m31; MDGSUN.data[i][16] = R_LIB.m32; MDGSUN.data[i][17] = R_LIB.m33;
+		QMGEPHPoint(MDGSUN.MJD + 0.5*(double)(i), Rot_J_B, MDGSUN.data[i]);
 	}
 
 	//MCCBES stored as the time of midnight on launch day since beginning of the year
@@ -35178,6 +35648,42 @@ bool RTCC::QMGEPH(int epoch, double gmtbase, double HOURS)
 	return false;
 }
 
+void RTCC::QMGEPHPoint(double MJD, const MATRIX3 &Rot_J_B, double *data)
+{
+	MATRIX3 Rot_SG_ECL, R_LIB;
+	VECTOR3 R_EM, R_ES, V_EM;
+	double MoonPos[12], EarthPos[12];
+	CELBODY *cMoon, *cEarth;
+
+	cMoon = oapiGetCelbodyInterface(oapiGetObjectByName("Moon"));
+	cEarth = oapiGetCelbodyInterface(oapiGetObjectByName("Earth"));
+
+	//Moon Ephemeris
+	cMoon->clbkEphemeris(MJD, EPHEM_TRUEPOS, MoonPos);
+	R_EM = _V(MoonPos[0], MoonPos[2], MoonPos[1]) / OrbMech::R_Earth;
+	V_EM = _V(MoonPos[3], MoonPos[5], MoonPos[4]) / OrbMech::R_Earth*3600.0;
+	//R_EM = mul(Rot_J_B, R_EM);
+	//V_EM = mul(Rot_J_B, V_EM);
+
+	//Sun Ephemeris
+	cEarth->clbkEphemeris(MJD, EPHEM_TRUEPOS | EPHEM_TRUEVEL, EarthPos);
+	R_ES = -OrbMech::Polar2Cartesian(EarthPos[2] * AU, EarthPos[1], EarthPos[0]) / OrbMech::R_Earth;
+	//R_ES = mul(Rot_J_B, R_ES);
+
+	//Libration matrix (already in NBY coordinates, so don't use yet!)
+	Rot_SG_ECL = OrbMech::GetRotationMatrix(BODY_MOON, MJD);
+	Rot_SG_ECL = MatrixRH_LH(Rot_SG_ECL);
+	R_LIB = mul(Rot_J_B, Rot_SG_ECL);
+
+	//Write data
+	data[0] = R_ES.x; data[1] = R_ES.y; data[2] = R_ES.z;
+	data[3] = R_EM.x; data[4] = R_EM.y; data[5] = R_EM.z;
+	data[6] = V_EM.x; data[7] = V_EM.y; data[8] = V_EM.z;
+	data[9] = R_LIB.m11; data[10] = R_LIB.m12; data[11] = R_LIB.m13;
+	data[12] = R_LIB.m21; data[13] = R_LIB.m22; data[14] = R_LIB.m23;
+	data[15] = R_LIB.m31; data[16] = R_LIB.m32; data[17] = R_LIB.m33;
+}
+
 bool RTCC::CalculateAGSKFactor(agc_t *agc, ags_t *aea, double &KFactor)
 {
 	//This function only works in a thread
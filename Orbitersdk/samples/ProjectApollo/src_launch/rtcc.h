@@ -42,6 +42,8 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "../src_rtccmfd/RTCCSystemParameters.h"
 #include "../src_rtccmfd/GeneralPurposeManeuver.h"
 #include "../src_rtccmfd/LWP.h"
+#include "../src_rtccmfd/SunMoonEphemeris.h"
+#include "../src_rtccmfd/PropagationCache.h"
 #include "MCCPADForms.h"
 
 class Saturn;
@@ -2098,6 +2100,18 @@ struct LunarStayTimesTable
 	double LunarStayEndGMT = -1;
 };
 
+//Integrator state at the end of a maneuver in the main ephemeris
+struct EphemerisCheckpoint
+{
+	EphemerisData sv;
+	bool landed;
+	//Maneuver number of the maneuver that ended
+	unsigned ManeuverNumber;
+	LunarStayTimesTable LUNRSTAY;
+	//Maneuver integrator output, for the DMT processor when the ephemeris is continued from here
+	RTCCNIAuxOutputTable aux;
+};
+
 struct CapeCrossingTable
 {
 	CapeCrossingTable();
@@ -2495,6 +2509,19 @@ struct ELVCTROutputTable2
 	int TUP;
 };
 
+//Ephemeris with its maneuver and lunar stay times, stored as arrays for batch interpolation
+struct EphemerisInterpolationTable
+{
+	EphemerisHeader Header;
+	ManeuverTimesTable MANTIMES;
+	LunarStayTimesTable LUNRSTAY;
+	bool LunarStay = false;
+	std::vector<double> GMT;
+	//Position and velocity components
+	std::vector<double> R[3];
+	std::vector<double> V[3];
+};
+
 class RTCC {
 
 	friend class MCC;
@@ -2536,6 +2563,10 @@ public:
 	void EntryTargeting(EntryOpt *opt, EntryResults *res);//VECTOR3 &dV_LVLH, double &P30TIG, double &latitude, double &longitude, double &GET05G, double &RTGO, double &VIO, double &ReA, int &precision);
 	void BlockDataProcessor(EarthEntryOpt *opt, EntryResults *res);
 	void TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass);
+	//Calculates several TLMCC options concurrently and stores them in the display columns from the selected one on
+	void TranslunarMidcourseCorrectionProcessor(EphemerisData sv0, double CSMmass, double LMmass, const std::vector<int> &modes, std::vector<TLMCCOutputData> &out);
+	void TLMCCInputs(int mode, const EphemerisData &sv0, double CSMmass, double LMmass, TLMCCDataTable &datatab, TLMCCMEDQuantities &medquant, TLMCCMissionConstants &mccconst);
+	void TLMCCStoreColumn(int column, const TLMCCOutputData &out);
 	int LunarDescentPlanningProcessor(SV sv);
 	bool GeneralManeuverProcessor(GMPOpt *opt, VECTOR3 &dV_i, double &P30TIG);
 	OBJHANDLE AGCGravityRef(VESSEL* vessel); // A sun referenced state vector wouldn't be much of a help for the AGC...
@@ -2735,6 +2766,8 @@ public:
 	int PMMLDP(PMMLDPInput in, MPTManeuver &man);
 	//Coast Numerical Integrator
 	void PMMCEN(EphemerisData sv, double tmin, double tmax, int opt, double endcond, double dir, EphemerisData &sv_out, int &ITS);
+	//Coast integrator for several trajectories at once, integrated in lockstep with shared ephemerides
+	void PMMCEN(PMMCENBatchTable &tab);
 	//Freeze, Unfreeze, Delete Processor
 	void PMMFUD(int veh, unsigned man, int action, std::string StationID);
 	//Vehicle Orientation Change Processor
@@ -2759,15 +2792,22 @@ public:
 	void GMSPRINT(std::string source, int n);
 	void GMSPRINT(std::string source, std::vector<std::string> message);
 	//Trajectory Update Control Module
-	void EMSTRAJ(StateVectorTableEntry sv, int L);
+	void EMSTRAJ(StateVectorTableEntry sv, int L, bool TrajectoryUpdate = false);
 	//Ephemeris Storage and Control Module
 	StateVectorTableEntry EMSEPH(int QUEID, StateVectorTableEntry sv0, int L, double PresentGMT);
+	bool EMSEPHResume(int L, EMSMISSInputTable &in);
+	void EMSEPHCheckResume(StateVectorTableEntry sv0, int L, double PresentGMT);
 	//Miscellaneous Numerical Integration Control Module
 	void NewEMSMISS(EMSMISSInputTable *in);
 	//Lunar Surface Ephemeris Generator
 	void EMSLSF(EMSLSFInputTable &in);
 	//Encke Integrator
 	void EMMENI(EMMENIInputTable &in);
+	//Encke integrator for several input tables at once. Runs one integrator per table on parallel threads, the tables can't share ephemeris tables
+	void EMMENI(std::vector<EMMENIInputTable> &in);
+	//Hits and misses of the result caches of PMMCEN, EMMENI and oneclickcoast
+	void GetPropagationCacheCounters(unsigned &hits, unsigned &misses);
+	void ClearPropagationCaches();
 	//Spherical to inertial conversion
 	int EMMXTR(double GMT, double rmag, double vmag, double rtasc, double decl, double fpav, double az, VECTOR3 &R, VECTOR3 &V);
 	//Orbital Elements Computations
@@ -2897,7 +2937,9 @@ public:
 	//Vector Count Routine
 	int ELNMVC(double &TL, double TR, int L, unsigned &NumVec, int &TUP);
 	//Variable Order Interpolation
-	int ELVARY(EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out);
+	int ELVARY(const EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out);
+	//Interpolation in the part of the ephemeris given by window
+	int ELVARY(const EphemerisDataTable2 &EPH, const EphemerisHeader &window, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out);
 	//Generalized Coordinate System Conversion Subroutine
 	int ELVCNV(std::vector<EphemerisData2> &svtab, int in, int out, std::vector<EphemerisData2> &svtab_out);
 	int ELVCNV(EphemerisData &sv, int out, EphemerisData &sv_out);
@@ -2906,7 +2948,12 @@ public:
 	int ELVCNV(VECTOR3 vec, double GMT, int type, int in, int out, VECTOR3 &vec_out);
 	//Extended Interpolation Routine
 	void ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out);
-	void ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, EphemerisDataTable2 &EPH, ManeuverTimesTable &mantimes, LunarStayTimesTable *LUNRSTAY = NULL);
+	void ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, const EphemerisDataTable2 &EPH, ManeuverTimesTable &mantimes, LunarStayTimesTable *LUNRSTAY = NULL);
+	void ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, const EphemerisInterpolationTable &tab);
+	//Batch interpolation at times in ascending order, with the same results as ELVCTR at each of them
+	void ELVCTR(const std::vector<double> &GMT, unsigned ORER, std::vector<ELVCTROutputTable2> &out, const EphemerisInterpolationTable &tab);
+	//Load an ephemeris for batch interpolation
+	void ELVCTRLoad(const EphemerisDataTable2 &EPH, const ManeuverTimesTable &mantimes, const LunarStayTimesTable *LUNRSTAY, EphemerisInterpolationTable &tab);
 	// MISSION CONTROL (G)
 	//Fixed Point Centiseconds to Floating Point Hours
 	double GLCSTH(double FIXCSC);
@@ -3034,6 +3081,10 @@ public:
 	void QMEPHEM(int EPOCH, int YEAR, int MONTH, int DAY, double HOURS);
 	//Sun-Moon ephemeris offline
 	bool QMGEPH(int epoch, double gmtbase, double HOURS);
+	//Sun-Moon ephemeris data at one time, in the format of the MDGSUN table
+	void QMGEPHPoint(double MJD, const MATRIX3 &Rot_J_B, double *data);
+	//Sun-Moon Chebyshev ephemeris for the mission span, from file or generated
+	void QMCHEPH(int epoch, double gmtbase, int YEAR, int MONTH, int DAY);
 	//Reading of P&N ephemeris table
 	void QMPNREAD(double gmtbase);
 
@@ -3662,6 +3713,10 @@ public:
 		EphemerisDataTable2 EPHEM;
 		ManeuverTimesTable MANTIMES;
 		LunarStayTimesTable LUNRSTAY;
+		//Checkpoints at the end of each maneuver, used to only regenerate the ephemeris after an edited maneuver
+		std::vector<EphemerisCheckpoint> CHKPNT;
+		//MPT at the time the checkpoints were stored
+		MissionPlanTable CHKMPT;
 	} EZEPH1, EZEPH2;
 
 	struct NutationPrecessionMatrices
@@ -4672,6 +4727,27 @@ public:
 		double data[71][18];
 	} MDGSUN;
 
+	//Chebyshev series of the MDGSUN data for 40 days, used by PLEFEM when it covers the time
+	SunMoonChebyshevEphemeris MDGCHEB;
+
+	//Results of the last coast integrations
+	struct PMMCENCacheResult
+	{
+		EphemerisData sv_out;
+		int ITS;
+	};
+	PropagationCache<13, PMMCENCacheResult> PMMCENCache;
+	struct EMMENICacheResult
+	{
+		EphemerisData sv_cutoff;
+		int TerminationCode;
+	};
+	PropagationCache<21, EMMENICacheResult> EMMENICache;
+	//Incremented when the ephemeris or system parameters are loaded
+	unsigned PropagationCacheGeneration;
+	//Hash of the data the integrators use besides their inputs
+	unsigned long long PropagationCacheStamp();
+
 	//System parameters for PDI
 	LGCDescentConstants RTCCDescentTargets;
 	LGCIgnitionConstants RTCCPDIIgnitionTargets;
@@ -4756,8 +4832,10 @@ private:
 	//Generalized Contact Generator
 	void EMGENGEN(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, const StationTable &stationlist, int body, OrbitStationContactsTable &res, LunarStayTimesTable *LUNSTAY = NULL);
 	//Horizon Crossing Subprogram
-	bool EMXING(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, const Station & station, int body, std::vector<StationContact> &acquisitions, LunarStayTimesTable *LUNSTAY);
-	bool EMXINGLunarOccultation(EphemerisDataTable2 &ephemeris, ManeuverTimesTable &MANTIMES, double gmt, VECTOR3 R_S_equ, double &g_func, LunarStayTimesTable *LUNSTAY);
+	//Passes gets the number of contacts in the list after each pass of the station
+	bool EMXING(EphemerisDataTable2 &ephemeris, const EphemerisInterpolationTable &tab, const Station & station, int body, std::vector<StationContact> &acquisitions, std::vector<unsigned> *passes = NULL);
+	bool EMXINGLunarOccultation(const EphemerisInterpolationTable &tab, double gmt, VECTOR3 R_S_equ, double &g_func);
+	bool EMXINGLunarOccultation(const ELVCTROutputTable2 &interout, double gmt, VECTOR3 R_S_equ, double &g_func);
 	int CapeCrossingRev(int L, double GMT);
 	double CapeCrossingGMT(int L, int rev);
 	double CapeCrossingFirst(int L);
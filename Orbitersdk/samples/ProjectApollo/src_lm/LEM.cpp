@@ -42,6 +42,7 @@
 #include "LEM.h"
 #include "tracer.h"
 #include "papi.h"
+#include "panelsurfacecache.h"
 #include "Mission.h"
 
 #include "connector.h"
@@ -474,6 +475,8 @@ LEM::LEM(OBJHANDLE hObj, int fmodel) : Payload (hObj, fmodel),
 	dllhandle = g_Param.hDLL; // DS20060413 Save for later
 	InitLEMCalled = false;
 
+	PanelSurfaceCache::AddOwner();
+
 	//Mission File
 	InitMissionManagementMemory();
 	pMission = paGetDefaultMission();
@@ -504,6 +507,11 @@ LEM::~LEM()
 {
 	ReleaseSurfaces();
 	ReleaseSurfacesVC();
+	PanelSurfaceCache::RemoveOwner();
+
+	char buffer[100];
+	sprintf(buffer, "(LEM) Animation changes per timestep: %.2f average, %d last", MainPanelVC.GetAverageAnimationUpdates(), MainPanelVC.GetAnimationUpdates());
+	oapiWriteLog(buffer);
 
 	ClearMissionManagementMemory();
 
@@ -1299,6 +1307,8 @@ void LEM::clbkPostStep(double simt, double simdt, double mjd)
 	{
 		MainPanelVC.OnPostStep(simt, simdt, mjd);
 	}
+	// Pass all animation changes of this timestep to Orbiter
+	MainPanelVC.FlushAnimations();
 
 	//
 	// Camera jostle.
@@ -1974,6 +1984,23 @@ bool LEM::ProcessConfigFileLine(FILEHANDLE scn, char *line)
 		sscanf (line+11, "%d", &value);
 		isMultiThread=(value>0)?true:false;
 	}
+	else if (!strnicmp (line, "PCMARCHIVE", 10)) {
+		char fname[256];
+		if (sscanf (line+10, "%255s", fname) == 1) {
+			PCM.OpenArchive(fname);
+		}
+	}
+	else if (!strnicmp (line, "PCMDECIMATED", 12)) {
+		int value;
+		sscanf (line+12, "%d", &value);
+		PCM.SetDecimated(value > 0);
+	}
+	else if (!strnicmp (line, "PCMFILE", 7)) {
+		char fname[256];
+		if (sscanf (line+7, "%255s", fname) == 1) {
+			PCM.OpenDownlinkFile(fname);
+		}
+	}
 	else if (!strnicmp (line, "JOYSTICK_RHC", 12)) {
 		sscanf (line + 12, "%i", &rhc_id);
 		if(rhc_id > 1){ rhc_id = 1; } // Be paranoid
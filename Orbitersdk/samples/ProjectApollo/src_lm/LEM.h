@@ -518,6 +518,21 @@ public:
 	int  clbkConsumeBufferedKey(DWORD key, bool down, char *kstate);
 	void clbkPreStep (double simt, double simdt, double mjd);
 	void clbkPostStep(double simt, double simdt, double mjd);
+
+	///
+	/// \brief Queue an animation change of the timestep, see PanelSwitchesVC::QueueAnimation.
+	///
+	void QueueAnimation(UINT anim, double state) { MainPanelVC.QueueAnimation(this, anim, state); };
+
+	///
+	/// \brief Set an animation state outside of the timestep, see PanelSwitchesVC::ApplyAnimation.
+	///
+	void ApplyAnimation(UINT anim, double state) { MainPanelVC.ApplyAnimation(this, anim, state); };
+
+	///
+	/// \brief Set an animation state from a VC redraw event, see PanelSwitchesVC::UpdateAnimation.
+	///
+	void UpdateAnimation(UINT anim, double state) { MainPanelVC.UpdateAnimation(this, anim, state); };
 	void clbkLoadStateEx (FILEHANDLE scn, void *vs);
 	void clbkSetClassCaps (FILEHANDLE cfg);
 	void clbkSaveState (FILEHANDLE scn);
@@ -620,6 +635,11 @@ public:
 	APSPropellantSource *GetAPSPropellant() { return &APSPropellant; };
 	DPSPropellantSource *GetDPSPropellant() { return &DPSPropellant; };
 
+	///
+	/// \brief Thread-safe in-process uplink to the LGC, used by MCC and the MFDs.
+	///
+	PCMUplinkQueue *GetUplinkQueue() { return &PCM.uplink; };
+
 	///
 	/// \brief Triggers Virtual AGC core dump
 	///
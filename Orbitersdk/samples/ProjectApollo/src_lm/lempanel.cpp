@@ -34,6 +34,7 @@
 
 #include "soundlib.h"
 #include "toggleswitch.h"
+#include "panelsurfacecache.h"
 #include "apolloguidance.h"
 #include "lm_channels.h"
 #include "LEMcomputer.h"
@@ -43,6 +44,7 @@
 #include "LEM.h"
  
 #define LOADBMP(id) (LoadBitmap (g_Param.hDLL, MAKEINTRESOURCE (id)))
+#define LOADSRF(id) (PanelSurfaceCache::LoadBitmapSurface (g_Param.hDLL, id))
 
 static GDIParams g_Param;
 
@@ -1220,7 +1222,7 @@ void LEM::ReleaseSurfaces ()
 {
 	for (int i = 0; i < nsurf; i++)
 		if (srf[i]) {
-			oapiDestroySurface (srf[i]);
+			PanelSurfaceCache::ReleaseSurface (srf[i]);
 			srf[i] = 0;
 		}
 }
@@ -1229,142 +1231,142 @@ void LEM::InitPanel (int panel)
 
 {
     // LEM Main Panel
-		srf[0]						= oapiCreateSurface (LOADBMP (IDB_ECSG));
-		srf[SRF_INDICATOR]			= oapiCreateSurface (LOADBMP (IDB_INDICATOR));
-		srf[SRF_NEEDLE]				= oapiCreateSurface (LOADBMP (IDB_NEEDLE1));
-		srf[SRF_DIGITAL]			= oapiCreateSurface (LOADBMP (IDB_DIGITAL));
-		srf[SRF_SWITCHUP]			= oapiCreateSurface (LOADBMP (IDB_SWITCHUP));
+		srf[0]						= LOADSRF (IDB_ECSG);
+		srf[SRF_INDICATOR]			= LOADSRF (IDB_INDICATOR);
+		srf[SRF_NEEDLE]				= LOADSRF (IDB_NEEDLE1);
+		srf[SRF_DIGITAL]			= LOADSRF (IDB_DIGITAL);
+		srf[SRF_SWITCHUP]			= LOADSRF (IDB_SWITCHUP);
 		// Unused surface 5 was
-		// srf[5]						= oapiCreateSurface (LOADBMP (IDB_FDAI));
-		srf[SRF_LIGHTS2]			= oapiCreateSurface (LOADBMP (IDB_LIGHTS2));
-		srf[SRF_LEMSWITCH1]			= oapiCreateSurface (LOADBMP (IDB_LEMSWITCH1));
-		srf[SRF_LEMSWTICH3]			= oapiCreateSurface (LOADBMP (IDB_LEMSWITCH3));
+		// srf[5]						= LOADSRF (IDB_FDAI);
+		srf[SRF_LIGHTS2]			= LOADSRF (IDB_LIGHTS2);
+		srf[SRF_LEMSWITCH1]			= LOADSRF (IDB_LEMSWITCH1);
+		srf[SRF_LEMSWTICH3]			= LOADSRF (IDB_LEMSWITCH3);
 		// Unused surface 7 was
-		// srf[7]						= oapiCreateSurface (LOADBMP (IDB_SWLEVER));
-		srf[SRF_SECSWITCH]			= oapiCreateSurface (LOADBMP (IDB_SECSWITCH));
-		// srf[9]						= oapiCreateSurface (LOADBMP (IDB_ABORT));
-		// srf[10]						= oapiCreateSurface (LOADBMP (IDB_ANNUN));
-		// srf[11]						= oapiCreateSurface (LOADBMP (IDB_LAUNCH));		
-		srf[SRF_LMTWOPOSLEVER]		= oapiCreateSurface (LOADBMP (IDB_LEMSWITCH2));
-		// srf[12]						= oapiCreateSurface (LOADBMP (IDB_LV_ENG));
+		// srf[7]						= LOADSRF (IDB_SWLEVER);
+		srf[SRF_SECSWITCH]			= LOADSRF (IDB_SECSWITCH);
+		// srf[9]						= LOADSRF (IDB_ABORT);
+		// srf[10]						= LOADSRF (IDB_ANNUN);
+		// srf[11]						= LOADSRF (IDB_LAUNCH);		
+		srf[SRF_LMTWOPOSLEVER]		= LOADSRF (IDB_LEMSWITCH2);
+		// srf[12]						= LOADSRF (IDB_LV_ENG);
 		// There was a conflict here between hardcoded index 13 and SRF_DSKY
 		// Hardcoded index 13 was moved to SRF_LIGHTS2 (index 5)
-		srf[SRF_DSKY]				= oapiCreateSurface (LOADBMP (IDB_DSKY_LIGHTS));
-		// srf[14]						= oapiCreateSurface (LOADBMP (IDB_ALTIMETER));
-		// srf[15]						= oapiCreateSurface (LOADBMP (IDB_ANLG_GMETER));
-		// srf[16]						= oapiCreateSurface (LOADBMP (IDB_THRUST));
-		// srf[17]					= oapiCreateSurface (LOADBMP (IDB_HEADING));
-		srf[SRF_CONTACTLIGHT]		= oapiCreateSurface (LOADBMP (IDB_CONTACT));
+		srf[SRF_DSKY]				= LOADSRF (IDB_DSKY_LIGHTS);
+		// srf[14]						= LOADSRF (IDB_ALTIMETER);
+		// srf[15]						= LOADSRF (IDB_ANLG_GMETER);
+		// srf[16]						= LOADSRF (IDB_THRUST);
+		// srf[17]					= LOADSRF (IDB_HEADING);
+		srf[SRF_CONTACTLIGHT]		= LOADSRF (IDB_CONTACT);
 		// srf[19] (SRF_THREEPOSSWITCH305) was hardcoded in several places but never actually loaded?
-		// srf[SRF_THREEPOSSWITCH305]	= oapiCreateSurface (LOADBMP (IDB_CONTACT));
+		// srf[SRF_THREEPOSSWITCH305]	= LOADSRF (IDB_CONTACT);
 		// There was a conflict here between hardcoded index 20 and SRF_LMABORTBUTTON
 		// Hardcoded index 20 was moved to SRF_LEMSWITCH3 (index 7)		
-		srf[SRF_LMABORTBUTTON]		= oapiCreateSurface (LOADBMP (IDB_LMABORTBUTTON));
-		srf[SRF_LMMFDFRAME]			= oapiCreateSurface (LOADBMP (IDB_LMMFDFRAME));
-		srf[SRF_LMTHREEPOSLEVER]	= oapiCreateSurface (LOADBMP (IDB_LMTHREEPOSLEVER));
-		srf[SRF_LMTHREEPOSSWITCH]	= oapiCreateSurface (LOADBMP (IDB_LMTHREEPOSSWITCH));
-		srf[SRF_DSKYDISP]			= oapiCreateSurface (LOADBMP (IDB_DSKY_DISP));
-		//srf[SRF_FDAI]	        	= oapiCreateSurface (LOADBMP (IDB_FDAI));		//The LM FDAI texture doesn't need this
-		srf[SRF_FDAIROLL]			= oapiCreateSurface (LOADBMP (IDB_LEM_FDAI_ROLL));
-		srf[SRF_CWSLIGHTS]			= oapiCreateSurface (LOADBMP (IDB_CWS_LIGHTS));
-		srf[SRF_DSKYKEY]			= oapiCreateSurface (LOADBMP (IDB_DSKY_KEY));
-		srf[SRF_LEMROTARY]			= oapiCreateSurface (LOADBMP (IDB_LEMROTARY));
-		srf[SRF_FDAIOFFFLAG]		= oapiCreateSurface (LOADBMP (IDB_FDAIOFFFLAG));
-		srf[SRF_FDAINEEDLES]		= oapiCreateSurface (LOADBMP (IDB_LEM_FDAI_NEEDLES));
-		srf[SRF_CIRCUITBRAKER]		= oapiCreateSurface (LOADBMP (IDB_CIRCUITBRAKER));
-		srf[SRF_LEM_COAS1]			= oapiCreateSurface (LOADBMP (IDB_LEM_COAS1));
-		srf[SRF_LEM_COAS2]			= oapiCreateSurface (LOADBMP (IDB_LEM_COAS2));
-		srf[SRF_DCVOLTS]			= oapiCreateSurface (LOADBMP (IDB_LMDCVOLTS));
-		srf[SRF_DCAMPS]				= oapiCreateSurface (LOADBMP (IDB_LMDCAMPS));
-		srf[SRF_LMYAWDEGS]			= oapiCreateSurface (LOADBMP (IDB_LMYAWDEGS));
-		srf[SRF_LMPITCHDEGS]		= oapiCreateSurface (LOADBMP (IDB_LMPITCHDEGS));
-		srf[SRF_LMSIGNALSTRENGTH]	= oapiCreateSurface (LOADBMP (IDB_LMSIGNALSTRENGTH));
-		srf[SRF_AOTRETICLEKNOB]     = oapiCreateSurface (LOADBMP (IDB_AOT_RETICLE_KNOB));
-		srf[SRF_AOTSHAFTKNOB]       = oapiCreateSurface (LOADBMP (IDB_AOT_SHAFT_KNOB));
-		srf[SRF_AOT_FONT]           = oapiCreateSurface (LOADBMP (IDB_AOT_FONT));
-		srf[SRF_THUMBWHEEL_LARGEFONTS] = oapiCreateSurface (LOADBMP (IDB_THUMBWHEEL_LARGEFONTS));
-		srf[SRF_FIVE_POS_SWITCH]	= oapiCreateSurface (LOADBMP (IDB_FIVE_POS_SWITCH));
-		srf[SRF_RR_NOTRACK]         = oapiCreateSurface (LOADBMP (IDB_RR_NOTRACK));
-		srf[SRF_LEM_STAGESWITCH]	= oapiCreateSurface (LOADBMP (IDB_LEM_STAGESWITCH));
-		srf[SRF_DIGITALDISP2]		= oapiCreateSurface (LOADBMP (IDB_DIGITALDISP2));
-		srf[SRF_RADAR_TAPE]         = oapiCreateSurface (LOADBMP (IDB_RADAR_TAPE));
-		srf[SRF_RADAR_TAPE2]        = oapiCreateSurface(LOADBMP(IDB_RADAR_TAPE2));
-		srf[SRF_SEQ_LIGHT]			= oapiCreateSurface (LOADBMP (IDB_SEQ_LIGHT));
-		srf[SRF_LMENGINE_START_STOP_BUTTONS] = oapiCreateSurface (LOADBMP (IDB_LMENGINESTARTSTOPBUTTONS));
-		srf[SRF_LMTRANSLBUTTON]		= oapiCreateSurface (LOADBMP (IDB_LMTRANSLBUTTON));
-		srf[SRF_LEMVENT]			= oapiCreateSurface (LOADBMP (IDB_LEMVENT));
-		srf[SRF_LEM_ACT_OVRD]		= oapiCreateSurface (LOADBMP (IDB_LEM_ACT_OVRD));
-		srf[SRF_LEM_CAN_SEL]		= oapiCreateSurface (LOADBMP (IDB_LEM_CAN_SEL));
-		srf[SRF_LEM_ECS_ROTARY]		= oapiCreateSurface (LOADBMP (IDB_LEM_ECS_ROTARY));
-		srf[SRF_LEM_H20_SEL]		= oapiCreateSurface (LOADBMP (IDB_LEM_H20_SEL));
-		srf[SRF_LEM_H20_SEP]		= oapiCreateSurface (LOADBMP (IDB_LEM_H20_SEP));
-		srf[SRF_LEM_ISOL_ROTARY]	= oapiCreateSurface (LOADBMP (IDB_LEM_ISOL_ROTARY));
-		srf[SRF_LEM_PRIM_C02]		= oapiCreateSurface (LOADBMP (IDB_LEM_PRIM_C02));
-		srf[SRF_LEM_SEC_C02]		= oapiCreateSurface (LOADBMP (IDB_LEM_SEC_C02));
-		srf[SRF_LEM_SGD_LEVER]		= oapiCreateSurface (LOADBMP (IDB_LEM_SGD_LEVER));
-		srf[SRF_LEM_U_HATCH_REL_VLV] = oapiCreateSurface(LOADBMP(IDB_LEM_UPPER_REL_VLV));
-		srf[SRF_LEM_U_HATCH_HNDL]   = oapiCreateSurface(LOADBMP(IDB_LEM_UPPER_HANDLE));
-		srf[SRF_LEM_F_HATCH_HNDL]   = oapiCreateSurface(LOADBMP(IDB_LEM_FWD_HANDLE));
-		srf[SRF_LEM_F_HATCH_REL_VLV] = oapiCreateSurface(LOADBMP(IDB_LEM_FWD_REL_VLV));
-		srf[SRF_LEM_INTLK_OVRD]     = oapiCreateSurface(LOADBMP(IDB_LEM_INTLK_OVRD));
-		srf[SRF_RED_INDICATOR]		= oapiCreateSurface(LOADBMP(IDB_RED_INDICATOR));
-		srf[SRF_LEM_MASTERALARM]	 = oapiCreateSurface(LOADBMP(IDB_LEM_MASTERALARM));
-		srf[SRF_DEDA_KEY]			= oapiCreateSurface(LOADBMP(IDB_DEDA_KEY));
-		srf[SRF_DEDA_LIGHTS]		= oapiCreateSurface(LOADBMP(IDB_DEDA_LIGHTS));
-		srf[SRF_ORDEAL_ROTARY]		= oapiCreateSurface(LOADBMP(IDB_ORDEAL_ROTARY));
-		srf[SRF_ORDEAL_PANEL]		= oapiCreateSurface(LOADBMP(IDB_ORDEAL_PANEL));
-		srf[SRF_TW_NEEDLE]			= oapiCreateSurface(LOADBMP(IDB_TW_NEEDLE));
-		srf[SRF_PWRFAIL_LIGHT]      = oapiCreateSurface(LOADBMP(IDB_LEM_PWRFAIL_LIGHT));
+		srf[SRF_LMABORTBUTTON]		= LOADSRF (IDB_LMABORTBUTTON);
+		srf[SRF_LMMFDFRAME]			= LOADSRF (IDB_LMMFDFRAME);
+		srf[SRF_LMTHREEPOSLEVER]	= LOADSRF (IDB_LMTHREEPOSLEVER);
+		srf[SRF_LMTHREEPOSSWITCH]	= LOADSRF (IDB_LMTHREEPOSSWITCH);
+		srf[SRF_DSKYDISP]			= LOADSRF (IDB_DSKY_DISP);
+		//srf[SRF_FDAI]	        	= LOADSRF (IDB_FDAI);		//The LM FDAI texture doesn't need this
+		srf[SRF_FDAIROLL]			= LOADSRF (IDB_LEM_FDAI_ROLL);
+		srf[SRF_CWSLIGHTS]			= LOADSRF (IDB_CWS_LIGHTS);
+		srf[SRF_DSKYKEY]			= LOADSRF (IDB_DSKY_KEY);
+		srf[SRF_LEMROTARY]			= LOADSRF (IDB_LEMROTARY);
+		srf[SRF_FDAIOFFFLAG]		= LOADSRF (IDB_FDAIOFFFLAG);
+		srf[SRF_FDAINEEDLES]		= LOADSRF (IDB_LEM_FDAI_NEEDLES);
+		srf[SRF_CIRCUITBRAKER]		= LOADSRF (IDB_CIRCUITBRAKER);
+		srf[SRF_LEM_COAS1]			= LOADSRF (IDB_LEM_COAS1);
+		srf[SRF_LEM_COAS2]			= LOADSRF (IDB_LEM_COAS2);
+		srf[SRF_DCVOLTS]			= LOADSRF (IDB_LMDCVOLTS);
+		srf[SRF_DCAMPS]				= LOADSRF (IDB_LMDCAMPS);
+		srf[SRF_LMYAWDEGS]			= LOADSRF (IDB_LMYAWDEGS);
+		srf[SRF_LMPITCHDEGS]		= LOADSRF (IDB_LMPITCHDEGS);
+		srf[SRF_LMSIGNALSTRENGTH]	= LOADSRF (IDB_LMSIGNALSTRENGTH);
+		srf[SRF_AOTRETICLEKNOB]     = LOADSRF (IDB_AOT_RETICLE_KNOB);
+		srf[SRF_AOTSHAFTKNOB]       = LOADSRF (IDB_AOT_SHAFT_KNOB);
+		srf[SRF_AOT_FONT]           = LOADSRF (IDB_AOT_FONT);
+		srf[SRF_THUMBWHEEL_LARGEFONTS] = LOADSRF (IDB_THUMBWHEEL_LARGEFONTS);
+		srf[SRF_FIVE_POS_SWITCH]	= LOADSRF (IDB_FIVE_POS_SWITCH);
+		srf[SRF_RR_NOTRACK]         = LOADSRF (IDB_RR_NOTRACK);
+		srf[SRF_LEM_STAGESWITCH]	= LOADSRF (IDB_LEM_STAGESWITCH);
+		srf[SRF_DIGITALDISP2]		= LOADSRF (IDB_DIGITALDISP2);
+		srf[SRF_RADAR_TAPE]         = LOADSRF (IDB_RADAR_TAPE);
+		srf[SRF_RADAR_TAPE2]        = LOADSRF (IDB_RADAR_TAPE2);
+		srf[SRF_SEQ_LIGHT]			= LOADSRF (IDB_SEQ_LIGHT);
+		srf[SRF_LMENGINE_START_STOP_BUTTONS] = LOADSRF (IDB_LMENGINESTARTSTOPBUTTONS);
+		srf[SRF_LMTRANSLBUTTON]		= LOADSRF (IDB_LMTRANSLBUTTON);
+		srf[SRF_LEMVENT]			= LOADSRF (IDB_LEMVENT);
+		srf[SRF_LEM_ACT_OVRD]		= LOADSRF (IDB_LEM_ACT_OVRD);
+		srf[SRF_LEM_CAN_SEL]		= LOADSRF (IDB_LEM_CAN_SEL);
+		srf[SRF_LEM_ECS_ROTARY]		= LOADSRF (IDB_LEM_ECS_ROTARY);
+		srf[SRF_LEM_H20_SEL]		= LOADSRF (IDB_LEM_H20_SEL);
+		srf[SRF_LEM_H20_SEP]		= LOADSRF (IDB_LEM_H20_SEP);
+		srf[SRF_LEM_ISOL_ROTARY]	= LOADSRF (IDB_LEM_ISOL_ROTARY);
+		srf[SRF_LEM_PRIM_C02]		= LOADSRF (IDB_LEM_PRIM_C02);
+		srf[SRF_LEM_SEC_C02]		= LOADSRF (IDB_LEM_SEC_C02);
+		srf[SRF_LEM_SGD_LEVER]		= LOADSRF (IDB_LEM_SGD_LEVER);
+		srf[SRF_LEM_U_HATCH_REL_VLV] = LOADSRF (IDB_LEM_UPPER_REL_VLV);
+		srf[SRF_LEM_U_HATCH_HNDL]   = LOADSRF (IDB_LEM_UPPER_HANDLE);
+		srf[SRF_LEM_F_HATCH_HNDL]   = LOADSRF (IDB_LEM_FWD_HANDLE);
+		srf[SRF_LEM_F_HATCH_REL_VLV] = LOADSRF (IDB_LEM_FWD_REL_VLV);
+		srf[SRF_LEM_INTLK_OVRD]     = LOADSRF (IDB_LEM_INTLK_OVRD);
+		srf[SRF_RED_INDICATOR]		= LOADSRF (IDB_RED_INDICATOR);
+		srf[SRF_LEM_MASTERALARM]	 = LOADSRF (IDB_LEM_MASTERALARM);
+		srf[SRF_DEDA_KEY]			= LOADSRF (IDB_DEDA_KEY);
+		srf[SRF_DEDA_LIGHTS]		= LOADSRF (IDB_DEDA_LIGHTS);
+		srf[SRF_ORDEAL_ROTARY]		= LOADSRF (IDB_ORDEAL_ROTARY);
+		srf[SRF_ORDEAL_PANEL]		= LOADSRF (IDB_ORDEAL_PANEL);
+		srf[SRF_TW_NEEDLE]			= LOADSRF (IDB_TW_NEEDLE);
+		srf[SRF_PWRFAIL_LIGHT]      = LOADSRF (IDB_LEM_PWRFAIL_LIGHT);
 		
 		//
 		// Flashing borders.
 		//
 
-		srf[SRF_BORDER_34x29]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x29));
-		srf[SRF_BORDER_34x61]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x61));
-		srf[SRF_BORDER_55x111]		= oapiCreateSurface (LOADBMP (IDB_BORDER_55x111));
-		srf[SRF_BORDER_46x75]		= oapiCreateSurface (LOADBMP (IDB_BORDER_46x75));
-		srf[SRF_BORDER_39x38]		= oapiCreateSurface (LOADBMP (IDB_BORDER_39x38));
-		srf[SRF_BORDER_92x40]		= oapiCreateSurface (LOADBMP (IDB_BORDER_92x40));
-		srf[SRF_BORDER_34x33]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x33));
-		srf[SRF_BORDER_29x29]		= oapiCreateSurface (LOADBMP (IDB_BORDER_29x29));
-		srf[SRF_BORDER_34x31]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x31));
-		srf[SRF_BORDER_47x43]		= oapiCreateSurface (LOADBMP(IDB_BORDER_47x43));
-		srf[SRF_BORDER_50x158]		= oapiCreateSurface (LOADBMP (IDB_BORDER_50x158));
-		srf[SRF_BORDER_38x52]		= oapiCreateSurface (LOADBMP (IDB_BORDER_38x52));
-		srf[SRF_BORDER_34x34]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x34));
-		srf[SRF_BORDER_90x90]		= oapiCreateSurface (LOADBMP (IDB_BORDER_90x90));
-		srf[SRF_BORDER_84x84]		= oapiCreateSurface (LOADBMP (IDB_BORDER_84x84));
-		srf[SRF_BORDER_70x70]		= oapiCreateSurface (LOADBMP (IDB_BORDER_70x70));
-		srf[SRF_BORDER_23x20]		= oapiCreateSurface (LOADBMP (IDB_BORDER_23x20));
-		srf[SRF_BORDER_78x78]		= oapiCreateSurface (LOADBMP (IDB_BORDER_78x78));
-		srf[SRF_BORDER_32x160]		= oapiCreateSurface (LOADBMP (IDB_BORDER_32x160));
-		srf[SRF_BORDER_72x72]		= oapiCreateSurface (LOADBMP (IDB_BORDER_72x72));
-		srf[SRF_BORDER_75x64]		= oapiCreateSurface (LOADBMP (IDB_BORDER_75x64));
-		srf[SRF_BORDER_34x39]		= oapiCreateSurface (LOADBMP (IDB_BORDER_34x39));
-		srf[SRF_BORDER_38x38]		= oapiCreateSurface (LOADBMP (IDB_BORDER_38x38));
-		srf[SRF_BORDER_40x40]		= oapiCreateSurface (LOADBMP (IDB_BORDER_40x40));
-		srf[SRF_BORDER_126x131]     = oapiCreateSurface (LOADBMP (IDB_BORDER_126x131));
-		srf[SRF_BORDER_115x115]     = oapiCreateSurface (LOADBMP (IDB_BORDER_115x115));
-		srf[SRF_BORDER_68x68]       = oapiCreateSurface (LOADBMP (IDB_BORDER_68x68));
-		srf[SRF_BORDER_169x168]     = oapiCreateSurface (LOADBMP (IDB_BORDER_169x168));
-		srf[SRF_BORDER_67x64]       = oapiCreateSurface (LOADBMP (IDB_BORDER_67x64));
-		srf[SRF_BORDER_201x205]     = oapiCreateSurface (LOADBMP (IDB_BORDER_201x205));
-		srf[SRF_BORDER_122x265]     = oapiCreateSurface (LOADBMP (IDB_BORDER_122x265));
-		srf[SRF_BORDER_225x224]     = oapiCreateSurface (LOADBMP (IDB_BORDER_225x224));
-		srf[SRF_BORDER_51x54]       = oapiCreateSurface (LOADBMP (IDB_BORDER_51x54));
-		srf[SRF_BORDER_205x205]     = oapiCreateSurface (LOADBMP (IDB_BORDER_205x205));
-		srf[SRF_BORDER_30x144]      = oapiCreateSurface (LOADBMP (IDB_BORDER_30x144));
-		srf[SRF_BORDER_400x400]     = oapiCreateSurface (LOADBMP (IDB_BORDER_400x400));
-		srf[SRF_BORDER_1001x240]    = oapiCreateSurface (LOADBMP (IDB_BORDER_1001x240));
-		srf[SRF_BORDER_360x316]     = oapiCreateSurface (LOADBMP (IDB_BORDER_360x316));
-		srf[SRF_BORDER_178x187]     = oapiCreateSurface (LOADBMP (IDB_BORDER_178x187));
-		srf[SRF_BORDER_55x55]       = oapiCreateSurface (LOADBMP (IDB_BORDER_55x55));
-		srf[SRF_BORDER_109x119]     = oapiCreateSurface (LOADBMP (IDB_BORDER_109x119));
-		srf[SRF_BORDER_68x69]       = oapiCreateSurface (LOADBMP (IDB_BORDER_68x69));
-		srf[SRF_BORDER_210x200]     = oapiCreateSurface (LOADBMP (IDB_BORDER_210x200));
-		srf[SRF_BORDER_104x106]     = oapiCreateSurface (LOADBMP (IDB_BORDER_104x106));
-		srf[SRF_BORDER_286x197]     = oapiCreateSurface (LOADBMP (IDB_BORDER_286x197));
+		srf[SRF_BORDER_34x29]		= LOADSRF (IDB_BORDER_34x29);
+		srf[SRF_BORDER_34x61]		= LOADSRF (IDB_BORDER_34x61);
+		srf[SRF_BORDER_55x111]		= LOADSRF (IDB_BORDER_55x111);
+		srf[SRF_BORDER_46x75]		= LOADSRF (IDB_BORDER_46x75);
+		srf[SRF_BORDER_39x38]		= LOADSRF (IDB_BORDER_39x38);
+		srf[SRF_BORDER_92x40]		= LOADSRF (IDB_BORDER_92x40);
+		srf[SRF_BORDER_34x33]		= LOADSRF (IDB_BORDER_34x33);
+		srf[SRF_BORDER_29x29]		= LOADSRF (IDB_BORDER_29x29);
+		srf[SRF_BORDER_34x31]		= LOADSRF (IDB_BORDER_34x31);
+		srf[SRF_BORDER_47x43]		= LOADSRF (IDB_BORDER_47x43);
+		srf[SRF_BORDER_50x158]		= LOADSRF (IDB_BORDER_50x158);
+		srf[SRF_BORDER_38x52]		= LOADSRF (IDB_BORDER_38x52);
+		srf[SRF_BORDER_34x34]		= LOADSRF (IDB_BORDER_34x34);
+		srf[SRF_BORDER_90x90]		= LOADSRF (IDB_BORDER_90x90);
+		srf[SRF_BORDER_84x84]		= LOADSRF (IDB_BORDER_84x84);
+		srf[SRF_BORDER_70x70]		= LOADSRF (IDB_BORDER_70x70);
+		srf[SRF_BORDER_23x20]		= LOADSRF (IDB_BORDER_23x20);
+		srf[SRF_BORDER_78x78]		= LOADSRF (IDB_BORDER_78x78);
+		srf[SRF_BORDER_32x160]		= LOADSRF (IDB_BORDER_32x160);
+		srf[SRF_BORDER_72x72]		= LOADSRF (IDB_BORDER_72x72);
+		srf[SRF_BORDER_75x64]		= LOADSRF (IDB_BORDER_75x64);
+		srf[SRF_BORDER_34x39]		= LOADSRF (IDB_BORDER_34x39);
+		srf[SRF_BORDER_38x38]		= LOADSRF (IDB_BORDER_38x38);
+		srf[SRF_BORDER_40x40]		= LOADSRF (IDB_BORDER_40x40);
+		srf[SRF_BORDER_126x131]     = LOADSRF (IDB_BORDER_126x131);
+		srf[SRF_BORDER_115x115]     = LOADSRF (IDB_BORDER_115x115);
+		srf[SRF_BORDER_68x68]       = LOADSRF (IDB_BORDER_68x68);
+		srf[SRF_BORDER_169x168]     = LOADSRF (IDB_BORDER_169x168);
+		srf[SRF_BORDER_67x64]       = LOADSRF (IDB_BORDER_67x64);
+		srf[SRF_BORDER_201x205]     = LOADSRF (IDB_BORDER_201x205);
+		srf[SRF_BORDER_122x265]     = LOADSRF (IDB_BORDER_122x265);
+		srf[SRF_BORDER_225x224]     = LOADSRF (IDB_BORDER_225x224);
+		srf[SRF_BORDER_51x54]       = LOADSRF (IDB_BORDER_51x54);
+		srf[SRF_BORDER_205x205]     = LOADSRF (IDB_BORDER_205x205);
+		srf[SRF_BORDER_30x144]      = LOADSRF (IDB_BORDER_30x144);
+		srf[SRF_BORDER_400x400]     = LOADSRF (IDB_BORDER_400x400);
+		srf[SRF_BORDER_1001x240]    = LOADSRF (IDB_BORDER_1001x240);
+		srf[SRF_BORDER_360x316]     = LOADSRF (IDB_BORDER_360x316);
+		srf[SRF_BORDER_178x187]     = LOADSRF (IDB_BORDER_178x187);
+		srf[SRF_BORDER_55x55]       = LOADSRF (IDB_BORDER_55x55);
+		srf[SRF_BORDER_109x119]     = LOADSRF (IDB_BORDER_109x119);
+		srf[SRF_BORDER_68x69]       = LOADSRF (IDB_BORDER_68x69);
+		srf[SRF_BORDER_210x200]     = LOADSRF (IDB_BORDER_210x200);
+		srf[SRF_BORDER_104x106]     = LOADSRF (IDB_BORDER_104x106);
+		srf[SRF_BORDER_286x197]     = LOADSRF (IDB_BORDER_286x197);
 
 		//
 		// Set color keys where appropriate.
@@ -2698,6 +2700,7 @@ void LEM::SetSwitches(int panel) {
 	CDRCOASSwitch.Init(1063, 266, 34, 39, srf[SRF_LMTHREEPOSLEVER], srf[SRF_BORDER_34x29], Panel8SwitchRow, this);
 
 	ORDEALSwitchesRow.Init(AID_ORDEALSWITCHES, MainPanel);
+	ORDEALSwitchesRow.SetTrackChanges(false);
 	ORDEALFDAI1Switch.Init(55, 43, 34, 29, srf[SRF_SWITCHUP], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
 	ORDEALFDAI2Switch.Init(168, 43, 34, 29, srf[SRF_SWITCHUP], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
 	ORDEALEarthSwitch.Init(264, 43, 34, 29, srf[SRF_LMTHREEPOSSWITCH], srf[SRF_BORDER_34x29], ORDEALSwitchesRow);
@@ -3243,9 +3246,14 @@ bool LEM::clbkPanelRedrawEvent (int id, int event, SURFHANDLE surf)
 	}
 
 	//
-	// Process all the generic switches.
+	// Process all the generic switches. If nothing in the row changed since it was last
+	// drawn, leave the old image on the panel. The ORDEAL row has change tracking disabled
+	// because of its special handling above.
 	//
 
+	if (event == PANEL_REDRAW_ALWAYS && MainPanel.IsRowUnchanged(id, PanelFlashOn))
+		return false;
+
 	if (MainPanel.DrawRow(id, surf, PanelFlashOn))
 		return true;
 
@@ -3263,6 +3271,8 @@ bool LEM::clbkPanelRedrawEvent (int id, int event, SURFHANDLE surf)
 		return true;
 
 	case AID_DSKY_LIGHTS:
+		if (!dsky.LightsChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		if (pMission->GetLMDSKYVersion() == 3)
 		{
 			dsky.RenderLights(surf, srf[SRF_DSKY], 0, 0, true, true);
@@ -3278,18 +3288,26 @@ bool LEM::clbkPanelRedrawEvent (int id, int event, SURFHANDLE surf)
 		return true;
 
 	case AID_DSKY_DISPLAY:
+		if (!dsky.DataChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		dsky.RenderData(surf, srf[SRF_DIGITAL], srf[SRF_DSKYDISP]);
 		return true;
 
 	case AID_LM_DEDA_LIGHTS:
+		if (!deda.DisplayChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		deda.RenderOprErr(surf, srf[SRF_DEDA_LIGHTS]);
 		return true;
 
 	case AID_LM_DEDA_DISP:
+		if (!deda.DisplayChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		deda.RenderData(surf, srf[SRF_DIGITALDISP2]);
 		return true;
 
 	case AID_LM_DEDA_ADR:
+		if (!deda.DisplayChanged(id) && event == PANEL_REDRAW_ALWAYS)
+			return false;
 		deda.RenderAdr(surf, srf[SRF_DIGITALDISP2]);
 		return true;
 
@@ -258,7 +258,7 @@ void LMSuitPressMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() * 0.99) - minValue) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // ECS indicator, cabin pressure
@@ -293,7 +293,7 @@ void LMCabinPressMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // ECS indicator, cabin CO2 level
@@ -360,7 +360,7 @@ void LMCO2Meter::OnPostStep(double SimT, double DeltaT, double MJD)
 	double v = ((GetDisplayValue() - minValue) * 0.98) / (maxValue - minValue);
 	// Still needs scale factor, right now its wrongly 1:1 for entire range
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // ECS indicator, Glycol Temp Meter
@@ -395,7 +395,7 @@ void LMGlycolTempMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.94) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // ECS indicator, Glycol Pressure Meter
@@ -470,7 +470,7 @@ void LMOxygenQtyMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // ECS indicator, Water Quantity Meter
@@ -515,7 +515,7 @@ void LMWaterQtyMeter::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS A Temp
@@ -552,7 +552,7 @@ void LMRCSATempInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS B Temp
@@ -589,7 +589,7 @@ void LMRCSBTempInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS A Press
@@ -635,7 +635,7 @@ void LMRCSAPressInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.86) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS B Press
@@ -681,7 +681,7 @@ void LMRCSBPressInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.86) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS A Qty
@@ -715,7 +715,7 @@ void LMRCSAQtyInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.79) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // RCS indicator, RCS B Qty
@@ -749,7 +749,7 @@ void LMRCSBQtyInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.79) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // Temperature Monitor Indicator
@@ -803,7 +803,7 @@ void TempMonitorInd::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	double v = ((GetDisplayValue() - minValue) * 0.97) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // Engine Thrust Indicator
@@ -836,7 +836,7 @@ void EngineThrustInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // Commanded Thrust Indicator
@@ -873,7 +873,7 @@ void CommandedThrustInd::OnPostStep(double SimT, double DeltaT, double MJD) {
 
 	double v = ((GetDisplayValue() - minValue) * 0.99) / (maxValue - minValue);
 
-	lem->SetAnimation(anim_switch, v);
+	SetVCAnimation(lem, anim_switch, v);
 }
 
 // Thrust/Weight Indicator
@@ -1217,7 +1217,7 @@ void LEMDCVoltMeter::DoDrawSwitch(double v, SURFHANDLE drawSurface){
 void LEMDCVoltMeter::DoDrawSwitchVC(UINT anim) {
 
 	double v = (GetDisplayValue() - 19) / 22;
-	lem->SetAnimation(anim, v);
+	UpdateVCAnimation(lem, anim, v);
 }
 
 // DC Ammeter
@@ -1284,7 +1284,7 @@ void LEMDCAmMeter::DoDrawSwitch(double v, SURFHANDLE drawSurface){
 void LEMDCAmMeter::DoDrawSwitchVC(UINT anim) {
 
 	double v = GetDisplayValue() / maxValue;
-	lem->SetAnimation(anim, v);
+	UpdateVCAnimation(lem, anim, v);
 }
 
 // LEM Voltmeter-feeding CB hack
@@ -1711,7 +1711,7 @@ void LEMSteerableAntennaPitchMeter::DoDrawSwitch(double v, SURFHANDLE drawSurfac
 
 void LEMSteerableAntennaPitchMeter::DoDrawSwitchVC(UINT anim) {
 	double v = (GetDisplayValue() + 75) / 330;
-	lem->SetAnimation(anim, v);
+	UpdateVCAnimation(lem, anim, v);
 }
 
 void LEMSteerableAntennaYawMeter::Init(HPEN p0, HPEN p1, SwitchRow &row, LEM *s, SURFHANDLE frameSurface)
@@ -1732,7 +1732,7 @@ void LEMSteerableAntennaYawMeter::DoDrawSwitch(double v, SURFHANDLE drawSurface)
 
 void LEMSteerableAntennaYawMeter::DoDrawSwitchVC(UINT anim) {
 	double v = (GetDisplayValue() + 75) / 150;
-	lem->SetAnimation(anim, (v + 0.56) * 0.47);
+	UpdateVCAnimation(lem, anim, (v + 0.56) * 0.47);
 }
 
 void LEMSBandAntennaStrengthMeter::Init(HPEN p0, HPEN p1, SwitchRow &row, LEM *s, SURFHANDLE frameSurface)
@@ -1753,7 +1753,7 @@ void LEMSBandAntennaStrengthMeter::DoDrawSwitch(double v, SURFHANDLE drawSurface
 
 void LEMSBandAntennaStrengthMeter::DoDrawSwitchVC(UINT anim) {
 	double v = GetDisplayValue();
-	lem->SetAnimation(anim, v / 100);
+	UpdateVCAnimation(lem, anim, v / 100);
 }
 
 LEMDPSValveTalkback::LEMDPSValveTalkback()
@@ -415,6 +415,7 @@ public:
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	bool Push();
 	void DoDrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	void DoDrawSwitchVC(SURFHANDLE surf, SURFHANDLE DrawSurface);
 protected:
 	ToggleSwitch* stopbutton;
@@ -430,6 +431,7 @@ public:
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	bool Push();
 	void DoDrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 protected:
 	SimplePushSwitch* startbutton;
 	LEM *lem;
@@ -669,6 +671,7 @@ public:
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, LEM_CWEA *c);
 	void InitVC(SURFHANDLE surf);
 	void DoDrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	void DrawSwitchVC(int id, int event, SURFHANDLE surf);
 	bool SwitchTo(int newState, bool dontspring = false);
 protected:
@@ -3265,8 +3265,8 @@ void CrossPointer::DefineVCAnimations(UINT vc_idx)
 
 void CrossPointer::DrawSwitchVC(int id, int event, SURFHANDLE surf)
 {
-	if (anim_xpointerx != 1) lem->SetAnimation(anim_xpointerx, (vel_x / 40) + 0.5);
-	if (anim_xpointery != 1) lem->SetAnimation(anim_xpointery, (vel_y / 40) + 0.5);
+	if (anim_xpointerx != 1) lem->UpdateAnimation(anim_xpointerx, (vel_x / 40) + 0.5);
+	if (anim_xpointery != 1) lem->UpdateAnimation(anim_xpointery, (vel_y / 40) + 0.5);
 }
 
 void CrossPointer::SaveState(FILEHANDLE scn) {
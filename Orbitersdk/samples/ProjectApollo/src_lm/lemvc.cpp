@@ -34,6 +34,7 @@
 
 #include "soundlib.h"
 #include "toggleswitch.h"
+#include "panelsurfacecache.h"
 #include "apolloguidance.h"
 #include "LEMcomputer.h"
 #include "LM_VC_Resource.h"
@@ -855,7 +856,7 @@ void LEM::ReleaseSurfacesVC()
 {
 	for (int i = 0; i < nsurfvc; i++)
 		if (srf[i]) {
-			oapiDestroySurface(srf[i]);
+			PanelSurfaceCache::ReleaseSurface(srf[i]);
 			srf[i] = 0;
 		}
 }
@@ -1526,11 +1527,11 @@ bool LEM::clbkVCRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 
 			fdaiLeft.AnimateFDAI(rates, errors, anim_fdaiR_cdr, anim_fdaiP_cdr, anim_fdaiY_cdr, anim_fdaiRerror_cdr, anim_fdaiPerror_cdr, anim_fdaiYerror_cdr, anim_fdaiRrate_cdr, anim_fdaiPrate_cdr, anim_fdaiYrate_cdr);
-			SetAnimation(anim_attflag_cdr, 0.0);
+			UpdateAnimation(anim_attflag_cdr, 0.0);
 		}
 		else
 		{
-			SetAnimation(anim_attflag_cdr, 1.0);
+			UpdateAnimation(anim_attflag_cdr, 1.0);
 		}
 		return true;
 
@@ -1592,11 +1593,11 @@ bool LEM::clbkVCRedrawEvent(int id, int event, SURFHANDLE surf)
 			}
 
 			fdaiRight.AnimateFDAI(rates, errors, anim_fdaiR_lmp, anim_fdaiP_lmp, anim_fdaiY_lmp, anim_fdaiRerror_lmp, anim_fdaiPerror_lmp, anim_fdaiYerror_lmp, anim_fdaiRrate_lmp, anim_fdaiPrate_lmp, anim_fdaiYrate_lmp);
-			SetAnimation(anim_attflag_lmp, 0.0);
+			UpdateAnimation(anim_attflag_lmp, 0.0);
 		}
 		else
 		{
-			SetAnimation(anim_attflag_lmp, 1.0);
+			UpdateAnimation(anim_attflag_lmp, 1.0);
 		}
 		return true;
 
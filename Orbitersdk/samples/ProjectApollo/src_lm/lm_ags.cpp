@@ -1324,6 +1324,25 @@ void LEM_DEDA::RenderData(SURFHANDLE surf, SURFHANDLE digits, int xOffset, int y
 	RenderSixDigitDisplay(surf, digits, xOffset, yOffset, Data);
 }
 
+bool LEM_DEDA::DisplayChanged(int area)
+
+{
+	char State[12];
+
+	memcpy(State, Adr, 3);
+	memcpy(State + 3, Data, 6);
+	State[9] = (IsPowered() && HasNumPower()) ? '1' : '0';
+	State[10] = HasAnnunPower() ? '1' : '0';
+	State[11] = OprErrLit() ? '1' : '0';
+
+	std::string &Drawn = DrawnState[area];
+	if (Drawn.size() == sizeof(State) && !Drawn.compare(0, sizeof(State), State, sizeof(State)))
+		return false;
+
+	Drawn.assign(State, sizeof(State));
+	return true;
+}
+
 void LEM_DEDA::RenderKeys(SURFHANDLE surf, SURFHANDLE keys, int xOffset, int yOffset)
 
 {
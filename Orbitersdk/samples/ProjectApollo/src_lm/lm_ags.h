@@ -26,6 +26,8 @@
 
 #include "yaAGS/aea_engine.h"
 #include <queue>
+#include <string>
+#include <unordered_map>
 
 class LEM_DEDA;
 
@@ -274,6 +276,13 @@ public:
 	void RenderData(SURFHANDLE surf, SURFHANDLE digits, int xoffset = 0, int yoffset = 0);
 	void RenderKeys(SURFHANDLE surf, SURFHANDLE keys, int xoffset = 0, int yoffset = 0);
 
+	///
+	/// \brief Check whether the DEDA readout differs from what was last drawn into a panel area.
+	/// \param area Panel area ID the address, data or OPR ERR light is drawn into.
+	/// \return True if the area has to be redrawn.
+	///
+	bool DisplayChanged(int area);
+
 	void KeyClick();
 	bool IsPowered();
 	bool HasAnnunPower();
@@ -342,6 +351,12 @@ protected:
 	char Adr[4];
 	char Data[7];
 
+	//
+	// Readout state last drawn into each panel area.
+	//
+
+	std::unordered_map<int, std::string> DrawnState;
+
 	//
 	// AGS we're connected to.
 	//
@@ -548,7 +548,7 @@ void LEM_DPS::DefineAnimations(UINT idx) {
 	if (dpsgimbal_proc[0] < 0) dpsgimbal_proc[0] += 1.0;
 	dpsgimbal_proc[1] = rollGimbalActuator.GetPosition() / 360;
 	if (dpsgimbal_proc[1] < 0) dpsgimbal_proc[1] += 1.0;
-	lem->SetAnimation(anim_DPSGimbalPitch, dpsgimbal_proc[0]); lem->SetAnimation(anim_DPSGimbalRoll, dpsgimbal_proc[1]);
+	lem->ApplyAnimation(anim_DPSGimbalPitch, dpsgimbal_proc[0]); lem->ApplyAnimation(anim_DPSGimbalRoll, dpsgimbal_proc[1]);
 }
 
 void LEM_DPS::DeleteAnimations() {
@@ -569,8 +569,8 @@ void LEM_DPS::Timestep(double simt, double simdt) {
 	if (dpsgimbal_proc[0] < 0) dpsgimbal_proc[0] += 1.0;
 	dpsgimbal_proc[1] = rollGimbalActuator.GetPosition() / 360;
 	if (dpsgimbal_proc[1] < 0) dpsgimbal_proc[1] += 1.0;
-	if (dpsgimbal_proc[0] - dpsgimbal_proc_last[0] != 0.0) lem->SetAnimation(anim_DPSGimbalPitch, dpsgimbal_proc[0]);
-	if (dpsgimbal_proc[1] - dpsgimbal_proc_last[1] != 0.0) lem->SetAnimation(anim_DPSGimbalRoll, dpsgimbal_proc[1]);
+	if (dpsgimbal_proc[0] - dpsgimbal_proc_last[0] != 0.0) lem->QueueAnimation(anim_DPSGimbalPitch, dpsgimbal_proc[0]);
+	if (dpsgimbal_proc[1] - dpsgimbal_proc_last[1] != 0.0) lem->QueueAnimation(anim_DPSGimbalRoll, dpsgimbal_proc[1]);
 	dpsgimbal_proc_last[0] = dpsgimbal_proc[0];
 	dpsgimbal_proc_last[1] = dpsgimbal_proc[1];
 
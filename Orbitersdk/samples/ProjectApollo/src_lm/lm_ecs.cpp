@@ -257,7 +257,7 @@ void LEMOverheadHatch::DefineAnimations(UINT idx)
 	anim_OvhdHatch = lem->CreateAnimation(0.0);
 	ach_OvhdHatch = lem->AddAnimationComponent(anim_OvhdHatch, 0.0f, 1.0f, &mgt_OvhdHatch);
 
-	lem->SetAnimation(anim_OvhdHatch, ovhdhatch_state.State());
+	lem->ApplyAnimation(anim_OvhdHatch, ovhdhatch_state.State());
 }
 
 void LEMOverheadHatch::DefineAnimationsVC(UINT idx)
@@ -284,30 +284,30 @@ void LEMOverheadHatch::DefineAnimationsVC(UINT idx)
 	ach_OvhdHatchHandle = lem->AddAnimationComponent(anim_OvhdHatchHandle, 0.0f, 1.0f, &mgt_OvhdHatchHandle, ach_OvhdHatchVC);
 	ach_OvhdHatchReliefValve = lem->AddAnimationComponent(anim_OvhdHatchReliefValve, 0.0f, 1.0f, &mgt_OvhdHatchReliefValve, ach_OvhdHatchVC);
 
-	lem->SetAnimation(anim_OvhdHatchVC, ovhdhatch_state.State());
-	lem->SetAnimation(anim_OvhdHatchHandle, 0.0);
-	lem->SetAnimation(anim_OvhdHatchReliefValve, 0.0);
+	lem->ApplyAnimation(anim_OvhdHatchVC, ovhdhatch_state.State());
+	lem->ApplyAnimation(anim_OvhdHatchHandle, 0.0);
+	lem->ApplyAnimation(anim_OvhdHatchReliefValve, 0.0);
 }
 
 void LEMOverheadHatch::Timestep(double simdt)
 {
 	if (ovhdhatch_state.Process(simdt)) {
-		lem->SetAnimation(anim_OvhdHatch, ovhdhatch_state.State());
-		lem->SetAnimation(anim_OvhdHatchVC, ovhdhatch_state.State());
+		lem->QueueAnimation(anim_OvhdHatch, ovhdhatch_state.State());
+		lem->QueueAnimation(anim_OvhdHatchVC, ovhdhatch_state.State());
 	}
 
 	if (ovhdHatchHandle->GetState() == 1) {
-		lem->SetAnimation(anim_OvhdHatchHandle, 1.0);
+		lem->QueueAnimation(anim_OvhdHatchHandle, 1.0);
 	} else {
-		lem->SetAnimation(anim_OvhdHatchHandle, 0.0);
+		lem->QueueAnimation(anim_OvhdHatchHandle, 0.0);
 	}
 
 	if (ovhdReliefValve->GetState() == 2) {
-		lem->SetAnimation(anim_OvhdHatchReliefValve, 1.0);
+		lem->QueueAnimation(anim_OvhdHatchReliefValve, 1.0);
 	} else if (ovhdReliefValve->GetState() == 1) {
-		lem->SetAnimation(anim_OvhdHatchReliefValve, 0.5);
+		lem->QueueAnimation(anim_OvhdHatchReliefValve, 0.5);
 	} else {
-		lem->SetAnimation(anim_OvhdHatchReliefValve, 0.0);
+		lem->QueueAnimation(anim_OvhdHatchReliefValve, 0.0);
 	}
 }
 
@@ -457,7 +457,7 @@ void LEMForwardHatch::DefineAnimations(UINT idx)
 	static MGROUP_ROTATE	mgt_Hatch(idx, &meshgroup_Hatch, 1, _V(0.39366, -0.57839, 1.63386), _V(0.0, 1.0, 0.0), (float)(-85.0*RAD));
 	anim_Hatch = lem->CreateAnimation(0.0);
 	ach_Hatch = lem->AddAnimationComponent(anim_Hatch, 0.0f, 1.0f, &mgt_Hatch);
-	lem->SetAnimation(anim_Hatch, hatch_state.State());
+	lem->ApplyAnimation(anim_Hatch, hatch_state.State());
 }
 
 void LEMForwardHatch::DefineAnimationsVC(UINT idx)
@@ -485,33 +485,33 @@ void LEMForwardHatch::DefineAnimationsVC(UINT idx)
 	ach_FwdHatchHandle = lem->AddAnimationComponent(anim_FwdHatchHandle, 0.0f, 1.0f, &mgt_FwdHatchHandle, ach_FwdHatchVC);
 	ach_FwdHatchReliefValve = lem->AddAnimationComponent(anim_FwdHatchReliefValve, 0.0f, 1.0f, &mgt_FwdHatchReliefValve, ach_FwdHatchVC);
 
-	lem->SetAnimation(anim_FwdHatchVC, hatch_state.State());
-	lem->SetAnimation(anim_FwdHatchHandle, 0.0);
-	lem->SetAnimation(anim_FwdHatchReliefValve, 0.0);
+	lem->ApplyAnimation(anim_FwdHatchVC, hatch_state.State());
+	lem->ApplyAnimation(anim_FwdHatchHandle, 0.0);
+	lem->ApplyAnimation(anim_FwdHatchReliefValve, 0.0);
 }
 
 void LEMForwardHatch::Timestep(double simdt)
 {
 	if (hatch_state.Process(simdt)) {
-		lem->SetAnimation(anim_Hatch, hatch_state.State());
-		lem->SetAnimation(anim_FwdHatchVC, hatch_state.State());
+		lem->QueueAnimation(anim_Hatch, hatch_state.State());
+		lem->QueueAnimation(anim_FwdHatchVC, hatch_state.State());
 	}
 
 	if (ForwardHatchHandle->GetState() == 1) {
-		lem->SetAnimation(anim_FwdHatchHandle, 1.0);
+		lem->QueueAnimation(anim_FwdHatchHandle, 1.0);
 	}
 	else {
-		lem->SetAnimation(anim_FwdHatchHandle, 0.0);
+		lem->QueueAnimation(anim_FwdHatchHandle, 0.0);
 	}
 
 	if (ForwardHatchReliefValve->GetState() == 2) {
-		lem->SetAnimation(anim_FwdHatchReliefValve, 1.0);
+		lem->QueueAnimation(anim_FwdHatchReliefValve, 1.0);
 	}
 	else if (ForwardHatchReliefValve->GetState() == 1) {
-		lem->SetAnimation(anim_FwdHatchReliefValve, 0.5);
+		lem->QueueAnimation(anim_FwdHatchReliefValve, 0.5);
 	}
 	else {
-		lem->SetAnimation(anim_FwdHatchReliefValve, 0.0);
+		lem->QueueAnimation(anim_FwdHatchReliefValve, 0.0);
 	}
 }
 
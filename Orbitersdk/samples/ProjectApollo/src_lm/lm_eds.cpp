@@ -417,7 +417,7 @@ void LEM_EDS::DefineAnimations(UINT idx) {
 	static MGROUP_ROTATE mgt_Ladder(idx, &meshgroup_Ladder, 1, DES_LEG_PIVOT[0], DES_LEG_AXIS[0], (float)(45 * RAD));
 	lem->AddAnimationComponent(anim_Gear, 0.0, 1, &mgt_Ladder);
 
-	lem->SetAnimation(anim_Gear, gear_state.State());
+	lem->ApplyAnimation(anim_Gear, gear_state.State());
 }
 
 void LEM_EDS::DeleteAnimations(){
@@ -431,7 +431,7 @@ void LEM_EDS::Timestep(double simdt) {
 	// Animate Gear
 	if (lem->stage < 2) {
 		if (gear_state.Process(simdt)) {
-			lem->SetAnimation(anim_Gear, gear_state.State());
+			lem->QueueAnimation(anim_Gear, gear_state.State());
 		}
 		if (LG_Deployed) gear_state.Open();
 	}
@@ -227,8 +227,8 @@ void LEM_RR::Timestep(double simdt) {
 	if (rr_proc[0] < 0) rr_proc[0] += 1.0;
 	rr_proc[1] = -trunnionAngle / PI2;
 	if (rr_proc[1] < 0) rr_proc[1] += 1.0;
-	if (rr_proc[0] - rr_proc_last[0] != 0.0) lem->SetAnimation(anim_RRPitch, rr_proc[0]);
-	if (rr_proc[1] - rr_proc_last[1] != 0.0) lem->SetAnimation(anim_RRYaw, rr_proc[1]);
+	if (rr_proc[0] - rr_proc_last[0] != 0.0) lem->QueueAnimation(anim_RRPitch, rr_proc[0]);
+	if (rr_proc[1] - rr_proc_last[1] != 0.0) lem->QueueAnimation(anim_RRYaw, rr_proc[1]);
 	rr_proc_last[0] = rr_proc[0];
 	rr_proc_last[1] = rr_proc[1];
 
@@ -803,7 +803,7 @@ void LEM_RR::DefineAnimations(UINT idx) {
 	if (rr_proc[0] < 0) rr_proc[0] += 1.0;
 	rr_proc[1] = -trunnionAngle / PI2;
 	if (rr_proc[1] < 0) rr_proc[1] += 1.0;
-	lem->SetAnimation(anim_RRPitch, rr_proc[0]); lem->SetAnimation(anim_RRYaw, rr_proc[1]);
+	lem->ApplyAnimation(anim_RRPitch, rr_proc[0]); lem->ApplyAnimation(anim_RRYaw, rr_proc[1]);
 }
 
 double LEM_RR::GetAntennaTempF() {
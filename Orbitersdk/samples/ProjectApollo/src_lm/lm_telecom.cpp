@@ -359,23 +359,52 @@ void LM_VHF::SaveState(FILEHANDLE scn)
 }
 
 //PCM
+
+// Most words generated in one timestep before frames are skipped, about 10 seconds of HBR
+#define PCM_MAX_STEP_WORDS 65536
+
 LM_PCM::LM_PCM()
 {
 	lem = NULL;
 	PCMHeat = 0;
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
-	mcc_size = 0; mcc_offset = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = 0;
 	frame_addr = 0;
 	frame_count = 0;
+	frame_serial = 0;
 	m_socket = INVALID_SOCKET;
+	socketSink = NULL;
+	fileSink = NULL;
+	decimated = false;
+	frames_skipped = 0;
+	stream_time = 0;
+	word_length = hbr_engine.WordTime();
 }
 
 LM_PCM::~LM_PCM()
 {
+	if (downlink.GetSent() > 0 || frames_skipped > 0) {
+		char buffer[256];
+		sprintf(buffer, "(LM PCM) Downlink: %llu words sent, %llu words dropped, %llu frames skipped", downlink.GetSent(), downlink.GetDropped(), frames_skipped);
+		oapiWriteLog(buffer);
+	}
+	if (archive.IsOpen()) {
+		char buffer[256];
+		sprintf(buffer, "(LM PCM) Archive: %llu frames recorded, %llu rewinds", archive.GetFrames(), archive.GetRewinds());
+		oapiWriteLog(buffer);
+	}
+
+	// The transport deletes the sinks
+	if (socketSink) {
+		downlink.RemoveSink(socketSink);
+	}
+	if (fileSink) {
+		downlink.RemoveSink(fileSink);
+	}
+
 	// Close telemetry socket
 	if (m_socket != INVALID_SOCKET) {
 		shutdown(m_socket, 2); // Shutdown both streams
@@ -389,7 +418,6 @@ void LM_PCM::Init(LEM *vessel, h_HeatLoad *pcmh)
 	PCMHeat = pcmh;
 	conn_state = 0;
 	uplink_state = 0; rx_offset = 0;
-	mcc_size = 0; mcc_offset = 0;
 	wsk_error = 0;
 	last_update = 0;
 	last_rx = MINUS_INFINITY;
@@ -479,36 +507,120 @@ void LM_PCM::Timestep(double simt)
 	// Otherwise we would abort here (I think)
 
 	// Generate PCM datastream
-	if(lem->TLMBitrateSwitch.GetState() == TOGGLESWITCH_DOWN){
-		tx_size = (int)((simt - last_update) / 0.005);
-		// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
-		if(tx_size > 0){
-			last_update = simt;
-			if(tx_size < 1024){
-				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_lbr();
-					tx_offset++;
-				}
-				perform_io(simt);
+	bool lbr = (lem->TLMBitrateSwitch.GetState() == TOGGLESWITCH_DOWN);
+	int words_per_frame = lbr ? LMLBRFormat::Words : LMHBRFormat::Words;
+	double elapsed = simt - last_update;
+
+	// Don't try to catch up across a time jump
+	if (elapsed > 60.0) {
+		elapsed = 0.0;
+		last_update = simt;
+	}
+
+	word_length = lbr ? lbr_engine.WordTime() : hbr_engine.WordTime();
+	tx_size = (int)(elapsed / word_length);
+	// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
+	if(tx_size > 0){
+		last_update = simt;
+		stream_time = simt - tx_size * word_length;
+
+		//
+		// Every word is generated, unless there are too many to keep up with, or decimation
+		// is enabled and more than a frame is due. Then the current frame is finished, the
+		// frames in between are skipped, and the last frame is generated.
+		//
+
+		int remaining = words_per_frame - word_addr;
+		if ((decimated || tx_size > PCM_MAX_STEP_WORDS) && tx_size > remaining + words_per_frame) {
+			int skip = (tx_size - remaining) / words_per_frame - 1;
+
+			if (!decimated && frames_skipped == 0) {
+				char buffer[256];
+				sprintf(buffer, "(LM PCM) Downlink can't keep up with time acceleration, %d frames skipped", skip);
+				oapiWriteLog(buffer);
 			}
+
+			generate_words(remaining, lbr);
+			skip_frames(skip, lbr);
+			generate_words(tx_size - remaining - skip * words_per_frame, lbr);
+		}
+		else {
+			generate_words(tx_size, lbr);
 		}
+		perform_io(simt);
 	}
-	else {
-		tx_size = (int)((simt - last_update) / 0.00015625);
-		// sprintf(oapiDebugString(),"Need to send %d bytes",tx_size);
-		if(tx_size > 0){
-			last_update = simt;
-			if(tx_size < 1024){
-				tx_offset = 0;
-				while(tx_offset < tx_size){
-					generate_stream_hbr();
-					tx_offset++;
-				}			
-				perform_io(simt);
-			}
+}
+
+void LM_PCM::generate_words(int count, bool lbr)
+{
+	int words_per_frame = lbr ? LMLBRFormat::Words : LMHBRFormat::Words;
+
+	while (count > 0) {
+		int n = (count < 1024) ? count : 1024;
+		int first = word_addr;
+
+		if (lbr) {
+			lbr_engine.Generate(*this, tx_data, n);
+		}
+		else {
+			hbr_engine.Generate(*this, tx_data, n);
 		}
+
+		// The transport thread sends it on
+		downlink.Push(tx_data, n);
+
+		// Stamp the words with the time they were due, not the end of the timestep
+		if (archive.IsOpen()) {
+			double lag = last_update - stream_time;
+			archive.Write(tx_data, n, first, words_per_frame, word_length, lem->GetMissionTime() - lag, stream_time, oapiGetSimMJD() - lag / 86400.0);
+		}
+		stream_time += n * word_length;
+		count -= n;
+	}
+}
+
+void LM_PCM::skip_frames(int count, bool lbr)
+{
+	int words_per_frame = lbr ? LMLBRFormat::Words : LMHBRFormat::Words;
+
+	stream_time += count * words_per_frame * word_length;
+
+	if (lbr) {
+		lbr_engine.SkipFrames(*this, count);
+	}
+	else {
+		hbr_engine.SkipFrames(*this, count);
 	}
+	frames_skipped += count;
+}
+
+bool LM_PCM::OpenDownlinkFile(const char *fname)
+{
+	FILE *f = fopen(fname, "wb");
+	if (!f) {
+		char buffer[512];
+		sprintf(buffer, "(LM PCM) Can't open downlink file %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+
+	if (fileSink) {
+		downlink.RemoveSink(fileSink);
+	}
+	fileSink = new PCMFileSink(f);
+	downlink.AddSink(fileSink);
+	return true;
+}
+
+bool LM_PCM::OpenArchive(const char *fname)
+{
+	if (!archive.Open(fname, PCM_ARCHIVE_LM)) {
+		char buffer[512];
+		sprintf(buffer, "(LM PCM) Can't open telemetry archive %s", fname);
+		oapiWriteLog(buffer);
+		return false;
+	}
+	return true;
 }
 
 // Scale data to 255 steps for transmission in the PCM datastream.
@@ -543,27 +655,21 @@ void LM_PCM::perform_io(double simt){
 		case 0: // UNINITIALIZED
 			break;
 		case 1: // INITALIZED, LISTENING
-				// Do we have data from MCC?
-			if (mcc_size > 0) {
-				// sprintf(oapiDebugString(), "MCCSIZE %d LRX %f LRXINT %f", mcc_size, last_rx, ((simt - last_rx) / 0.005));
+				// Do we have queued uplink data?
+			if (!uplink.Empty()) {
+				// sprintf(oapiDebugString(), "UPLINK %d LRX %f LRXINT %f", uplink.Size(), last_rx, ((simt - last_rx) / 0.005));
 				// Should we recieve?
 				if ((fabs(simt - last_rx) / 0.1) < 1 || lem->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
 					return; // No
 				}
 				last_rx = simt;
 				// Yes. Take a byte
-				rx_data[rx_offset] = mcc_data[mcc_offset];
-				mcc_offset++;
+				uplink.Pop(rx_data[rx_offset]);
 				// If uplink isn't blocked
 				if (lem->COMM_UP_DATA_LINK_CB.IsPowered() && lem->Panel12UpdataLinkSwitch.GetState() == THREEPOSSWITCH_DOWN) {
 					// Handle it
 					handle_uplink();
 				}
-				// Are we done?
-				if (mcc_offset >= mcc_size) {
-					// We reached the end of the MCC buffer.
-					mcc_offset = mcc_size = 0;
-				}
 			}
 			else {
 				// Try to accept
@@ -571,38 +677,31 @@ void LM_PCM::perform_io(double simt){
 				if (AcceptSocket != INVALID_SOCKET) {
 					conn_state = 2; // Accept this!
 					wsk_error = 0; // For now
+					socketSink = new PCMSocketSink(AcceptSocket);
+					downlink.AddSink(socketSink);
 				}
 			}
 			// Otherwise loop and try again.
 			break;
 		case 2: // CONNECTED			
-			int bytesSent,bytesRecv;
+			int bytesRecv;
 
-			bytesSent = send(AcceptSocket, (char *)tx_data, tx_size, 0 );
-			if(bytesSent == SOCKET_ERROR){
-				long errnumber = WSAGetLastError();
+			// The downlink is sent by the transport thread, check how that went
+			if(socketSink->Failed()){
+				long errnumber = socketSink->GetError();
 				switch(errnumber){
-					// KNOWN CODES that we can ignore
-					case 10035: // Operation Would Block
-						// We can ignore this entirely. It's not an error.
-						break;
-
 					case 10038: // Socket isn't a socket
 					case 10053: // Software caused connection abort
 					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
 						break;
 
 					default:           // If unknown
 						wsk_error = 1; // do this
 						sprintf(wsk_emsg,"LM-TELECOM: send() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
-						break;					
+						break;
 				}
+				close_connection(); // Accept another
+				return;
 			}
 			// Should we receive?
 			if (((simt - last_rx) / 0.005) < 1 || lem->agc.InterruptPending(ApolloGuidance::Interrupt::UPRUPT)) {
@@ -621,34 +720,24 @@ void LM_PCM::perform_io(double simt){
 					case 10053: // Software caused connection abort
 					case 10038: // Socket isn't a socket
 					case 10054: // Connection reset by peer
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
+						close_connection(); // Accept another
 						break;
 
 					default:           // If unknown
 						wsk_error = 1; // do this
 						sprintf(wsk_emsg,"LM-TELECOM: recv() failed: %ld",errnumber);
-						closesocket(AcceptSocket);
-						conn_state = 1; // Accept another
-						uplink_state = 0; rx_offset = 0;
+						close_connection(); // Accept another
 						break;					
 				}
-				// Do we have data from MCC instead?
-				if (mcc_size > 0) {
+				// Do we have queued uplink data instead?
+				if (!uplink.Empty()) {
 					// Yes. Take a byte
-					rx_data[rx_offset] = mcc_data[mcc_offset];
-					mcc_offset++;
+					uplink.Pop(rx_data[rx_offset]);
 					// If the telemetry data-path is disconnected, discard the data
 					if (lem->COMM_UP_DATA_LINK_CB.IsPowered() && lem->Panel12UpdataLinkSwitch.GetState() == THREEPOSSWITCH_DOWN) {
 						// otherwise handle it
 						handle_uplink();
 					}
-					// Are we done?
-					if (mcc_offset >= mcc_size) {
-						// We reached the end of the MCC buffer.
-						mcc_offset = mcc_size = 0;
-					}
 				}
 			}else{
 				// FIXME: Check to make sure the up-data equipment is powered
@@ -661,18 +750,12 @@ void LM_PCM::perform_io(double simt){
 				}
 				else
 				{
-					// Do we have data from MCC instead?
-					if (mcc_size > 0) {
+					// Do we have queued uplink data instead?
+					if (!uplink.Empty()) {
 						// Yes. Take a byte
-						rx_data[rx_offset] = mcc_data[mcc_offset];
-						mcc_offset++;
+						uplink.Pop(rx_data[rx_offset]);
 						// Handle it
 						handle_uplink();
-						// Are we done?
-						if (mcc_offset >= mcc_size) {
-							// We reached the end of the MCC buffer.
-							mcc_offset = mcc_size = 0;
-						}
 					}
 				}
 			}
@@ -680,6 +763,14 @@ void LM_PCM::perform_io(double simt){
 	}
 }
 
+// Stop sending to the telemetry client and wait for another one. The sink closes the socket.
+void LM_PCM::close_connection() {
+	downlink.RemoveSink(socketSink);
+	socketSink = NULL;
+	conn_state = 1;
+	uplink_state = 0; rx_offset = 0;
+}
+
 // Handle data moved to buffer from either the socket or mcc buffer
 void LM_PCM::handle_uplink()
 {
@@ -766,794 +857,429 @@ void LM_PCM::handle_uplink()
 	}
 }
 
-void LM_PCM::generate_stream_hbr(){
-	unsigned char data=0;
-	// 128 words per frame, 50 frames pre second
-	switch(word_addr){
-		case 0: tx_data[tx_offset] = 0375;										// SYNC 1
-			lem->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);	// And generate DOWNRUPT (We read the data out at 120)
-			break;
-		case 1: tx_data[tx_offset] = 0312; break;         // SYNC 2
-		case 2: tx_data[tx_offset] = 0150; break;         // SYNC 3
-		case 3: tx_data[tx_offset] = frame_addr+1; break; // SYNC 4 & FRAME COUNT
-		case 4: // ** MAGIC WORD 0 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(01,LTLM_D,0x001); break;
-		    case 1: tx_data[tx_offset] = measure(01,LTLM_A,4); break;
-		    case 2: tx_data[tx_offset] = measure(01,LTLM_A,8); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_A,12); break;
-		    case 4: tx_data[tx_offset] = measure(01,LTLM_A,16); break;
-		    case 5: tx_data[tx_offset] = measure(01,LTLM_D,0x003); break;
-		    case 6: tx_data[tx_offset] = measure(01,LTLM_A,23); break;
-		    case 7: tx_data[tx_offset] = measure(01,LTLM_A,27); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_A,31); break;
-		    case 9: tx_data[tx_offset] = measure(01,LTLM_A,35); break;
-		    case 10: tx_data[tx_offset] = measure(01,LTLM_D,0x005); break;
-		    case 11: tx_data[tx_offset] = measure(01,LTLM_A,42); break;
-		    case 12: tx_data[tx_offset] = measure(01,LTLM_A,46); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_A,50); break;
-		    case 14: tx_data[tx_offset] = measure(01,LTLM_A,54); break;
-		    case 15: tx_data[tx_offset] = measure(01,LTLM_D,0x007); break;
-		    case 16: tx_data[tx_offset] = measure(01,LTLM_A,61); break;
-		    case 17: tx_data[tx_offset] = measure(01,LTLM_A,65); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_A,69); break;
-		    case 19: tx_data[tx_offset] = measure(01,LTLM_A,73); break;
-		    case 20: tx_data[tx_offset] = measure(01,LTLM_D,0x009); break;
-		    case 21: tx_data[tx_offset] = measure(01,LTLM_A,80); break;
-		    case 22: tx_data[tx_offset] = measure(01,LTLM_A,84); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_A,88); break;
-		    case 24: tx_data[tx_offset] = measure(01,LTLM_A,92); break;
-		    case 25: tx_data[tx_offset] = measure(01,LTLM_A,96); break;
-		    case 26: tx_data[tx_offset] = measure(01,LTLM_A,100); break;
-		    case 27: tx_data[tx_offset] = measure(01,LTLM_A,104); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_A,108); break;
-		    case 29: tx_data[tx_offset] = measure(01,LTLM_A,112); break;
-		    case 30: tx_data[tx_offset] = measure(01,LTLM_A,116); break;
-		    case 31: tx_data[tx_offset] = measure(01,LTLM_A,120); break;
-		    case 32: tx_data[tx_offset] = measure(01,LTLM_A,124); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_A,128); break;
-		    case 34: tx_data[tx_offset] = measure(01,LTLM_A,132); break;
-		    case 35: tx_data[tx_offset] = measure(01,LTLM_A,136); break;
-		    case 36: tx_data[tx_offset] = measure(01,LTLM_A,140); break;
-		    case 37: tx_data[tx_offset] = measure(01,LTLM_A,144); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_A,148); break;
-		    case 39: tx_data[tx_offset] = measure(01,LTLM_A,152); break;
-		    case 40: tx_data[tx_offset] = measure(01,LTLM_A,156); break;
-		    case 41: tx_data[tx_offset] = measure(01,LTLM_A,160); break;
-		    case 42: tx_data[tx_offset] = measure(01,LTLM_A,164); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_A,168); break;
-		    case 44: tx_data[tx_offset] = measure(01,LTLM_A,172); break;
-		    case 45: tx_data[tx_offset] = measure(01,LTLM_A,176); break;
-		    case 46: tx_data[tx_offset] = measure(01,LTLM_A,180); break;
-		    case 47: tx_data[tx_offset] = measure(01,LTLM_A,184); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_A,188); break;
-		    case 49: tx_data[tx_offset] = measure(01,LTLM_A,192); break;
-		  }
-		break;
-        case 5: tx_data[tx_offset] = measure(200,LTLM_E,0x1A); break;
-        case 6: tx_data[tx_offset] = measure(200,LTLM_E,0x1B); break;
-        case 7: tx_data[tx_offset] = measure(100,LTLM_E,0x01); break;
-        case 8: tx_data[tx_offset] = measure(200,LTLM_A,1); break;
-        case 9: tx_data[tx_offset] = measure(200,LTLM_A,2); break;
-        case 10: tx_data[tx_offset] = measure(200,LTLM_A,3); break;
-        case 11: tx_data[tx_offset] = measure(200,LTLM_A,4); break;
-        case 12: tx_data[tx_offset] = measure(200,LTLM_A,5); break;
-        case 13: tx_data[tx_offset] = measure(200,LTLM_A,6); break;
-        case 14: tx_data[tx_offset] = measure(200,LTLM_A,7); break;
-        case 15: tx_data[tx_offset] = measure(100,LTLM_E,0x002); break;
-        case 16: tx_data[tx_offset] = measure(100,LTLM_A,1); break;
-        case 17: tx_data[tx_offset] = measure(100,LTLM_A,2); break;
-        case 18: tx_data[tx_offset] = measure(100,LTLM_A,3); break;
-        case 19: tx_data[tx_offset] = measure(100,LTLM_A,4); break;
-        case 20: tx_data[tx_offset] = measure(100,LTLM_A,5); break;
-        case 21: tx_data[tx_offset] = measure(100,LTLM_A,6); break;
-        case 22: tx_data[tx_offset] = measure(100,LTLM_A,7); break;
-        case 23: tx_data[tx_offset] = measure(50,LTLM_E,0x001); break;
-        case 24: tx_data[tx_offset] = measure(100,LTLM_A,8); break;
-        case 25: tx_data[tx_offset] = measure(100,LTLM_A,9); break;
-        case 26: tx_data[tx_offset] = measure(100,LTLM_A,10); break;
-        case 27: tx_data[tx_offset] = measure(100,LTLM_A,11); break;
-        case 28: tx_data[tx_offset] = measure(100,LTLM_A,12); break;
-        case 29: tx_data[tx_offset] = measure(100,LTLM_A,13); break;
-        case 30: tx_data[tx_offset] = measure(100,LTLM_A,14); break;
-        case 31: tx_data[tx_offset] = measure(50,LTLM_E,0x002); break;
-		case 32:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_D,0x01A); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,8); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,18); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,28); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,37); break;
-		  }
-		  break;
-		case 33:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_D,0x01B); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,9); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,19); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,29); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,38); break;
-		  }
-		  break;
-		case 34:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_D,0x01C); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,10); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,20); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,30); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,39); break;
-		  }
-		  break;
-		case 35:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_D,0x01D); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,11); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,21); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,31); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,40); break;
-		  }
-		  break;
-		case 36: // ** MAGIC WORD 1 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(01,LTLM_A,1); break;
-		    case 1: tx_data[tx_offset] = measure(01,LTLM_A,5); break;
-		    case 2: tx_data[tx_offset] = measure(01,LTLM_A,9); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_A,13); break;
-		    case 4: tx_data[tx_offset] = measure(01,LTLM_A,17); break;
-		    case 5: tx_data[tx_offset] = measure(01,LTLM_A,20); break;
-		    case 6: tx_data[tx_offset] = measure(01,LTLM_A,24); break;
-		    case 7: tx_data[tx_offset] = measure(01,LTLM_A,28); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_A,33); break;
-		    case 9: tx_data[tx_offset] = measure(01,LTLM_A,36); break;
-		    case 10: tx_data[tx_offset] = measure(01,LTLM_A,39); break;
-		    case 11: tx_data[tx_offset] = measure(01,LTLM_A,43); break;
-		    case 12: tx_data[tx_offset] = measure(01,LTLM_A,47); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_A,51); break;
-		    case 14: tx_data[tx_offset] = measure(01,LTLM_A,55); break;
-		    case 15: tx_data[tx_offset] = measure(01,LTLM_A,58); break;
-		    case 16: tx_data[tx_offset] = measure(01,LTLM_A,62); break;
-		    case 17: tx_data[tx_offset] = measure(01,LTLM_A,66); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_A,70); break;
-		    case 19: tx_data[tx_offset] = measure(01,LTLM_A,74); break;
-		    case 20: tx_data[tx_offset] = measure(01,LTLM_A,77); break;
-		    case 21: tx_data[tx_offset] = measure(01,LTLM_A,81); break;
-		    case 22: tx_data[tx_offset] = measure(01,LTLM_A,85); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_A,89); break;
-		    case 24: tx_data[tx_offset] = measure(01,LTLM_A,93); break;
-		    case 25: tx_data[tx_offset] = measure(01,LTLM_A,97); break;
-		    case 26: tx_data[tx_offset] = measure(01,LTLM_A,101); break;
-		    case 27: tx_data[tx_offset] = measure(01,LTLM_A,105); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_A,109); break;
-		    case 29: tx_data[tx_offset] = measure(01,LTLM_A,113); break;
-		    case 30: tx_data[tx_offset] = measure(01,LTLM_A,117); break;
-		    case 31: tx_data[tx_offset] = measure(01,LTLM_A,121); break;
-		    case 32: tx_data[tx_offset] = measure(01,LTLM_A,125); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_A,129); break;
-		    case 34: tx_data[tx_offset] = measure(01,LTLM_A,133); break;
-		    case 35: tx_data[tx_offset] = measure(01,LTLM_A,137); break;
-		    case 36: tx_data[tx_offset] = measure(01,LTLM_A,141); break;
-		    case 37: tx_data[tx_offset] = measure(01,LTLM_A,145); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_A,149); break;
-		    case 39: tx_data[tx_offset] = measure(01,LTLM_A,153); break;
-		    case 40: tx_data[tx_offset] = measure(01,LTLM_A,157); break;
-		    case 41: tx_data[tx_offset] = measure(01,LTLM_A,161); break;
-		    case 42: tx_data[tx_offset] = measure(01,LTLM_A,165); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_A,169); break;
-		    case 44: tx_data[tx_offset] = measure(01,LTLM_A,173); break;
-		    case 45: tx_data[tx_offset] = measure(01,LTLM_A,177); break;
-		    case 46: tx_data[tx_offset] = measure(01,LTLM_A,181); break;
-		    case 47: tx_data[tx_offset] = measure(01,LTLM_A,185); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_A,189); break;
-		    case 49: tx_data[tx_offset] = measure(01,LTLM_A,193); break;
-		  }
-		break;
-        case 37: tx_data[tx_offset] = measure(200,LTLM_E,0x1A); break;
-        case 38: tx_data[tx_offset] = measure(200,LTLM_E,0x1B); break;
-        case 39: tx_data[tx_offset] = measure(100,LTLM_E,0x03); break;
-        case 40: tx_data[tx_offset] = measure(200,LTLM_A,1); break;
-        case 41: tx_data[tx_offset] = measure(200,LTLM_A,2); break;
-        case 42: tx_data[tx_offset] = measure(200,LTLM_A,3); break;
-        case 43: tx_data[tx_offset] = measure(200,LTLM_A,4); break;
-        case 44: tx_data[tx_offset] = measure(200,LTLM_A,5); break;
-        case 45: tx_data[tx_offset] = measure(200,LTLM_A,6); break;
-        case 46: tx_data[tx_offset] = measure(200,LTLM_A,7); break;
-        case 47: tx_data[tx_offset] = measure(100,LTLM_E,0x04); break;
-        case 48: tx_data[tx_offset] = measure(100,LTLM_A,15); break;
-        case 49: tx_data[tx_offset] = measure(100,LTLM_A,16); break;
-        case 50: tx_data[tx_offset] = measure(100,LTLM_A,17); break;
-        case 51: tx_data[tx_offset] = measure(100,LTLM_A,18); break;
-        case 52: tx_data[tx_offset] = measure(100,LTLM_A,19); break;
-        case 53: tx_data[tx_offset] = measure(100,LTLM_A,20); break;
-        case 54: tx_data[tx_offset] = measure(100,LTLM_A,21); break;
-        case 55: tx_data[tx_offset] = measure(100,LTLM_A,22); break;
-        case 56: tx_data[tx_offset] = measure(50,LTLM_A,1); break;
-        case 57: tx_data[tx_offset] = measure(50,LTLM_A,2); break;
-        case 58: tx_data[tx_offset] = measure(50,LTLM_A,3); break;
-        case 59: tx_data[tx_offset] = measure(50,LTLM_A,4); break;
-        case 60: tx_data[tx_offset] = measure(50,LTLM_A,5); break;
-        case 61: tx_data[tx_offset] = measure(50,LTLM_A,6); break;
-        case 62: tx_data[tx_offset] = measure(50,LTLM_A,7); break;
-        case 63: tx_data[tx_offset] = measure(50,LTLM_A,8); break;
-		case 64:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_A,1); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,12); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,22); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,32); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,41); break;
-		  }
-		  break;
-		case 65:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_A,2); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,13); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,23); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,33); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,42); break;
-		  }
-		  break;
-		case 66:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_A,3); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,14); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,24); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,34); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,43); break;
-		  }
-		  break;
-		case 67:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_A,4); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,15); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,25); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,35); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,44); break;
-		  }
-		  break;
-		case 68: // ** MAGIC WORD 2 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(01,LTLM_A,2); break;
-		    case 1: tx_data[tx_offset] = measure(01,LTLM_A,6); break;
-		    case 2: tx_data[tx_offset] = measure(01,LTLM_A,10); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_A,14); break;
-		    case 4: tx_data[tx_offset] = measure(01,LTLM_A,18); break;
-		    case 5: tx_data[tx_offset] = measure(01,LTLM_A,21); break;
-		    case 6: tx_data[tx_offset] = measure(01,LTLM_A,25); break;
-		    case 7: tx_data[tx_offset] = measure(01,LTLM_A,29); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_A,33); break;
-		    case 9: tx_data[tx_offset] = measure(01,LTLM_A,37); break;
-		    case 10: tx_data[tx_offset] = measure(01,LTLM_A,40); break;
-		    case 11: tx_data[tx_offset] = measure(01,LTLM_A,44); break;
-		    case 12: tx_data[tx_offset] = measure(01,LTLM_A,48); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_A,52); break;
-		    case 14: tx_data[tx_offset] = measure(01,LTLM_A,56); break;
-		    case 15: tx_data[tx_offset] = measure(01,LTLM_A,59); break;
-		    case 16: tx_data[tx_offset] = measure(01,LTLM_A,63); break;
-		    case 17: tx_data[tx_offset] = measure(01,LTLM_A,67); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_A,71); break;
-		    case 19: tx_data[tx_offset] = measure(01,LTLM_A,75); break;
-		    case 20: tx_data[tx_offset] = measure(01,LTLM_A,78); break;
-		    case 21: tx_data[tx_offset] = measure(01,LTLM_A,82); break;
-		    case 22: tx_data[tx_offset] = measure(01,LTLM_A,86); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_A,90); break;
-		    case 24: tx_data[tx_offset] = measure(01,LTLM_A,94); break;
-		    case 25: tx_data[tx_offset] = measure(01,LTLM_A,98); break;
-		    case 26: tx_data[tx_offset] = measure(01,LTLM_A,102); break;
-		    case 27: tx_data[tx_offset] = measure(01,LTLM_A,106); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_A,110); break;
-		    case 29: tx_data[tx_offset] = measure(01,LTLM_A,114); break;
-		    case 30: tx_data[tx_offset] = measure(01,LTLM_A,118); break;
-		    case 31: tx_data[tx_offset] = measure(01,LTLM_A,122); break;
-		    case 32: tx_data[tx_offset] = measure(01,LTLM_A,126); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_A,130); break;
-		    case 34: tx_data[tx_offset] = measure(01,LTLM_A,134); break;
-		    case 35: tx_data[tx_offset] = measure(01,LTLM_A,138); break;
-		    case 36: tx_data[tx_offset] = measure(01,LTLM_A,142); break;
-		    case 37: tx_data[tx_offset] = measure(01,LTLM_A,146); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_A,150); break;
-		    case 39: tx_data[tx_offset] = measure(01,LTLM_A,154); break;
-		    case 40: tx_data[tx_offset] = measure(01,LTLM_A,158); break;
-		    case 41: tx_data[tx_offset] = measure(01,LTLM_A,162); break;
-		    case 42: tx_data[tx_offset] = measure(01,LTLM_A,166); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_A,170); break;
-		    case 44: tx_data[tx_offset] = measure(01,LTLM_A,174); break;
-		    case 45: tx_data[tx_offset] = measure(01,LTLM_A,178); break;
-		    case 46: tx_data[tx_offset] = measure(01,LTLM_A,182); break;
-		    case 47: tx_data[tx_offset] = measure(01,LTLM_A,186); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_A,190); break;
-		    case 49: tx_data[tx_offset] = measure(01,LTLM_A,194); break;
-		  }
-		break;
-        case 69: tx_data[tx_offset] = measure(200,LTLM_E,0x1A); break;
-        case 70: tx_data[tx_offset] = measure(200,LTLM_E,0x1B); break;
-        case 71: tx_data[tx_offset] = measure(100,LTLM_E,0x01); break;
-        case 72: tx_data[tx_offset] = measure(200,LTLM_A,1); break;
-        case 73: tx_data[tx_offset] = measure(200,LTLM_A,2); break;
-        case 74: tx_data[tx_offset] = measure(200,LTLM_A,3); break;
-        case 75: tx_data[tx_offset] = measure(200,LTLM_A,4); break;
-        case 76: tx_data[tx_offset] = measure(200,LTLM_A,5); break;
-        case 77: tx_data[tx_offset] = measure(200,LTLM_A,6); break;
-        case 78: tx_data[tx_offset] = measure(200,LTLM_A,7); break;
-        case 79: tx_data[tx_offset] = measure(100,LTLM_E,0x02); break;
-        case 80: tx_data[tx_offset] = measure(100,LTLM_A,1); break;
-        case 81: tx_data[tx_offset] = measure(100,LTLM_A,2); break;
-        case 82: tx_data[tx_offset] = measure(100,LTLM_A,3); break;
-        case 83: tx_data[tx_offset] = measure(100,LTLM_A,4); break;
-        case 84: tx_data[tx_offset] = measure(100,LTLM_A,5); break;
-        case 85: tx_data[tx_offset] = measure(100,LTLM_A,6); break;
-        case 86: tx_data[tx_offset] = measure(100,LTLM_A,7); break;
-        case 87: tx_data[tx_offset] = measure(50,LTLM_E,0x03); break;
-        case 88: tx_data[tx_offset] = measure(100,LTLM_A,8); break;
-        case 89: tx_data[tx_offset] = measure(100,LTLM_A,9); break;
-        case 90: tx_data[tx_offset] = measure(100,LTLM_A,10); break;
-        case 91: tx_data[tx_offset] = measure(100,LTLM_A,11); break;
-        case 92: tx_data[tx_offset] = measure(100,LTLM_A,12); break;
-        case 93: tx_data[tx_offset] = measure(100,LTLM_A,13); break;
-        case 94: tx_data[tx_offset] = measure(100,LTLM_A,14); break;
-        case 95: tx_data[tx_offset] = measure(50,LTLM_E,0x04); break;
-        case 96: tx_data[tx_offset] = measure(50,LTLM_D,0x002); break;
-		case 97: // ** MAGIC WORD 3 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 1: tx_data[tx_offset] = measure(01,LTLM_E,0x001); break;
-		    case 2: tx_data[tx_offset] = measure(01,LTLM_E,0x002); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_E,0x003); break;
-		    case 4: tx_data[tx_offset] = measure(01,LTLM_E,0x004); break;
-		    case 5: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 6: tx_data[tx_offset] = measure(01,LTLM_E,0x005); break;
-		    case 7: tx_data[tx_offset] = measure(01,LTLM_E,0x006); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_E,0x007); break;
-		    case 9: tx_data[tx_offset] = measure(01,LTLM_E,0x008); break;
-		    case 10: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 11: tx_data[tx_offset] = measure(01,LTLM_E,0x009); break;
-		    case 12: tx_data[tx_offset] = measure(01,LTLM_E,0x010); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_E,0x011); break;
-		    case 14: tx_data[tx_offset] = measure(01,LTLM_E,0x012); break;
-		    case 15: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 16: tx_data[tx_offset] = measure(01,LTLM_E,0x013); break;
-		    case 17: tx_data[tx_offset] = measure(01,LTLM_E,0x014); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_E,0x015); break;
-		    case 19: tx_data[tx_offset] = measure(01,LTLM_E,0x016); break;
-		    case 20: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 21: tx_data[tx_offset] = measure(01,LTLM_E,0x17); break;
-		    case 22: tx_data[tx_offset] = measure(01,LTLM_E,0x18); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_E,0x19); break;
-		    case 24: tx_data[tx_offset] = measure(01,LTLM_E,0x20); break;
-		    case 25: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 26: tx_data[tx_offset] = measure(01,LTLM_E,0x21); break;
-		    case 27: tx_data[tx_offset] = measure(01,LTLM_E,0x22); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_E,0x23); break;
-		    case 29: tx_data[tx_offset] = measure(01,LTLM_E,0x25); break;
-		    case 30: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 31: tx_data[tx_offset] = measure(01,LTLM_E,0x26); break;
-		    case 32: tx_data[tx_offset] = measure(01,LTLM_E,0x27); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_E,0x28); break;
-		    case 34: tx_data[tx_offset] = measure(01,LTLM_E,0x30); break;
-		    case 35: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 36: tx_data[tx_offset] = measure(01,LTLM_E,0x31); break;
-		    case 37: tx_data[tx_offset] = measure(01,LTLM_E,0x32); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_E,0x33); break;
-		    case 39: tx_data[tx_offset] = measure(01,LTLM_E,0x35); break;
-		    case 40: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 41: tx_data[tx_offset] = measure(01,LTLM_E,0x36); break;
-		    case 42: tx_data[tx_offset] = measure(01,LTLM_E,0x37); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_E,0x38); break;
-		    case 44: tx_data[tx_offset] = measure(01,LTLM_E,0x40); break;
-		    case 45: tx_data[tx_offset] = measure(10,LTLM_A,5); break;
-		    case 46: tx_data[tx_offset] = measure(01,LTLM_E,0x41); break;
-		    case 47: tx_data[tx_offset] = measure(01,LTLM_E,0x42); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_E,0x43); break;
-		    case 49: tx_data[tx_offset] = measure(01,LTLM_E,0x45); break;
-		  }
-		break;
-		case 98:
-		  switch(frame_count){
-                    case 0: tx_data[tx_offset] = measure(10,LTLM_A,6); break;
-                    case 1: tx_data[tx_offset] = measure(10,LTLM_A,16); break;
-                    case 2: tx_data[tx_offset] = measure(10,LTLM_A,26); break;
-                    case 3: tx_data[tx_offset] = measure(10,LTLM_A,36); break;
-                    case 4: tx_data[tx_offset] = measure(10,LTLM_A,45); break;
-		  }
-		  break;
-		case 99: // ** MAGIC WORD 4 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 1: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 2: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_D,0x002); break;
-		    case 4: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 5: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 6: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 7: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_D,0x004); break;
-		    case 9: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 10: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 11: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 12: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_D,0x006); break;
-		    case 14: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 15: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 16: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 17: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_D,0x008); break;
-		    case 19: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 20: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 21: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 22: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_D,0x10); break;
-		    case 24: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 25: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 26: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 27: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_E,0x24); break;
-		    case 29: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 30: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 31: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 32: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_E,0x29); break;
-		    case 34: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 35: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 36: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 37: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_E,0x34); break;
-		    case 39: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 40: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 41: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 42: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_E,0x39); break;
-		    case 44: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		    case 45: tx_data[tx_offset] = measure(10,LTLM_A,7); break;
-		    case 46: tx_data[tx_offset] = measure(10,LTLM_A,17); break;
-		    case 47: tx_data[tx_offset] = measure(10,LTLM_A,27); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_E,0x44); break;
-		    case 49: tx_data[tx_offset] = measure(10,LTLM_E,0x001); break;
-		  }
-		break;
-		case 100: // ** MAGIC WORD 5 **
-		  switch(frame_addr){
-		    case 0: tx_data[tx_offset] = measure(01,LTLM_A,3); break;
-		    case 1: tx_data[tx_offset] = measure(01,LTLM_A,7); break;
-		    case 2: tx_data[tx_offset] = measure(01,LTLM_A,11); break;
-		    case 3: tx_data[tx_offset] = measure(01,LTLM_A,15); break;
-		    case 4: tx_data[tx_offset] = measure(01,LTLM_A,19); break;
-		    case 5: tx_data[tx_offset] = measure(01,LTLM_A,22); break;
-		    case 6: tx_data[tx_offset] = measure(01,LTLM_A,26); break;
-		    case 7: tx_data[tx_offset] = measure(01,LTLM_A,30); break;
-		    case 8: tx_data[tx_offset] = measure(01,LTLM_A,34); break;
-		    case 9: tx_data[tx_offset] = measure(01,LTLM_A,38); break;
-		    case 10: tx_data[tx_offset] = measure(01,LTLM_A,41); break;
-		    case 11: tx_data[tx_offset] = measure(01,LTLM_A,45); break;
-		    case 12: tx_data[tx_offset] = measure(01,LTLM_A,49); break;
-		    case 13: tx_data[tx_offset] = measure(01,LTLM_A,53); break;
-		    case 14: tx_data[tx_offset] = measure(01,LTLM_A,57); break;
-		    case 15: tx_data[tx_offset] = measure(01,LTLM_A,60); break;
-		    case 16: tx_data[tx_offset] = measure(01,LTLM_A,64); break;
-		    case 17: tx_data[tx_offset] = measure(01,LTLM_A,68); break;
-		    case 18: tx_data[tx_offset] = measure(01,LTLM_A,72); break;
-		    case 19: tx_data[tx_offset] = measure(01,LTLM_A,76); break;
-		    case 20: tx_data[tx_offset] = measure(01,LTLM_A,79); break;
-		    case 21: tx_data[tx_offset] = measure(01,LTLM_A,83); break;
-		    case 22: tx_data[tx_offset] = measure(01,LTLM_A,87); break;
-		    case 23: tx_data[tx_offset] = measure(01,LTLM_A,91); break;
-		    case 24: tx_data[tx_offset] = measure(01,LTLM_A,95); break;
-		    case 25: tx_data[tx_offset] = measure(01,LTLM_A,99); break;
-		    case 26: tx_data[tx_offset] = measure(01,LTLM_A,103); break;
-		    case 27: tx_data[tx_offset] = measure(01,LTLM_A,107); break;
-		    case 28: tx_data[tx_offset] = measure(01,LTLM_A,111); break;
-		    case 29: tx_data[tx_offset] = measure(01,LTLM_A,115); break;
-		    case 30: tx_data[tx_offset] = measure(01,LTLM_A,119); break;
-		    case 31: tx_data[tx_offset] = measure(01,LTLM_A,123); break;
-		    case 32: tx_data[tx_offset] = measure(01,LTLM_A,127); break;
-		    case 33: tx_data[tx_offset] = measure(01,LTLM_A,131); break;
-		    case 34: tx_data[tx_offset] = measure(01,LTLM_A,135); break;
-		    case 35: tx_data[tx_offset] = measure(01,LTLM_A,139); break;
-		    case 36: tx_data[tx_offset] = measure(01,LTLM_A,143); break;
-		    case 37: tx_data[tx_offset] = measure(01,LTLM_A,147); break;
-		    case 38: tx_data[tx_offset] = measure(01,LTLM_A,151); break;
-		    case 39: tx_data[tx_offset] = measure(01,LTLM_A,155); break;
-		    case 40: tx_data[tx_offset] = measure(01,LTLM_A,159); break;
-		    case 41: tx_data[tx_offset] = measure(01,LTLM_A,163); break;
-		    case 42: tx_data[tx_offset] = measure(01,LTLM_A,167); break;
-		    case 43: tx_data[tx_offset] = measure(01,LTLM_A,171); break;
-		    case 44: tx_data[tx_offset] = measure(01,LTLM_A,175); break;
-		    case 45: tx_data[tx_offset] = measure(01,LTLM_A,179); break;
-		    case 46: tx_data[tx_offset] = measure(01,LTLM_A,183); break;
-		    case 47: tx_data[tx_offset] = measure(01,LTLM_A,187); break;
-		    case 48: tx_data[tx_offset] = measure(01,LTLM_A,191); break;
-		    case 49: tx_data[tx_offset] = measure(01,LTLM_A,195); break;
-		  }
-		break;
-        case 101: tx_data[tx_offset] = measure(200,LTLM_E,0x1A); break;
-        case 102: tx_data[tx_offset] = measure(200,LTLM_E,0x1B); break;
-        case 103: tx_data[tx_offset] = measure(100,LTLM_E,0x03); break;
-        case 104: tx_data[tx_offset] = measure(200,LTLM_A,1); break;
-        case 105: tx_data[tx_offset] = measure(200,LTLM_A,2); break;
-        case 106: tx_data[tx_offset] = measure(200,LTLM_A,3); break;
-        case 107: tx_data[tx_offset] = measure(200,LTLM_A,4); break;
-        case 108: tx_data[tx_offset] = measure(200,LTLM_A,5); break;
-        case 109: tx_data[tx_offset] = measure(200,LTLM_A,6); break;
-        case 110: tx_data[tx_offset] = measure(200,LTLM_A,7); break;
-        case 111: tx_data[tx_offset] = measure(100,LTLM_E,0x04); break;
-        case 112: tx_data[tx_offset] = measure(100,LTLM_A,15); break;
-        case 113: tx_data[tx_offset] = measure(100,LTLM_A,16); break;
-        case 114: tx_data[tx_offset] = measure(100,LTLM_A,17); break;
-        case 115: tx_data[tx_offset] = measure(100,LTLM_A,18); break;
-        case 116: tx_data[tx_offset] = measure(100,LTLM_A,19); break;
-        case 117: tx_data[tx_offset] = measure(100,LTLM_A,20); break;
-        case 118: tx_data[tx_offset] = measure(100,LTLM_A,21); break;
-        case 119: tx_data[tx_offset] = measure(100,LTLM_A,22); break;
-        case 120: // 50DS1A
-		{
-			// DOWNRUPT needs time to get data on the bus, so it has to have happened BEFORE we get here!
-			ChannelValue ch13;
-			ch13 = lem->agc.GetOutputChannel(013);
-			data = (lem->agc.GetOutputChannel(034) & 077400) >> 8;
-			if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
-			/*
-			sprintf(oapiDebugString(),"LGC DATA: %o (%lo %lo)",data,lem->agc.GetOutputChannel(034),
-				lem->agc.GetOutputChannel(035));
-			*/
-			tx_data[tx_offset] = data;
-			break;
-		}
-        case 121: // 50DS1B
-			data = (lem->agc.GetOutputChannel(034)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-		case 122: // 50DS1C
-			// PARITY OF CH 34 GOES IN TOP BIT HERE!
-			data = (lem->agc.GetOutputChannel(035)&077400)>>8;
-			tx_data[tx_offset] = data; 
-			break;
-        case 123: // 50DS1D
-			data = (lem->agc.GetOutputChannel(035)&0377);
-			tx_data[tx_offset] = data; 
-			break;
-        case 124: // 50DS1E
-			// PARITY OF CH 35 GOES IN TOP BIT HERE!
-			data = (lem->agc.GetOutputChannel(034)&077400)>>8;
-			tx_data[tx_offset] = data; 
-		case 125: // 50DS2A - AGS DATA
-			tx_data[tx_offset] = 0; break;
-        case 126: // 50DS2B - AGS DATA
-			tx_data[tx_offset] = 0; break;
-        case 127: // 50DS2C - AGS DATA
-			tx_data[tx_offset] = 0; break;
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
-			break;
-	}
-	word_addr++;
-	if(word_addr > 127){
-		word_addr = 0;
-		frame_addr++;
-		if(frame_addr > 49){
-			frame_addr = 0;
-		}
-		frame_count++;
-		if(frame_count > 4){
-			frame_count = 0;
-		}
-	}
+//
+// PCM downlink word maps, indexed by word address and 5-frame subcommutation count.
+// Words present in every frame repeat the same entry five times.
+//
+
+// HBR: 128 words per frame
+const PCMWordDef LMHBRFormat::Map[LMHBRFormat::Words][LMHBRFormat::Subframes] = {
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0375) },	// 0: SYNC 1
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0312) },	// 1: SYNC 2
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0150) },	// 2: SYNC 3
+	{ PCM_WORD_ALL(0, PCM_WORD_FRAMEADDR, 1) },	// 3: SYNC 4 & FRAME COUNT
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 0) },	// 4: MAGIC WORD 0
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01A) },	// 5
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01B) },	// 6
+	{ PCM_WORD_ALL(100, LTLM_E, 0x001) },	// 7
+	{ PCM_WORD_ALL(200, LTLM_A, 1) },	// 8
+	{ PCM_WORD_ALL(200, LTLM_A, 2) },	// 9
+	{ PCM_WORD_ALL(200, LTLM_A, 3) },	// 10
+	{ PCM_WORD_ALL(200, LTLM_A, 4) },	// 11
+	{ PCM_WORD_ALL(200, LTLM_A, 5) },	// 12
+	{ PCM_WORD_ALL(200, LTLM_A, 6) },	// 13
+	{ PCM_WORD_ALL(200, LTLM_A, 7) },	// 14
+	{ PCM_WORD_ALL(100, LTLM_E, 0x002) },	// 15
+	{ PCM_WORD_ALL(100, LTLM_A, 1) },	// 16
+	{ PCM_WORD_ALL(100, LTLM_A, 2) },	// 17
+	{ PCM_WORD_ALL(100, LTLM_A, 3) },	// 18
+	{ PCM_WORD_ALL(100, LTLM_A, 4) },	// 19
+	{ PCM_WORD_ALL(100, LTLM_A, 5) },	// 20
+	{ PCM_WORD_ALL(100, LTLM_A, 6) },	// 21
+	{ PCM_WORD_ALL(100, LTLM_A, 7) },	// 22
+	{ PCM_WORD_ALL(50, LTLM_E, 0x001) },	// 23
+	{ PCM_WORD_ALL(100, LTLM_A, 8) },	// 24
+	{ PCM_WORD_ALL(100, LTLM_A, 9) },	// 25
+	{ PCM_WORD_ALL(100, LTLM_A, 10) },	// 26
+	{ PCM_WORD_ALL(100, LTLM_A, 11) },	// 27
+	{ PCM_WORD_ALL(100, LTLM_A, 12) },	// 28
+	{ PCM_WORD_ALL(100, LTLM_A, 13) },	// 29
+	{ PCM_WORD_ALL(100, LTLM_A, 14) },	// 30
+	{ PCM_WORD_ALL(50, LTLM_E, 0x002) },	// 31
+	{ { 10, LTLM_D, 0x01A }, { 10, LTLM_A, 8 }, { 10, LTLM_A, 18 }, { 10, LTLM_A, 28 }, { 10, LTLM_A, 37 } },	// 32
+	{ { 10, LTLM_D, 0x01B }, { 10, LTLM_A, 9 }, { 10, LTLM_A, 19 }, { 10, LTLM_A, 29 }, { 10, LTLM_A, 38 } },	// 33
+	{ { 10, LTLM_D, 0x01C }, { 10, LTLM_A, 10 }, { 10, LTLM_A, 20 }, { 10, LTLM_A, 30 }, { 10, LTLM_A, 39 } },	// 34
+	{ { 10, LTLM_D, 0x01D }, { 10, LTLM_A, 11 }, { 10, LTLM_A, 21 }, { 10, LTLM_A, 31 }, { 10, LTLM_A, 40 } },	// 35
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 1) },	// 36: MAGIC WORD 1
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01A) },	// 37
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01B) },	// 38
+	{ PCM_WORD_ALL(100, LTLM_E, 0x003) },	// 39
+	{ PCM_WORD_ALL(200, LTLM_A, 1) },	// 40
+	{ PCM_WORD_ALL(200, LTLM_A, 2) },	// 41
+	{ PCM_WORD_ALL(200, LTLM_A, 3) },	// 42
+	{ PCM_WORD_ALL(200, LTLM_A, 4) },	// 43
+	{ PCM_WORD_ALL(200, LTLM_A, 5) },	// 44
+	{ PCM_WORD_ALL(200, LTLM_A, 6) },	// 45
+	{ PCM_WORD_ALL(200, LTLM_A, 7) },	// 46
+	{ PCM_WORD_ALL(100, LTLM_E, 0x004) },	// 47
+	{ PCM_WORD_ALL(100, LTLM_A, 15) },	// 48
+	{ PCM_WORD_ALL(100, LTLM_A, 16) },	// 49
+	{ PCM_WORD_ALL(100, LTLM_A, 17) },	// 50
+	{ PCM_WORD_ALL(100, LTLM_A, 18) },	// 51
+	{ PCM_WORD_ALL(100, LTLM_A, 19) },	// 52
+	{ PCM_WORD_ALL(100, LTLM_A, 20) },	// 53
+	{ PCM_WORD_ALL(100, LTLM_A, 21) },	// 54
+	{ PCM_WORD_ALL(100, LTLM_A, 22) },	// 55
+	{ PCM_WORD_ALL(50, LTLM_A, 1) },	// 56
+	{ PCM_WORD_ALL(50, LTLM_A, 2) },	// 57
+	{ PCM_WORD_ALL(50, LTLM_A, 3) },	// 58
+	{ PCM_WORD_ALL(50, LTLM_A, 4) },	// 59
+	{ PCM_WORD_ALL(50, LTLM_A, 5) },	// 60
+	{ PCM_WORD_ALL(50, LTLM_A, 6) },	// 61
+	{ PCM_WORD_ALL(50, LTLM_A, 7) },	// 62
+	{ PCM_WORD_ALL(50, LTLM_A, 8) },	// 63
+	{ { 10, LTLM_A, 1 }, { 10, LTLM_A, 12 }, { 10, LTLM_A, 22 }, { 10, LTLM_A, 32 }, { 10, LTLM_A, 41 } },	// 64
+	{ { 10, LTLM_A, 2 }, { 10, LTLM_A, 13 }, { 10, LTLM_A, 23 }, { 10, LTLM_A, 33 }, { 10, LTLM_A, 42 } },	// 65
+	{ { 10, LTLM_A, 3 }, { 10, LTLM_A, 14 }, { 10, LTLM_A, 24 }, { 10, LTLM_A, 34 }, { 10, LTLM_A, 43 } },	// 66
+	{ { 10, LTLM_A, 4 }, { 10, LTLM_A, 15 }, { 10, LTLM_A, 25 }, { 10, LTLM_A, 35 }, { 10, LTLM_A, 44 } },	// 67
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 2) },	// 68: MAGIC WORD 2
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01A) },	// 69
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01B) },	// 70
+	{ PCM_WORD_ALL(100, LTLM_E, 0x001) },	// 71
+	{ PCM_WORD_ALL(200, LTLM_A, 1) },	// 72
+	{ PCM_WORD_ALL(200, LTLM_A, 2) },	// 73
+	{ PCM_WORD_ALL(200, LTLM_A, 3) },	// 74
+	{ PCM_WORD_ALL(200, LTLM_A, 4) },	// 75
+	{ PCM_WORD_ALL(200, LTLM_A, 5) },	// 76
+	{ PCM_WORD_ALL(200, LTLM_A, 6) },	// 77
+	{ PCM_WORD_ALL(200, LTLM_A, 7) },	// 78
+	{ PCM_WORD_ALL(100, LTLM_E, 0x002) },	// 79
+	{ PCM_WORD_ALL(100, LTLM_A, 1) },	// 80
+	{ PCM_WORD_ALL(100, LTLM_A, 2) },	// 81
+	{ PCM_WORD_ALL(100, LTLM_A, 3) },	// 82
+	{ PCM_WORD_ALL(100, LTLM_A, 4) },	// 83
+	{ PCM_WORD_ALL(100, LTLM_A, 5) },	// 84
+	{ PCM_WORD_ALL(100, LTLM_A, 6) },	// 85
+	{ PCM_WORD_ALL(100, LTLM_A, 7) },	// 86
+	{ PCM_WORD_ALL(50, LTLM_E, 0x003) },	// 87
+	{ PCM_WORD_ALL(100, LTLM_A, 8) },	// 88
+	{ PCM_WORD_ALL(100, LTLM_A, 9) },	// 89
+	{ PCM_WORD_ALL(100, LTLM_A, 10) },	// 90
+	{ PCM_WORD_ALL(100, LTLM_A, 11) },	// 91
+	{ PCM_WORD_ALL(100, LTLM_A, 12) },	// 92
+	{ PCM_WORD_ALL(100, LTLM_A, 13) },	// 93
+	{ PCM_WORD_ALL(100, LTLM_A, 14) },	// 94
+	{ PCM_WORD_ALL(50, LTLM_E, 0x004) },	// 95
+	{ PCM_WORD_ALL(50, LTLM_D, 0x002) },	// 96
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 3) },	// 97: MAGIC WORD 3
+	{ { 10, LTLM_A, 6 }, { 10, LTLM_A, 16 }, { 10, LTLM_A, 26 }, { 10, LTLM_A, 36 }, { 10, LTLM_A, 45 } },	// 98
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 4) },	// 99: MAGIC WORD 4
+	{ PCM_WORD_ALL(0, PCM_WORD_COMMUTATED, 5) },	// 100: MAGIC WORD 5
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01A) },	// 101
+	{ PCM_WORD_ALL(200, LTLM_E, 0x01B) },	// 102
+	{ PCM_WORD_ALL(100, LTLM_E, 0x003) },	// 103
+	{ PCM_WORD_ALL(200, LTLM_A, 1) },	// 104
+	{ PCM_WORD_ALL(200, LTLM_A, 2) },	// 105
+	{ PCM_WORD_ALL(200, LTLM_A, 3) },	// 106
+	{ PCM_WORD_ALL(200, LTLM_A, 4) },	// 107
+	{ PCM_WORD_ALL(200, LTLM_A, 5) },	// 108
+	{ PCM_WORD_ALL(200, LTLM_A, 6) },	// 109
+	{ PCM_WORD_ALL(200, LTLM_A, 7) },	// 110
+	{ PCM_WORD_ALL(100, LTLM_E, 0x004) },	// 111
+	{ PCM_WORD_ALL(100, LTLM_A, 15) },	// 112
+	{ PCM_WORD_ALL(100, LTLM_A, 16) },	// 113
+	{ PCM_WORD_ALL(100, LTLM_A, 17) },	// 114
+	{ PCM_WORD_ALL(100, LTLM_A, 18) },	// 115
+	{ PCM_WORD_ALL(100, LTLM_A, 19) },	// 116
+	{ PCM_WORD_ALL(100, LTLM_A, 20) },	// 117
+	{ PCM_WORD_ALL(100, LTLM_A, 21) },	// 118
+	{ PCM_WORD_ALL(100, LTLM_A, 22) },	// 119
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 0) },	// 120: 50DS1A
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 1) },	// 121: 50DS1B
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 2) },	// 122: 50DS1C
+	{ PCM_WORD_ALL(0, PCM_WORD_AGC, 3) },	// 123: 50DS1D
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 124: 50DS1E, never filled in, sent as 0 like the AGS data
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 125: 50DS2A - AGS DATA
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 126: 50DS2B - AGS DATA
+	{ PCM_WORD_ALL(0, PCM_WORD_CONST, 0) },	// 127: 50DS2C - AGS DATA
+};
+
+// HBR words commutated over 50 frames, indexed by frame address
+static const PCMWordDef HBRCommutated[LMHBRFormat::CommutatedWords][LMHBRFormat::FrameAddrCycle] = {
+	{	// 4: MAGIC WORD 0
+		{ 1, LTLM_D, 0x001 }, { 1, LTLM_A, 4 }, { 1, LTLM_A, 8 }, { 1, LTLM_A, 12 }, { 1, LTLM_A, 16 }, { 1, LTLM_D, 0x003 }, { 1, LTLM_A, 23 }, { 1, LTLM_A, 27 }, { 1, LTLM_A, 31 }, { 1, LTLM_A, 35 },
+		{ 1, LTLM_D, 0x005 }, { 1, LTLM_A, 42 }, { 1, LTLM_A, 46 }, { 1, LTLM_A, 50 }, { 1, LTLM_A, 54 }, { 1, LTLM_D, 0x007 }, { 1, LTLM_A, 61 }, { 1, LTLM_A, 65 }, { 1, LTLM_A, 69 }, { 1, LTLM_A, 73 },
+		{ 1, LTLM_D, 0x009 }, { 1, LTLM_A, 80 }, { 1, LTLM_A, 84 }, { 1, LTLM_A, 88 }, { 1, LTLM_A, 92 }, { 1, LTLM_A, 96 }, { 1, LTLM_A, 100 }, { 1, LTLM_A, 104 }, { 1, LTLM_A, 108 }, { 1, LTLM_A, 112 },
+		{ 1, LTLM_A, 116 }, { 1, LTLM_A, 120 }, { 1, LTLM_A, 124 }, { 1, LTLM_A, 128 }, { 1, LTLM_A, 132 }, { 1, LTLM_A, 136 }, { 1, LTLM_A, 140 }, { 1, LTLM_A, 144 }, { 1, LTLM_A, 148 }, { 1, LTLM_A, 152 },
+		{ 1, LTLM_A, 156 }, { 1, LTLM_A, 160 }, { 1, LTLM_A, 164 }, { 1, LTLM_A, 168 }, { 1, LTLM_A, 172 }, { 1, LTLM_A, 176 }, { 1, LTLM_A, 180 }, { 1, LTLM_A, 184 }, { 1, LTLM_A, 188 }, { 1, LTLM_A, 192 },
+	},
+	{	// 36: MAGIC WORD 1
+		{ 1, LTLM_A, 1 }, { 1, LTLM_A, 5 }, { 1, LTLM_A, 9 }, { 1, LTLM_A, 13 }, { 1, LTLM_A, 17 }, { 1, LTLM_A, 20 }, { 1, LTLM_A, 24 }, { 1, LTLM_A, 28 }, { 1, LTLM_A, 33 }, { 1, LTLM_A, 36 },
+		{ 1, LTLM_A, 39 }, { 1, LTLM_A, 43 }, { 1, LTLM_A, 47 }, { 1, LTLM_A, 51 }, { 1, LTLM_A, 55 }, { 1, LTLM_A, 58 }, { 1, LTLM_A, 62 }, { 1, LTLM_A, 66 }, { 1, LTLM_A, 70 }, { 1, LTLM_A, 74 },
+		{ 1, LTLM_A, 77 }, { 1, LTLM_A, 81 }, { 1, LTLM_A, 85 }, { 1, LTLM_A, 89 }, { 1, LTLM_A, 93 }, { 1, LTLM_A, 97 }, { 1, LTLM_A, 101 }, { 1, LTLM_A, 105 }, { 1, LTLM_A, 109 }, { 1, LTLM_A, 113 },
+		{ 1, LTLM_A, 117 }, { 1, LTLM_A, 121 }, { 1, LTLM_A, 125 }, { 1, LTLM_A, 129 }, { 1, LTLM_A, 133 }, { 1, LTLM_A, 137 }, { 1, LTLM_A, 141 }, { 1, LTLM_A, 145 }, { 1, LTLM_A, 149 }, { 1, LTLM_A, 153 },
+		{ 1, LTLM_A, 157 }, { 1, LTLM_A, 161 }, { 1, LTLM_A, 165 }, { 1, LTLM_A, 169 }, { 1, LTLM_A, 173 }, { 1, LTLM_A, 177 }, { 1, LTLM_A, 181 }, { 1, LTLM_A, 185 }, { 1, LTLM_A, 189 }, { 1, LTLM_A, 193 },
+	},
+	{	// 68: MAGIC WORD 2
+		{ 1, LTLM_A, 2 }, { 1, LTLM_A, 6 }, { 1, LTLM_A, 10 }, { 1, LTLM_A, 14 }, { 1, LTLM_A, 18 }, { 1, LTLM_A, 21 }, { 1, LTLM_A, 25 }, { 1, LTLM_A, 29 }, { 1, LTLM_A, 33 }, { 1, LTLM_A, 37 },
+		{ 1, LTLM_A, 40 }, { 1, LTLM_A, 44 }, { 1, LTLM_A, 48 }, { 1, LTLM_A, 52 }, { 1, LTLM_A, 56 }, { 1, LTLM_A, 59 }, { 1, LTLM_A, 63 }, { 1, LTLM_A, 67 }, { 1, LTLM_A, 71 }, { 1, LTLM_A, 75 },
+		{ 1, LTLM_A, 78 }, { 1, LTLM_A, 82 }, { 1, LTLM_A, 86 }, { 1, LTLM_A, 90 }, { 1, LTLM_A, 94 }, { 1, LTLM_A, 98 }, { 1, LTLM_A, 102 }, { 1, LTLM_A, 106 }, { 1, LTLM_A, 110 }, { 1, LTLM_A, 114 },
+		{ 1, LTLM_A, 118 }, { 1, LTLM_A, 122 }, { 1, LTLM_A, 126 }, { 1, LTLM_A, 130 }, { 1, LTLM_A, 134 }, { 1, LTLM_A, 138 }, { 1, LTLM_A, 142 }, { 1, LTLM_A, 146 }, { 1, LTLM_A, 150 }, { 1, LTLM_A, 154 },
+		{ 1, LTLM_A, 158 }, { 1, LTLM_A, 162 }, { 1, LTLM_A, 166 }, { 1, LTLM_A, 170 }, { 1, LTLM_A, 174 }, { 1, LTLM_A, 178 }, { 1, LTLM_A, 182 }, { 1, LTLM_A, 186 }, { 1, LTLM_A, 190 }, { 1, LTLM_A, 194 },
+	},
+	{	// 97: MAGIC WORD 3
+		{ 10, LTLM_A, 5 }, { 1, LTLM_E, 0x001 }, { 1, LTLM_E, 0x002 }, { 1, LTLM_E, 0x003 }, { 1, LTLM_E, 0x004 }, { 10, LTLM_A, 5 }, { 1, LTLM_E, 0x005 }, { 1, LTLM_E, 0x006 }, { 1, LTLM_E, 0x007 }, { 1, LTLM_E, 0x008 },
+		{ 10, LTLM_A, 5 }, { 1, LTLM_E, 0x009 }, { 1, LTLM_E, 0x010 }, { 1, LTLM_E, 0x011 }, { 1, LTLM_E, 0x012 }, { 10, LTLM_A, 5 }, { 1, LTLM_E, 0x013 }, { 1, LTLM_E, 0x014 }, { 1, LTLM_E, 0x015 }, { 1, LTLM_E, 0x016 },
+		{ 10, LTLM_A, 5 }, { 1, LTLM_E, 0x017 }, { 1, LTLM_E, 0x018 }, { 1, LTLM_E, 0x019 }, { 1, LTLM_E, 0x020 }, { 10, LTLM_A, 5 }, { 1, LTLM_E, 0x021 }, { 1, LTLM_E, 0x022 }, { 1, LTLM_E, 0x023 }, { 1, LTLM_E, 0x025 },
+		{ 10, LTLM_A, 5 }, { 1, LTLM_E, 0x026 }, { 1, LTLM_E, 0x027 }, { 1, LTLM_E, 0x028 }, { 1, LTLM_E, 0x030 }, { 10, LTLM_A, 5 }, { 1, LTLM_E, 0x031 }, { 1, LTLM_E, 0x032 }, { 1, LTLM_E, 0x033 }, { 1, LTLM_E, 0x035 },
+		{ 10, LTLM_A, 5 }, { 1, LTLM_E, 0x036 }, { 1, LTLM_E, 0x037 }, { 1, LTLM_E, 0x038 }, { 1, LTLM_E, 0x040 }, { 10, LTLM_A, 5 }, { 1, LTLM_E, 0x041 }, { 1, LTLM_E, 0x042 }, { 1, LTLM_E, 0x043 }, { 1, LTLM_E, 0x045 },
+	},
+	{	// 99: MAGIC WORD 4
+		{ 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_D, 0x002 }, { 10, LTLM_E, 0x001 }, { 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_D, 0x004 }, { 10, LTLM_E, 0x001 },
+		{ 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_D, 0x006 }, { 10, LTLM_E, 0x001 }, { 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_D, 0x008 }, { 10, LTLM_E, 0x001 },
+		{ 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_D, 0x010 }, { 10, LTLM_E, 0x001 }, { 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_E, 0x024 }, { 10, LTLM_E, 0x001 },
+		{ 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_E, 0x029 }, { 10, LTLM_E, 0x001 }, { 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_E, 0x034 }, { 10, LTLM_E, 0x001 },
+		{ 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_E, 0x039 }, { 10, LTLM_E, 0x001 }, { 10, LTLM_A, 7 }, { 10, LTLM_A, 17 }, { 10, LTLM_A, 27 }, { 1, LTLM_E, 0x044 }, { 10, LTLM_E, 0x001 },
+	},
+	{	// 100: MAGIC WORD 5
+		{ 1, LTLM_A, 3 }, { 1, LTLM_A, 7 }, { 1, LTLM_A, 11 }, { 1, LTLM_A, 15 }, { 1, LTLM_A, 19 }, { 1, LTLM_A, 22 }, { 1, LTLM_A, 26 }, { 1, LTLM_A, 30 }, { 1, LTLM_A, 34 }, { 1, LTLM_A, 38 },
+		{ 1, LTLM_A, 41 }, { 1, LTLM_A, 45 }, { 1, LTLM_A, 49 }, { 1, LTLM_A, 53 }, { 1, LTLM_A, 57 }, { 1, LTLM_A, 60 }, { 1, LTLM_A, 64 }, { 1, LTLM_A, 68 }, { 1, LTLM_A, 72 }, { 1, LTLM_A, 76 },
+		{ 1, LTLM_A, 79 }, { 1, LTLM_A, 83 }, { 1, LTLM_A, 87 }, { 1, LTLM_A, 91 }, { 1, LTLM_A, 95 }, { 1, LTLM_A, 99 }, { 1, LTLM_A, 103 }, { 1, LTLM_A, 107 }, { 1, LTLM_A, 111 }, { 1, LTLM_A, 115 },
+		{ 1, LTLM_A, 119 }, { 1, LTLM_A, 123 }, { 1, LTLM_A, 127 }, { 1, LTLM_A, 131 }, { 1, LTLM_A, 135 }, { 1, LTLM_A, 139 }, { 1, LTLM_A, 143 }, { 1, LTLM_A, 147 }, { 1, LTLM_A, 151 }, { 1, LTLM_A, 155 },
+		{ 1, LTLM_A, 159 }, { 1, LTLM_A, 163 }, { 1, LTLM_A, 167 }, { 1, LTLM_A, 171 }, { 1, LTLM_A, 175 }, { 1, LTLM_A, 179 }, { 1, LTLM_A, 183 }, { 1, LTLM_A, 187 }, { 1, LTLM_A, 191 }, { 1, LTLM_A, 195 },
+	},
+};
+
+// LBR: 200 words per frame
+const PCMWordDef LMLBRFormat::Map[LMLBRFormat::Words][LMLBRFormat::Subframes] = {
+	{ { 0, PCM_WORD_CONST, 0375 } },	// 0: SYNC 1
+	{ { 0, PCM_WORD_CONST, 0312 } },	// 1: SYNC 2
+	{ { 0, PCM_WORD_CONST, 0150 } },	// 2: SYNC 3
+	{ { 0, PCM_WORD_CONST, 01 } },	// 3: SYNC 4 & "FRAME COUNT"
+	{ { 1, LTLM_D, 0x001 } },	// 4
+	{ { 1, LTLM_A, 5 } },	// 5
+	{ { 1, LTLM_A, 6 } },	// 6
+	{ { 1, LTLM_A, 7 } },	// 7
+	{ { 1, LTLM_A, 8 } },	// 8
+	{ { 1, LTLM_A, 9 } },	// 9
+	{ { 1, LTLM_A, 10 } },	// 10
+	{ { 1, LTLM_A, 11 } },	// 11
+	{ { 1, LTLM_A, 12 } },	// 12
+	{ { 1, LTLM_A, 13 } },	// 13
+	{ { 1, LTLM_A, 14 } },	// 14
+	{ { 1, LTLM_A, 15 } },	// 15
+	{ { 1, LTLM_A, 16 } },	// 16
+	{ { 1, LTLM_A, 17 } },	// 17
+	{ { 1, LTLM_A, 18 } },	// 18
+	{ { 1, LTLM_A, 19 } },	// 19
+	{ { 1, LTLM_D, 0x002 } },	// 20
+	{ { 1, LTLM_A, 20 } },	// 21
+	{ { 1, LTLM_A, 21 } },	// 22
+	{ { 1, LTLM_A, 22 } },	// 23
+	{ { 1, LTLM_A, 23 } },	// 24
+	{ { 1, LTLM_A, 24 } },	// 25
+	{ { 1, LTLM_A, 25 } },	// 26
+	{ { 1, LTLM_A, 26 } },	// 27
+	{ { 1, LTLM_A, 27 } },	// 28
+	{ { 1, LTLM_A, 28 } },	// 29
+	{ { 1, LTLM_A, 29 } },	// 30
+	{ { 1, LTLM_A, 30 } },	// 31
+	{ { 1, LTLM_D, 0x01A } },	// 32
+	{ { 1, LTLM_D, 0x01B } },	// 33
+	{ { 1, LTLM_D, 0x01C } },	// 34
+	{ { 1, LTLM_D, 0x01D } },	// 35
+	{ { 1, LTLM_A, 35 } },	// 36
+	{ { 1, LTLM_A, 36 } },	// 37
+	{ { 1, LTLM_A, 37 } },	// 38
+	{ { 1, LTLM_A, 38 } },	// 39
+	{ { 1, LTLM_D, 0x003 } },	// 40
+	{ { 1, LTLM_D, 0x004 } },	// 41
+	{ { 50, LTLM_E, 0x001 } },	// 42
+	{ { 50, LTLM_E, 0x002 } },	// 43
+	{ { 1, LTLM_A, 42 } },	// 44
+	{ { 10, LTLM_A, 9 } },	// 45
+	{ { 10, LTLM_A, 14 } },	// 46
+	{ { 10, LTLM_A, 16 } },	// 47
+	{ { 1, LTLM_A, 46 } },	// 48
+	{ { 10, LTLM_A, 19 } },	// 49
+	{ { 10, LTLM_A, 24 } },	// 50
+	{ { 10, LTLM_A, 26 } },	// 51
+	{ { 1, LTLM_A, 50 } },	// 52
+	{ { 10, LTLM_A, 29 } },	// 53
+	{ { 10, LTLM_A, 34 } },	// 54
+	{ { 10, LTLM_A, 36 } },	// 55
+	{ { 1, LTLM_A, 54 } },	// 56
+	{ { 10, LTLM_A, 38 } },	// 57
+	{ { 10, LTLM_A, 43 } },	// 58
+	{ { 10, LTLM_A, 45 } },	// 59
+	{ { 1, LTLM_D, 0x005 } },	// 60
+	{ { 1, LTLM_A, 58 } },	// 61
+	{ { 1, LTLM_A, 59 } },	// 62
+	{ { 1, LTLM_A, 60 } },	// 63
+	{ { 1, LTLM_A, 61 } },	// 64
+	{ { 1, LTLM_A, 62 } },	// 65
+	{ { 1, LTLM_A, 63 } },	// 66
+	{ { 1, LTLM_A, 64 } },	// 67
+	{ { 1, LTLM_A, 65 } },	// 68
+	{ { 1, LTLM_A, 66 } },	// 69
+	{ { 1, LTLM_A, 67 } },	// 70
+	{ { 1, LTLM_A, 68 } },	// 71
+	{ { 1, LTLM_D, 0x006 } },	// 72
+	{ { 1, LTLM_D, 0x007 } },	// 73
+	{ { 1, LTLM_D, 0x008 } },	// 74
+	{ { 1, LTLM_D, 0x009 } },	// 75
+	{ { 1, LTLM_A, 73 } },	// 76
+	{ { 1, LTLM_A, 74 } },	// 77
+	{ { 1, LTLM_A, 75 } },	// 78
+	{ { 1, LTLM_A, 76 } },	// 79
+	{ { 1, LTLM_D, 0x010 } },	// 80
+	{ { 1, LTLM_E, 0x001 } },	// 81
+	{ { 1, LTLM_E, 0x002 } },	// 82
+	{ { 1, LTLM_E, 0x003 } },	// 83
+	{ { 1, LTLM_A, 80 } },	// 84
+	{ { 1, LTLM_A, 81 } },	// 85
+	{ { 1, LTLM_A, 82 } },	// 86
+	{ { 1, LTLM_A, 83 } },	// 87
+	{ { 1, LTLM_A, 84 } },	// 88
+	{ { 1, LTLM_A, 85 } },	// 89
+	{ { 1, LTLM_A, 86 } },	// 90
+	{ { 1, LTLM_A, 87 } },	// 91
+	{ { 1, LTLM_A, 88 } },	// 92
+	{ { 1, LTLM_A, 89 } },	// 93
+	{ { 1, LTLM_A, 90 } },	// 94
+	{ { 1, LTLM_A, 91 } },	// 95
+	{ { 1, LTLM_A, 92 } },	// 96
+	{ { 1, LTLM_A, 93 } },	// 97
+	{ { 1, LTLM_A, 94 } },	// 98
+	{ { 1, LTLM_A, 95 } },	// 99
+	{ { 1, LTLM_E, 0x004 } },	// 100
+	{ { 1, LTLM_A, 97 } },	// 101
+	{ { 1, LTLM_A, 98 } },	// 102
+	{ { 1, LTLM_A, 99 } },	// 103
+	{ { 1, LTLM_A, 100 } },	// 104
+	{ { 1, LTLM_A, 101 } },	// 105
+	{ { 1, LTLM_A, 102 } },	// 106
+	{ { 1, LTLM_A, 103 } },	// 107
+	{ { 1, LTLM_A, 104 } },	// 108
+	{ { 1, LTLM_A, 105 } },	// 109
+	{ { 1, LTLM_A, 106 } },	// 110
+	{ { 1, LTLM_A, 107 } },	// 111
+	{ { 1, LTLM_E, 0x005 } },	// 112
+	{ { 1, LTLM_E, 0x006 } },	// 113
+	{ { 1, LTLM_E, 0x007 } },	// 114
+	{ { 1, LTLM_E, 0x008 } },	// 115
+	{ { 1, LTLM_A, 112 } },	// 116
+	{ { 1, LTLM_A, 113 } },	// 117
+	{ { 1, LTLM_A, 114 } },	// 118
+	{ { 1, LTLM_A, 115 } },	// 119
+	{ { 1, LTLM_E, 0x009 } },	// 120
+	{ { 1, LTLM_E, 0x010 } },	// 121
+	{ { 1, LTLM_E, 0x011 } },	// 122
+	{ { 1, LTLM_E, 0x012 } },	// 123
+	{ { 1, LTLM_A, 120 } },	// 124
+	{ { 1, LTLM_A, 121 } },	// 125
+	{ { 1, LTLM_A, 122 } },	// 126
+	{ { 1, LTLM_A, 123 } },	// 127
+	{ { 1, LTLM_A, 124 } },	// 128
+	{ { 1, LTLM_A, 125 } },	// 129
+	{ { 1, LTLM_A, 126 } },	// 130
+	{ { 1, LTLM_A, 127 } },	// 131
+	{ { 1, LTLM_A, 128 } },	// 132
+	{ { 1, LTLM_A, 129 } },	// 133
+	{ { 1, LTLM_A, 130 } },	// 134
+	{ { 1, LTLM_A, 131 } },	// 135
+	{ { 1, LTLM_A, 132 } },	// 136
+	{ { 1, LTLM_A, 133 } },	// 137
+	{ { 1, LTLM_A, 134 } },	// 138
+	{ { 1, LTLM_A, 135 } },	// 139
+	{ { 1, LTLM_E, 0x013 } },	// 140
+	{ { 1, LTLM_A, 137 } },	// 141
+	{ { 1, LTLM_A, 138 } },	// 142
+	{ { 1, LTLM_A, 139 } },	// 143
+	{ { 1, LTLM_A, 140 } },	// 144
+	{ { 1, LTLM_A, 141 } },	// 145
+	{ { 1, LTLM_A, 142 } },	// 146
+	{ { 1, LTLM_A, 143 } },	// 147
+	{ { 1, LTLM_A, 144 } },	// 148
+	{ { 1, LTLM_A, 145 } },	// 149
+	{ { 1, LTLM_A, 146 } },	// 150
+	{ { 1, LTLM_A, 147 } },	// 151
+	{ { 1, LTLM_E, 0x014 } },	// 152
+	{ { 1, LTLM_E, 0x015 } },	// 153
+	{ { 1, LTLM_E, 0x016 } },	// 154
+	{ { 1, LTLM_E, 0x017 } },	// 155
+	{ { 1, LTLM_A, 152 } },	// 156
+	{ { 1, LTLM_A, 153 } },	// 157
+	{ { 1, LTLM_A, 154 } },	// 158
+	{ { 1, LTLM_A, 155 } },	// 159
+	{ { 1, LTLM_E, 0x018 } },	// 160
+	{ { 1, LTLM_E, 0x019 } },	// 161
+	{ { 1, LTLM_E, 0x020 } },	// 162
+	{ { 1, LTLM_E, 0x021 } },	// 163
+	{ { 1, LTLM_A, 160 } },	// 164
+	{ { 1, LTLM_A, 161 } },	// 165
+	{ { 1, LTLM_A, 162 } },	// 166
+	{ { 1, LTLM_A, 163 } },	// 167
+	{ { 1, LTLM_A, 164 } },	// 168
+	{ { 1, LTLM_A, 165 } },	// 169
+	{ { 1, LTLM_A, 166 } },	// 170
+	{ { 1, LTLM_A, 167 } },	// 171
+	{ { 1, LTLM_A, 168 } },	// 172
+	{ { 1, LTLM_A, 169 } },	// 173
+	{ { 1, LTLM_A, 170 } },	// 174
+	{ { 1, LTLM_A, 171 } },	// 175
+	{ { 1, LTLM_A, 172 } },	// 176
+	{ { 1, LTLM_A, 173 } },	// 177
+	{ { 1, LTLM_A, 174 } },	// 178
+	{ { 1, LTLM_A, 175 } },	// 179
+	{ { 1, LTLM_E, 0x022 } },	// 180
+	{ { 1, LTLM_A, 177 } },	// 181
+	{ { 1, LTLM_A, 178 } },	// 182
+	{ { 1, LTLM_A, 179 } },	// 183
+	{ { 1, LTLM_A, 180 } },	// 184
+	{ { 1, LTLM_A, 181 } },	// 185
+	{ { 1, LTLM_A, 182 } },	// 186
+	{ { 1, LTLM_A, 183 } },	// 187
+	{ { 1, LTLM_A, 184 } },	// 188
+	{ { 1, LTLM_A, 185 } },	// 189
+	{ { 1, LTLM_A, 186 } },	// 190
+	{ { 1, LTLM_A, 187 } },	// 191
+	{ { 1, LTLM_E, 0x023 } },	// 192
+	{ { 1, LTLM_E, 0x024 } },	// 193
+	{ { 1, LTLM_E, 0x025 } },	// 194
+	{ { 1, LTLM_E, 0x026 } },	// 195
+	{ { 1, LTLM_A, 192 } },	// 196
+	{ { 1, LTLM_A, 193 } },	// 197
+	{ { 1, LTLM_A, 194 } },	// 198
+	{ { 1, LTLM_A, 195 } },	// 199
+};
+
+const PCMWordDef *const LMHBRFormat::Commutated = &HBRCommutated[0][0];
+const PCMWordDef *const LMLBRFormat::Commutated = NULL;
+
+// 50DS1A-E LGC DIGITAL DATA (40 BITS)
+
+unsigned char LM_PCM::agc_word(int ccode)
+{
+	unsigned char data;
+
+	switch (ccode) {
+	case 0:
+	{
+		// DOWNRUPT needs time to get data on the bus, so it has to have happened BEFORE we get here!
+		ChannelValue ch13;
+		ch13 = lem->agc.GetOutputChannel(013);
+		data = (lem->agc.GetOutputChannel(034) & 077400) >> 8;
+		if (ch13[DownlinkWordOrderCodeBit]) { data |= 0200; } // WORD ORDER BIT
+		return data;
+	}
+	case 1:
+		return (lem->agc.GetOutputChannel(034) & 0377);
+	case 2:
+		// PARITY OF CH 34 GOES IN TOP BIT HERE!
+		return (lem->agc.GetOutputChannel(035) & 077400) >> 8;
+	case 3:
+		return (lem->agc.GetOutputChannel(035) & 0377);
+	case 4:
+		// PARITY OF CH 35 GOES IN TOP BIT HERE!
+		return (lem->agc.GetOutputChannel(034) & 077400) >> 8;
+	}
+	return 0;
 }
 
-void LM_PCM::generate_stream_lbr(){
-	unsigned char data=0;
-	// 200 words per frame, 1 frame per second
-	switch(word_addr){
-		case 0: tx_data[tx_offset] = 0375; break; // SYNC 1
-		case 1: tx_data[tx_offset] = 0312; break; // SYNC 2
-		case 2: tx_data[tx_offset] = 0150; break; // SYNC 3
-		case 3: tx_data[tx_offset] = 0001; break; // SYNC 4 & "FRAME COUNT"
-		case 4: tx_data[tx_offset] = measure(01,LTLM_D,0x001); break;
-		case 5: tx_data[tx_offset] = measure(01,LTLM_A,5); break;
-		case 6: tx_data[tx_offset] = measure(01,LTLM_A,6); break;
-		case 7: tx_data[tx_offset] = measure(01,LTLM_A,7); break;
-		case 8: tx_data[tx_offset] = measure(01,LTLM_A,8); break;
-		case 9: tx_data[tx_offset] = measure(01,LTLM_A,9); break;
-		case 10: tx_data[tx_offset] = measure(01,LTLM_A,10); break;
-		case 11: tx_data[tx_offset] = measure(01,LTLM_A,11); break;
-		case 12: tx_data[tx_offset] = measure(01,LTLM_A,12); break;
-		case 13: tx_data[tx_offset] = measure(01,LTLM_A,13); break;
-		case 14: tx_data[tx_offset] = measure(01,LTLM_A,14); break;
-		case 15: tx_data[tx_offset] = measure(01,LTLM_A,15); break;
-		case 16: tx_data[tx_offset] = measure(01,LTLM_A,16); break;
-		case 17: tx_data[tx_offset] = measure(01,LTLM_A,17); break;
-		case 18: tx_data[tx_offset] = measure(01,LTLM_A,18); break;
-		case 19: tx_data[tx_offset] = measure(01,LTLM_A,19); break;
-        case 20: tx_data[tx_offset] = measure(01,LTLM_D,0x002); break;
-        case 21: tx_data[tx_offset] = measure(01,LTLM_A,20); break;
-        case 22: tx_data[tx_offset] = measure(01,LTLM_A,21); break;
-        case 23: tx_data[tx_offset] = measure(01,LTLM_A,22); break;
-        case 24: tx_data[tx_offset] = measure(01,LTLM_A,23); break;
-        case 25: tx_data[tx_offset] = measure(01,LTLM_A,24); break;
-        case 26: tx_data[tx_offset] = measure(01,LTLM_A,25); break;
-        case 27: tx_data[tx_offset] = measure(01,LTLM_A,26); break;
-        case 28: tx_data[tx_offset] = measure(01,LTLM_A,27); break;
-        case 29: tx_data[tx_offset] = measure(01,LTLM_A,28); break;
-        case 30: tx_data[tx_offset] = measure(01,LTLM_A,29); break;
-        case 31: tx_data[tx_offset] = measure(01,LTLM_A,30); break;
-        case 32: tx_data[tx_offset] = measure(01,LTLM_D,0x01A); break;
-        case 33: tx_data[tx_offset] = measure(01,LTLM_D,0x01B); break;
-        case 34: tx_data[tx_offset] = measure(01,LTLM_D,0x01C); break;
-        case 35: tx_data[tx_offset] = measure(01,LTLM_D,0x01D); break;
-        case 36: tx_data[tx_offset] = measure(01,LTLM_A,35); break;
-        case 37: tx_data[tx_offset] = measure(01,LTLM_A,36); break;
-        case 38: tx_data[tx_offset] = measure(01,LTLM_A,37); break;
-        case 39: tx_data[tx_offset] = measure(01,LTLM_A,38); break;
-        case 40: tx_data[tx_offset] = measure(01,LTLM_D,0x003); break;
-        case 41: tx_data[tx_offset] = measure(01,LTLM_D,0x004); break;
-        case 42: tx_data[tx_offset] = measure(50,LTLM_E,0x001); break;
-        case 43: tx_data[tx_offset] = measure(50,LTLM_E,0x002); break;
-        case 44: tx_data[tx_offset] = measure(01,LTLM_A,42); break;
-        case 45: tx_data[tx_offset] = measure(10,LTLM_A,9); break;
-        case 46: tx_data[tx_offset] = measure(10,LTLM_A,14); break;
-        case 47: tx_data[tx_offset] = measure(10,LTLM_A,16); break;
-        case 48: tx_data[tx_offset] = measure(1,LTLM_A,46); break;
-        case 49: tx_data[tx_offset] = measure(10,LTLM_A,19); break;
-        case 50: tx_data[tx_offset] = measure(10,LTLM_A,24); break;
-        case 51: tx_data[tx_offset] = measure(10,LTLM_A,26); break;
-        case 52: tx_data[tx_offset] = measure(1,LTLM_A,50); break;
-        case 53: tx_data[tx_offset] = measure(10,LTLM_A,29); break;
-        case 54: tx_data[tx_offset] = measure(10,LTLM_A,34); break;
-        case 55: tx_data[tx_offset] = measure(10,LTLM_A,36); break;
-        case 56: tx_data[tx_offset] = measure(1,LTLM_A,54); break;
-        case 57: tx_data[tx_offset] = measure(10,LTLM_A,38); break;
-        case 58: tx_data[tx_offset] = measure(10,LTLM_A,43); break;
-        case 59: tx_data[tx_offset] = measure(10,LTLM_A,45); break;
-        case 60: tx_data[tx_offset] = measure(1,LTLM_D,0x005); break;
-        case 61: tx_data[tx_offset] = measure(1,LTLM_A,58); break;
-        case 62: tx_data[tx_offset] = measure(1,LTLM_A,59); break;
-        case 63: tx_data[tx_offset] = measure(1,LTLM_A,60); break;
-        case 64: tx_data[tx_offset] = measure(1,LTLM_A,61); break;
-        case 65: tx_data[tx_offset] = measure(1,LTLM_A,62); break;
-        case 66: tx_data[tx_offset] = measure(1,LTLM_A,63); break;
-        case 67: tx_data[tx_offset] = measure(1,LTLM_A,64); break;
-        case 68: tx_data[tx_offset] = measure(1,LTLM_A,65); break;
-        case 69: tx_data[tx_offset] = measure(1,LTLM_A,66); break;
-        case 70: tx_data[tx_offset] = measure(1,LTLM_A,67); break;
-        case 71: tx_data[tx_offset] = measure(1,LTLM_A,68); break;
-        case 72: tx_data[tx_offset] = measure(1,LTLM_D,0x006); break;
-        case 73: tx_data[tx_offset] = measure(1,LTLM_D,0x007); break;
-        case 74: tx_data[tx_offset] = measure(1,LTLM_D,0x008); break;
-        case 75: tx_data[tx_offset] = measure(1,LTLM_D,0x009); break;
-        case 76: tx_data[tx_offset] = measure(1,LTLM_A,73); break;
-        case 77: tx_data[tx_offset] = measure(1,LTLM_A,74); break;
-        case 78: tx_data[tx_offset] = measure(1,LTLM_A,75); break;
-        case 79: tx_data[tx_offset] = measure(1,LTLM_A,76); break;
-        case 80: tx_data[tx_offset] = measure(1,LTLM_D,0x010); break;
-        case 81: tx_data[tx_offset] = measure(1,LTLM_E,0x001); break;
-        case 82: tx_data[tx_offset] = measure(1,LTLM_E,0x002); break;
-        case 83: tx_data[tx_offset] = measure(1,LTLM_E,0x003); break;
-        case 84: tx_data[tx_offset] = measure(1,LTLM_A,80); break;
-        case 85: tx_data[tx_offset] = measure(1,LTLM_A,81); break;
-        case 86: tx_data[tx_offset] = measure(1,LTLM_A,82); break;
-        case 87: tx_data[tx_offset] = measure(1,LTLM_A,83); break;
-        case 88: tx_data[tx_offset] = measure(1,LTLM_A,84); break;
-        case 89: tx_data[tx_offset] = measure(1,LTLM_A,85); break;
-        case 90: tx_data[tx_offset] = measure(1,LTLM_A,86); break;
-        case 91: tx_data[tx_offset] = measure(1,LTLM_A,87); break;
-        case 92: tx_data[tx_offset] = measure(1,LTLM_A,88); break;
-        case 93: tx_data[tx_offset] = measure(1,LTLM_A,89); break;
-        case 94: tx_data[tx_offset] = measure(1,LTLM_A,90); break;
-        case 95: tx_data[tx_offset] = measure(1,LTLM_A,91); break;
-        case 96: tx_data[tx_offset] = measure(1,LTLM_A,92); break;
-        case 97: tx_data[tx_offset] = measure(1,LTLM_A,93); break;
-        case 98: tx_data[tx_offset] = measure(1,LTLM_A,94); break;
-        case 99: tx_data[tx_offset] = measure(1,LTLM_A,95); break;
-        case 100: tx_data[tx_offset] = measure(1,LTLM_E,0x004); break;
-        case 101: tx_data[tx_offset] = measure(1,LTLM_A,97); break;
-        case 102: tx_data[tx_offset] = measure(1,LTLM_A,98); break;
-        case 103: tx_data[tx_offset] = measure(1,LTLM_A,99); break;
-        case 104: tx_data[tx_offset] = measure(1,LTLM_A,100); break;
-        case 105: tx_data[tx_offset] = measure(1,LTLM_A,101); break;
-        case 106: tx_data[tx_offset] = measure(1,LTLM_A,102); break;
-        case 107: tx_data[tx_offset] = measure(1,LTLM_A,103); break;
-        case 108: tx_data[tx_offset] = measure(1,LTLM_A,104); break;
-        case 109: tx_data[tx_offset] = measure(1,LTLM_A,105); break;
-        case 110: tx_data[tx_offset] = measure(1,LTLM_A,106); break;
-        case 111: tx_data[tx_offset] = measure(1,LTLM_A,107); break;
-        case 112: tx_data[tx_offset] = measure(1,LTLM_E,0x005); break;
-        case 113: tx_data[tx_offset] = measure(1,LTLM_E,0x006); break;
-        case 114: tx_data[tx_offset] = measure(1,LTLM_E,0x007); break;
-        case 115: tx_data[tx_offset] = measure(1,LTLM_E,0x008); break;
-        case 116: tx_data[tx_offset] = measure(1,LTLM_A,112); break;
-        case 117: tx_data[tx_offset] = measure(1,LTLM_A,113); break;
-        case 118: tx_data[tx_offset] = measure(1,LTLM_A,114); break;
-        case 119: tx_data[tx_offset] = measure(1,LTLM_A,115); break;
-        case 120: tx_data[tx_offset] = measure(1,LTLM_E,0x009); break;
-        case 121: tx_data[tx_offset] = measure(1,LTLM_E,0x010); break;
-        case 122: tx_data[tx_offset] = measure(1,LTLM_E,0x011); break;
-        case 123: tx_data[tx_offset] = measure(1,LTLM_E,0x012); break;
-        case 124: tx_data[tx_offset] = measure(1,LTLM_A,120); break;
-        case 125: tx_data[tx_offset] = measure(1,LTLM_A,121); break;
-        case 126: tx_data[tx_offset] = measure(1,LTLM_A,122); break;
-        case 127: tx_data[tx_offset] = measure(1,LTLM_A,123); break;
-        case 128: tx_data[tx_offset] = measure(1,LTLM_A,124); break;
-        case 129: tx_data[tx_offset] = measure(1,LTLM_A,125); break;
-        case 130: tx_data[tx_offset] = measure(1,LTLM_A,126); break;
-        case 131: tx_data[tx_offset] = measure(1,LTLM_A,127); break;
-        case 132: tx_data[tx_offset] = measure(1,LTLM_A,128); break;
-        case 133: tx_data[tx_offset] = measure(1,LTLM_A,129); break;
-        case 134: tx_data[tx_offset] = measure(1,LTLM_A,130); break;
-        case 135: tx_data[tx_offset] = measure(1,LTLM_A,131); break;
-        case 136: tx_data[tx_offset] = measure(1,LTLM_A,132); break;
-        case 137: tx_data[tx_offset] = measure(1,LTLM_A,133); break;
-        case 138: tx_data[tx_offset] = measure(1,LTLM_A,134); break;
-        case 139: tx_data[tx_offset] = measure(1,LTLM_A,135); break;
-        case 140: tx_data[tx_offset] = measure(1,LTLM_E,0x013); break;
-        case 141: tx_data[tx_offset] = measure(1,LTLM_A,137); break;
-        case 142: tx_data[tx_offset] = measure(1,LTLM_A,138); break;
-        case 143: tx_data[tx_offset] = measure(1,LTLM_A,139); break;
-        case 144: tx_data[tx_offset] = measure(1,LTLM_A,140); break;
-        case 145: tx_data[tx_offset] = measure(1,LTLM_A,141); break;
-        case 146: tx_data[tx_offset] = measure(1,LTLM_A,142); break;
-        case 147: tx_data[tx_offset] = measure(1,LTLM_A,143); break;
-        case 148: tx_data[tx_offset] = measure(1,LTLM_A,144); break;
-        case 149: tx_data[tx_offset] = measure(1,LTLM_A,145); break;
-        case 150: tx_data[tx_offset] = measure(1,LTLM_A,146); break;
-        case 151: tx_data[tx_offset] = measure(1,LTLM_A,147); break;
-        case 152: tx_data[tx_offset] = measure(1,LTLM_E,0x014); break;
-        case 153: tx_data[tx_offset] = measure(1,LTLM_E,0x015); break;
-        case 154: tx_data[tx_offset] = measure(1,LTLM_E,0x016); break;
-        case 155: tx_data[tx_offset] = measure(1,LTLM_E,0x017); break;
-        case 156: tx_data[tx_offset] = measure(1,LTLM_A,152); break;
-        case 157: tx_data[tx_offset] = measure(1,LTLM_A,153); break;
-        case 158: tx_data[tx_offset] = measure(1,LTLM_A,154); break;
-        case 159: tx_data[tx_offset] = measure(1,LTLM_A,155); break;
-        case 160: tx_data[tx_offset] = measure(1,LTLM_E,0x018); break;
-        case 161: tx_data[tx_offset] = measure(1,LTLM_E,0x019); break;
-        case 162: tx_data[tx_offset] = measure(1,LTLM_E,0x020); break;
-        case 163: tx_data[tx_offset] = measure(1,LTLM_E,0x021); break;
-        case 164: tx_data[tx_offset] = measure(1,LTLM_A,160); break;
-        case 165: tx_data[tx_offset] = measure(1,LTLM_A,161); break;
-        case 166: tx_data[tx_offset] = measure(1,LTLM_A,162); break;
-        case 167: tx_data[tx_offset] = measure(1,LTLM_A,163); break;
-        case 168: tx_data[tx_offset] = measure(1,LTLM_A,164); break;
-        case 169: tx_data[tx_offset] = measure(1,LTLM_A,165); break;
-        case 170: tx_data[tx_offset] = measure(1,LTLM_A,166); break;
-        case 171: tx_data[tx_offset] = measure(1,LTLM_A,167); break;
-        case 172: tx_data[tx_offset] = measure(1,LTLM_A,168); break;
-        case 173: tx_data[tx_offset] = measure(1,LTLM_A,169); break;
-        case 174: tx_data[tx_offset] = measure(1,LTLM_A,170); break;
-        case 175: tx_data[tx_offset] = measure(1,LTLM_A,171); break;
-        case 176: tx_data[tx_offset] = measure(1,LTLM_A,172); break;
-        case 177: tx_data[tx_offset] = measure(1,LTLM_A,173); break;
-        case 178: tx_data[tx_offset] = measure(1,LTLM_A,174); break;
-        case 179: tx_data[tx_offset] = measure(1,LTLM_A,175); break;
-        case 180: tx_data[tx_offset] = measure(1,LTLM_E,0x022); break;
-        case 181: tx_data[tx_offset] = measure(1,LTLM_A,177); break;
-        case 182: tx_data[tx_offset] = measure(1,LTLM_A,178); break;
-        case 183: tx_data[tx_offset] = measure(1,LTLM_A,179); break;
-        case 184: tx_data[tx_offset] = measure(1,LTLM_A,180); break;
-        case 185: tx_data[tx_offset] = measure(1,LTLM_A,181); break;
-        case 186: tx_data[tx_offset] = measure(1,LTLM_A,182); break;
-        case 187: tx_data[tx_offset] = measure(1,LTLM_A,183); break;
-        case 188: tx_data[tx_offset] = measure(1,LTLM_A,184); break;
-        case 189: tx_data[tx_offset] = measure(1,LTLM_A,185); break;
-        case 190: tx_data[tx_offset] = measure(1,LTLM_A,186); break;
-        case 191: tx_data[tx_offset] = measure(1,LTLM_A,187); break;
-        case 192: tx_data[tx_offset] = measure(1,LTLM_E,0x023); break;
-        case 193: tx_data[tx_offset] = measure(1,LTLM_E,0x024); break;
-        case 194: tx_data[tx_offset] = measure(1,LTLM_E,0x025); break;
-        case 195: tx_data[tx_offset] = measure(1,LTLM_E,0x026); break;
-        case 196: tx_data[tx_offset] = measure(1,LTLM_A,192); break;
-        case 197: tx_data[tx_offset] = measure(1,LTLM_A,193); break;
-        case 198: tx_data[tx_offset] = measure(1,LTLM_A,194); break;
-        case 199: tx_data[tx_offset] = measure(1,LTLM_A,195); break;
-
-		// JUST IN CASE
-		default:
-			tx_data[tx_offset] = 0;
-			break;
-	}
-	word_addr++;
-	if(word_addr > 199){
-		word_addr = 0;
-		frame_addr = 0;
-		frame_count = 1;
-	}
+void LM_PCM::downrupt()
+{
+	lem->agc.RaiseInterrupt(ApolloGuidance::Interrupt::DOWNRUPT);
 }
 
 // Fetch a telemetry data item from its channel code
@@ -2710,8 +2436,8 @@ void LEM_SteerableAnt::Timestep(double simdt){
 	if (sband_proc[0] < 0) sband_proc[0] += 1.0;
 	sband_proc[1] = -yaw / PI2;
 	if (sband_proc[1] < 0) sband_proc[1] += 1.0;
-	if (sband_proc[0] - sband_proc_last[0] != 0.0) lem->SetAnimation(anim_SBandPitch, sband_proc[0]);
-	if (sband_proc[1] - sband_proc_last[1] != 0.0) lem->SetAnimation(anim_SBandYaw, sband_proc[1]);
+	if (sband_proc[0] - sband_proc_last[0] != 0.0) lem->QueueAnimation(anim_SBandPitch, sband_proc[0]);
+	if (sband_proc[1] - sband_proc_last[1] != 0.0) lem->QueueAnimation(anim_SBandYaw, sband_proc[1]);
 	sband_proc_last[0] = sband_proc[0];
 	sband_proc_last[1] = sband_proc[1];
 
@@ -2951,7 +2677,7 @@ void LEM_SteerableAnt::DefineAnimations(UINT idx) {
 	if (sband_proc[0] < 0) sband_proc[0] += 1.0;
 	sband_proc[1] = -yaw / PI2;
 	if (sband_proc[1] < 0) sband_proc[1] += 1.0;
-	lem->SetAnimation(anim_SBandPitch, sband_proc[0]); lem->SetAnimation(anim_SBandYaw, sband_proc[1]);
+	lem->ApplyAnimation(anim_SBandPitch, sband_proc[0]); lem->ApplyAnimation(anim_SBandYaw, sband_proc[1]);
 }
 
 VECTOR3 LEM_SteerableAnt::pitchYaw2GlobalVector(double pitch, double yaw)
@@ -24,6 +24,10 @@
 
 #include "RF_calc.h"
 #include "paCBGmessageID.h"
+#include "pcmarchive.h"
+#include "pcmframe.h"
+#include "pcmtransport.h"
+#include "pcmuplink.h"
 
 /* PCM DOWN-TELEMETRY
 
@@ -174,6 +178,30 @@
 #define LTLM_DS		3
 #define LTLM_E		4
 
+///
+/// \brief LM high bit rate format: 51.2 kbps, 128 words per frame.
+///
+struct LMHBRFormat {
+	enum { Words = 128, FramesPerSecond = 50, Subframes = 5, FrameAddrCycle = 50, FrameCountCycle = 5, CommutatedWords = 6 };
+
+	static const PCMWordDef Map[Words][Subframes];
+	static const PCMWordDef *const Commutated;
+
+	// SYNC 1 generates DOWNRUPT, the LGC data is read out at word 120
+	static bool Downrupt(int word) { return word == 0; };
+};
+
+///
+/// \brief LM low bit rate format: 1.6 kbps, 200 words per frame, no subcommutation.
+///
+struct LMLBRFormat {
+	enum { Words = 200, FramesPerSecond = 1, Subframes = 1, FrameAddrCycle = 1, FrameCountCycle = 1, CommutatedWords = 0 };
+
+	static const PCMWordDef Map[Words][Subframes];
+	static const PCMWordDef *const Commutated;
+	static bool Downrupt(int word) { return false; };
+};
+
 class Saturn;
 
 class LM_VHFAntenna
@@ -245,8 +273,12 @@ public:
 	void Init(LEM *vessel, h_HeatLoad *pcmh);	       // Initialization
 	void Timestep(double simt);     // TimeStep
 	void SystemTimestep(double simdt);
+	bool OpenArchive(const char *fname);
+	bool OpenDownlinkFile(const char *fname);
+	void SetDecimated(bool d) { decimated = d; };
 
 	double last_update;				// simt of last update
+	PCMUplinkQueue uplink;			// Uplink loads queued in-process by MCC and the MFDs
 protected:
 	LEM *lem;					   // Ship we're installed in
 	h_HeatLoad *PCMHeat;			//PCM Heat Load
@@ -259,12 +291,15 @@ protected:
 	int conn_state;                 // Connection State
 	int uplink_state;               // Uplink State
 	void perform_io(double simt);   // Get data from here to there
+	void close_connection();        // Drop the telemetry client
 	void handle_uplink();			// Handle incoming data
-	void generate_stream_lbr();     // Generate LBR datastream
-	void generate_stream_hbr();     // Same for HBR datastream
+	void generate_words(int count, bool lbr); // Generate words and queue them for downlink
+	void skip_frames(int count, bool lbr); // Advance the frame counters without generating
 	unsigned char scale_data(double data, double low, double high); // Scale data for PCM transmission
 	unsigned char scale_scea(double data); // Scale preconditioned data from the SCEA for PCM transmission
 	unsigned char measure(int channel, int type, int ccode);
+	unsigned char agc_word(int ccode); // 50DS1A-E LGC digital data
+	void downrupt();				// Trigger telemetry END PULSE
 	// Error control
 	int wsk_error;                  // Winsock error
 	char wsk_emsg[256];             // Winsock error message
@@ -273,18 +308,32 @@ protected:
 	int word_addr;                  // Word address of outgoing packet
 	int frame_addr;                 // Frame address
 	int frame_count;				// Frame counter
+	int frame_serial;				// Incremented for every downlink frame
 	int tx_size;                    // Number of words to send
-	int tx_offset;                  // Offset to use
 	int rx_offset;					// RX offset to use
-	int mcc_offset;					// RX offset into MCC data block
-	int mcc_size;					// Size of MCC data block
 	unsigned char tx_data[1024];    // Characters to be transmitted
 	unsigned char rx_data[1024];    // Characters recieved
-	unsigned char mcc_data[2048];	// MCC-provided incoming data
+	double word_length;				// Time of one word at the current bit rate
+	double stream_time;				// simt the next word was due
+
+	// Downlink transport
+	PCMTransport downlink;			// Ring buffer and transport thread
+	PCMSocketSink *socketSink;		// Connected telemetry client
+	PCMFileSink *fileSink;			// Raw downlink file
+	bool decimated;					// Only emit whole frames at a reduced rate under time acceleration
+	unsigned long long frames_skipped; // Frames not generated because of decimation or overload
+
+	// Frame formats
+	PCMFrameEngine<LMLBRFormat, LM_PCM> lbr_engine;
+	PCMFrameEngine<LMHBRFormat, LM_PCM> hbr_engine;
+
+	// Telemetry archive
+	PCMArchiveWriter archive;		// Frames recorded for post-flight analysis
 
 	bool registerSocket(SOCKET sock);
 
 	friend class MCC;				// Allow MCC to write directly to buffer
+	template <class Format, class Source> friend class PCMFrameEngine;
 };
 
 // Generic S-Band Antenna
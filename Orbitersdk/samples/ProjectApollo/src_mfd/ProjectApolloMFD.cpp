@@ -82,6 +82,7 @@ static struct ProjectApolloMFDData {  // global data storage
 	int uplinkSlot;
 	queue<unsigned char> uplinkBuffer;
 	double uplinkBufferSimt;
+	PCMUplinkQueue *uplinkQueue;	// PCM of the target vessel, NULL when uplinking over the socket
 	OBJHANDLE planet;
 	VESSEL *vessel;
 	VESSEL *iuVessel;
@@ -144,6 +145,7 @@ void ProjectApolloMFDopcDLLInit (HINSTANCE hDLL)
 		sprintf(debugWinsock,"DISCONNECTED");
 	}
 	g_Data.uplinkBufferSimt = 0;
+	g_Data.uplinkQueue = NULL;
 	g_Data.V42angles = _V(0, 0, 0);
 	g_Data.killrot = 0;
 	g_Data.iuVessel = NULL;
@@ -348,60 +350,96 @@ void uplink_aeaa_cmd(bool arm, bool set)
 	g_Data.connStatus = 1;
 }
 
+//
+// Uplinks are queued directly into the PCM of the target vessel. Only if we don't have
+// it, connect to its telemetry port like an external client does.
+//
+
+bool StartUplink()
+{
+	g_Data.uplinkQueue = NULL;
+
+	if (g_Data.uplinkLEM > 0) {
+		if (g_Data.gorpVessel) { g_Data.uplinkQueue = g_Data.gorpVessel->GetUplinkQueue(); }
+	}
+	else {
+		if (g_Data.progVessel) { g_Data.uplinkQueue = g_Data.progVessel->GetUplinkQueue(); }
+	}
+
+	if (g_Data.uplinkQueue) {
+		sprintf(debugWinsock, "UPLINK QUEUED");
+		return true;
+	}
+
+	char addr[256];
+	m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (m_socket == INVALID_SOCKET) {
+		sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
+		closesocket(m_socket);
+		return false;
+	}
+	sprintf(addr, "127.0.0.1");
+	clientService.sin_family = AF_INET;
+	clientService.sin_addr.s_addr = inet_addr(addr);
+	if (g_Data.uplinkLEM > 0) { clientService.sin_port = htons(14243); }
+	else { clientService.sin_port = htons(14242); }
+	if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
+		sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
+		closesocket(m_socket);
+		return false;
+	}
+	sprintf(debugWinsock, "CONNECTED");
+	return true;
+}
+
+//
+// Hand the keys collected in the uplink buffer to the PCM as one load. Over the socket
+// they are sent by the timestep instead.
+//
+
+void SendUplink()
+{
+	if (g_Data.uplinkQueue == NULL) {
+		return;
+	}
+
+	std::vector<unsigned char> load;
+	while (!g_Data.uplinkBuffer.empty()) {
+		load.push_back(g_Data.uplinkBuffer.front());
+		g_Data.uplinkBuffer.pop();
+	}
+
+	if (!g_Data.uplinkQueue->Enqueue(load)) {
+		sprintf(debugWinsock, "UPLINK BUFFER FULL");
+		g_Data.uplinkDataReady = 0;
+		g_Data.updateClockReady = 0;
+		g_Data.connStatus = 0;
+		g_Data.uplinkQueue = NULL;
+	}
+}
+
 void UplinkLMRTC(bool arm, bool set)
 {
 	if (g_Data.connStatus == 0) {
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
+		if (!StartUplink()) {
 			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (g_Data.uplinkLEM > 0) { clientService.sin_port = htons(14243); }
-		else { clientService.sin_port = htons(14242); }
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		uplink_aeaa_cmd(arm, set);
 		g_Data.connStatus = 1;
+		SendUplink();
 	}
 }
 
 void UplinkData()
 {
 	if (g_Data.connStatus == 0) {
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
 		char buffer[8];
-		m_socket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );	
-		if ( m_socket == INVALID_SOCKET ) {
-			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock,"ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if(g_Data.uplinkLEM > 0){	clientService.sin_port = htons( 14243 ); }else{ clientService.sin_port = htons( 14242 ); }
-		if (connect( m_socket, (SOCKADDR*) &clientService, sizeof(clientService)) == SOCKET_ERROR) {
+		if (!StartUplink()) {
 			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock,"FAILED TO CONNECT, ERROR %ld",WSAGetLastError());
-			closesocket(m_socket);
 			return;
 		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		send_agc_key('V');
 		send_agc_key('7');
@@ -422,6 +460,7 @@ void UplinkData()
 		send_agc_key('E');
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 	}
 }
 
@@ -429,28 +468,11 @@ void UpdateClock()
 {		
 	if (g_Data.connStatus == 0)
 	{
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
 		char buffer[8];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
+		if (!StartUplink()) {
 			g_Data.updateClockReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (g_Data.uplinkLEM > 0) { clientService.sin_port = htons(14243); }
-		else { clientService.sin_port = htons(14242); }
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			g_Data.updateClockReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		send_agc_key('V');
 		send_agc_key('1');
@@ -474,6 +496,7 @@ void UpdateClock()
 		// Send until queue is empty, then continue 
 		// with V55 clock update
 		g_Data.connStatus = 2;
+		SendUplink();
 	}
 	else if (g_Data.connStatus == 2) {
 		// increment clock
@@ -521,6 +544,7 @@ void UpdateClock()
 		// Send until queue empty, then reset uplinkDataReady to 0
 		// and close the socket
 		g_Data.connStatus = 1;
+		SendUplink();
 	}
 }
 
@@ -530,32 +554,16 @@ void UplinkSunburstSuborbitalAbort()
 
 	if (g_Data.connStatus == 0)
 	{
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
+		if (!StartUplink()) {
 			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (g_Data.uplinkLEM > 0) { clientService.sin_port = htons(14243); }
-		else { clientService.sin_port = htons(14242); }
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 
 		send_agc_key('S');
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 	}
 }
 
@@ -565,38 +573,35 @@ void UplinkSunburstCOI()
 
 	if (g_Data.connStatus == 0)
 	{
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
+		if (!StartUplink()) {
 			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (g_Data.uplinkLEM > 0) { clientService.sin_port = htons(14243); }
-		else { clientService.sin_port = htons(14242); }
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 
 		send_agc_key('T');
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 	}
 }
 
 void ProjectApolloMFDopcTimestep (double simt, double simdt, double mjd)
 {
-	if (g_Data.connStatus > 0 && g_Data.uplinkBuffer.size() > 0) {
+	if (g_Data.uplinkQueue) {
+		// The PCM takes the load at the uplink rate, continue when it's empty
+		if (g_Data.connStatus > 0 && g_Data.uplinkQueue->Empty()) {
+			if (g_Data.connStatus == 1) {
+				sprintf(debugWinsock, "UPLINK COMPLETE");
+				g_Data.uplinkDataReady = 0;
+				g_Data.updateClockReady = 0;
+				g_Data.connStatus = 0;
+				g_Data.uplinkQueue = NULL;
+			} else if (g_Data.connStatus == 2 && g_Data.updateClockReady == 2) {
+				UpdateClock();
+			}
+		}
+	} else if (g_Data.connStatus > 0 && g_Data.uplinkBuffer.size() > 0) {
 		if (simt > g_Data.uplinkBufferSimt + 0.1) {
 			unsigned char data = g_Data.uplinkBuffer.front();
 			send(m_socket, (char *) &data, 1, 0);
@@ -463,6 +463,7 @@ ARCore::ARCore(VESSEL* v, AR_GCore* gcin)
 	g_Data.uplinkBufferSimt = 0;
 	g_Data.connStatus = 0;
 	g_Data.uplinkState = 0;
+	g_Data.uplinkQueue = NULL;
 	if (vesseltype == 1)
 	{
 		LEM *lem = (LEM *)vessel;
@@ -828,6 +829,16 @@ ARCore::~ARCore()
 
 void ARCore::MinorCycle(double SimT, double SimDT, double mjd)
 {
+	if (g_Data.uplinkQueue) {
+		// The PCM takes the load at the uplink rate, we are done when it's empty
+		if (g_Data.connStatus == 1 && g_Data.uplinkQueue->Empty()) {
+			sprintf(debugWinsock, "UPLINK COMPLETE");
+			g_Data.connStatus = 0;
+			g_Data.uplinkQueue = NULL;
+		}
+		return;
+	}
+
 	if (g_Data.connStatus > 0 && g_Data.uplinkBuffer.size() > 0) {
 		if (SimT > g_Data.uplinkBufferSimt + 0.1) {
 			unsigned char data = g_Data.uplinkBuffer.front();
@@ -927,6 +938,11 @@ void ARCore::TLCCCalc()
 	startSubthread(14);
 }
 
+void ARCore::TLCCMultiCalc()
+{
+	startSubthread(56);
+}
+
 void ARCore::PDI_PAD()
 {
 	startSubthread(16);
@@ -2139,37 +2155,88 @@ void ARCore::AP12AbortCoefUplink()
 	UplinkData(false); // Go for uplink
 }
 
+//
+// Uplinks to the computer of our own vessel are queued directly into its PCM. Otherwise
+// connect to the telemetry port of the target vessel like an external client does.
+//
+
+bool ARCore::StartUplink(bool isCSM)
+{
+	g_Data.uplinkQueue = NULL;
+
+	if (vesseltype == 0 && isCSM)
+	{
+		g_Data.uplinkQueue = ((Saturn *)vessel)->GetUplinkQueue();
+	}
+	else if (vesseltype == 1 && !isCSM)
+	{
+		g_Data.uplinkQueue = ((LEM *)vessel)->GetUplinkQueue();
+	}
+
+	if (g_Data.uplinkQueue)
+	{
+		sprintf(debugWinsock, "UPLINK QUEUED");
+		return true;
+	}
+
+	char addr[256];
+	m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (m_socket == INVALID_SOCKET) {
+		sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
+		closesocket(m_socket);
+		return false;
+	}
+	sprintf(addr, "127.0.0.1");
+	clientService.sin_family = AF_INET;
+	clientService.sin_addr.s_addr = inet_addr(addr);
+	if (isCSM)
+	{
+		clientService.sin_port = htons(14242);
+	}
+	else
+	{
+		clientService.sin_port = htons(14243);
+	}
+	if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
+		sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
+		closesocket(m_socket);
+		return false;
+	}
+	sprintf(debugWinsock, "CONNECTED");
+	return true;
+}
+
+//
+// Hand the keys collected in the uplink buffer to the PCM as one load. Over the socket
+// they are sent by MinorCycle instead.
+//
+
+void ARCore::SendUplink()
+{
+	if (g_Data.uplinkQueue == NULL) {
+		return;
+	}
+
+	std::vector<unsigned char> load;
+	while (!g_Data.uplinkBuffer.empty()) {
+		load.push_back(g_Data.uplinkBuffer.front());
+		g_Data.uplinkBuffer.pop();
+	}
+
+	if (!g_Data.uplinkQueue->Enqueue(load)) {
+		sprintf(debugWinsock, "UPLINK BUFFER FULL");
+		g_Data.connStatus = 0;
+		g_Data.uplinkQueue = NULL;
+	}
+}
+
 void ARCore::UplinkData(bool isCSM)
 {
 	if (g_Data.connStatus == 0) {
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
 		char buffer[8];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
+		if (!StartUplink(isCSM)) {
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (isCSM)
-		{
-			clientService.sin_port = htons(14242);
-		}
-		else
-		{
-			clientService.sin_port = htons(14243);
-		}
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		send_agc_key('V', isCSM);
 		send_agc_key('7', isCSM);
@@ -2191,6 +2258,7 @@ void ARCore::UplinkData(bool isCSM)
 		send_agc_key('E', isCSM);
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 		//.uplinkBufferSimt = oapiGetSimTime() + 5.0; //5 second delay
 	}
 }
@@ -2198,34 +2266,10 @@ void ARCore::UplinkData(bool isCSM)
 void ARCore::UplinkData2(bool isCSM)
 {
 	if (g_Data.connStatus == 0) {
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
 		char buffer[8];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
+		if (!StartUplink(isCSM)) {
 			return;
 		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (isCSM)
-		{
-			clientService.sin_port = htons(14242);
-		}
-		else
-		{
-			clientService.sin_port = htons(14243);
-		}
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		send_agc_key('V', isCSM);
 		send_agc_key('7', isCSM);
@@ -2247,6 +2291,7 @@ void ARCore::UplinkData2(bool isCSM)
 		send_agc_key('E', isCSM);
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 		//g_Data.uplinkBufferSimt = oapiGetSimTime() + 5.0; //6 second delay
 	}
 }
@@ -2254,34 +2299,10 @@ void ARCore::UplinkData2(bool isCSM)
 void ARCore::UplinkDataV70V73(bool v70, bool isCSM)
 {
 	if (g_Data.connStatus == 0) {
-		int bytesRecv = SOCKET_ERROR;
-		char addr[256];
 		char buffer[8];
-		m_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-		if (m_socket == INVALID_SOCKET) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "ERROR AT SOCKET(): %ld", WSAGetLastError());
-			closesocket(m_socket);
-			return;
-		}
-		sprintf(addr, "127.0.0.1");
-		clientService.sin_family = AF_INET;
-		clientService.sin_addr.s_addr = inet_addr(addr);
-		if (isCSM)
-		{
-			clientService.sin_port = htons(14242);
-		}
-		else
-		{
-			clientService.sin_port = htons(14243);
-		}
-		if (connect(m_socket, (SOCKADDR*)&clientService, sizeof(clientService)) == SOCKET_ERROR) {
-			//g_Data.uplinkDataReady = 0;
-			sprintf(debugWinsock, "FAILED TO CONNECT, ERROR %ld", WSAGetLastError());
-			closesocket(m_socket);
+		if (!StartUplink(isCSM)) {
 			return;
 		}
-		sprintf(debugWinsock, "CONNECTED");
 		g_Data.uplinkState = 0;
 		send_agc_key('V', isCSM);
 		send_agc_key('7', isCSM);
@@ -2307,6 +2328,7 @@ void ARCore::UplinkDataV70V73(bool v70, bool isCSM)
 		send_agc_key('E', isCSM);
 		g_Data.connStatus = 1;
 		g_Data.uplinkState = 0;
+		SendUplink();
 		//g_Data.uplinkBufferSimt = oapiGetSimTime() + 5.0; //6 second delay
 	}
 }
@@ -3388,6 +3410,7 @@ int ARCore::subThread()
 	}
 	break;
 	case 14: //MCC Targeting
+	case 56: //MCC Targeting, several options
 	{
 		EphemerisData sv0;
 		double CSMmass, LMmass;
@@ -3433,7 +3456,15 @@ int ARCore::subThread()
 			}
 		}
 
-		GC->rtcc->TranslunarMidcourseCorrectionProcessor(sv0, CSMmass, LMmass);
+		if (subThreadMode == 56)
+		{
+			std::vector<TLMCCOutputData> out;
+			GC->rtcc->TranslunarMidcourseCorrectionProcessor(sv0, CSMmass, LMmass, TLCCModes, out);
+		}
+		else
+		{
+			GC->rtcc->TranslunarMidcourseCorrectionProcessor(sv0, CSMmass, LMmass);
+		}
 
 		Result = 0;
 	}
@@ -22,6 +22,7 @@ struct ApolloRTCCMFDData {  // global data storage
 	int uplinkState;
 	std::queue<unsigned char> uplinkBuffer;
 	double uplinkBufferSimt;
+	PCMUplinkQueue *uplinkQueue;	// PCM of our own vessel, NULL when uplinking over the socket
 };
 
 class AR_GCore
@@ -62,6 +63,7 @@ public:
 	void EntryCalc();
 	void DeorbitCalc();
 	void TLCCCalc();
+	void TLCCMultiCalc();
 	void EntryUpdateCalc();
 	void StateVectorCalc(int type);
 	void AGSStateVectorCalc();
@@ -107,6 +109,8 @@ public:
 	bool vesselinLOS();
 	void MinorCycle(double SimT, double SimDT, double mjd);
 
+	bool StartUplink(bool isCSM);
+	void SendUplink();
 	void UplinkData(bool isCSM);
 	void UplinkData2(bool isCSM);
 	void UplinkDataV70V73(bool v70, bool isCSM);
@@ -297,6 +301,8 @@ public:
 	//TLCC PAGE
 	VECTOR3 R_TLI, V_TLI;
 	int TLCCSolGood;
+	//Options calculated together by TLCCMultiCalc, for the columns from the selected one on
+	std::vector<int> TLCCModes;
 
 	//LANDMARK TRACKING PAGE
 	AP11LMARKTRKPAD landmarkpad;
@@ -5463,6 +5463,11 @@ void ApolloRTCCMFD::menuSwitchUplinkInhibit()
 	G->inhibUplLOS = !G->inhibUplLOS;
 }
 
+void ApolloRTCCMFD::menuClearPropagationCaches()
+{
+	GC->rtcc->ClearPropagationCaches();
+}
+
 void ApolloRTCCMFD::menuCycleSPQMode()
 {
 	if (G->SPQMode < 2)
@@ -6653,6 +6658,35 @@ void ApolloRTCCMFD::menuTLCCCalc()
 	G->TLCCCalc();
 }
 
+void ApolloRTCCMFD::menuTLCCMultiCalc()
+{
+	bool TLCCMultiCalcInput(void *id, char *str, void *data);
+	oapiOpenInputBox("Options to calculate into the columns from the selected one on (Format: 1,3,5,9):", TLCCMultiCalcInput, 0, 20, (void*)this);
+}
+
+bool TLCCMultiCalcInput(void *id, char *str, void *data)
+{
+	return ((ApolloRTCCMFD*)data)->set_TLCCMultiCalc(str);
+}
+
+bool ApolloRTCCMFD::set_TLCCMultiCalc(char *str)
+{
+	int modes[4];
+	int num = sscanf(str, "%d,%d,%d,%d", &modes[0], &modes[1], &modes[2], &modes[3]);
+
+	if (num < 1) return false;
+
+	for (int i = 0;i < num;i++)
+	{
+		if (modes[i] < 1 || modes[i] > 9) return false;
+	}
+
+	G->TLCCModes.assign(modes, modes + num);
+	G->TLCCSolGood = true;
+	G->TLCCMultiCalc();
+	return true;
+}
+
 void ApolloRTCCMFD::menuLunarLiftoffCalc()
 {
 	if (GC->MissionPlanningActive ||(G->target != NULL && G->vesseltype == 1))
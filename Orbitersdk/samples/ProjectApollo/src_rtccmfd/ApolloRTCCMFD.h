@@ -218,6 +218,7 @@ public:
 	void menuChangeVesselStatus();
 	void menuCycleLMStage();
 	void menuUpdateLiftoffTime();
+	void menuClearPropagationCaches();
 	void AGCSignedValue(int &val);
 	void set_svtarget();
 	void TwoImpulseOffset();
@@ -361,6 +362,8 @@ public:
 	void menuTerrainModelCalc();
 	void set_TLand(double time);
 	void menuTLCCCalc();
+	void menuTLCCMultiCalc();
+	bool set_TLCCMultiCalc(char *str);
 	void menuNavCheckPADCalc();
 	void menuSetNavCheckGET();
 	void menuLAPCalc();
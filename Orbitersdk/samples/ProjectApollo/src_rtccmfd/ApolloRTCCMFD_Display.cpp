@@ -871,6 +871,10 @@ bool ApolloRTCCMFD::Update(oapi::Sketchpad *skp)
 
 		skp->Text(4 * W / 8, 8 * H / 14, "Update Liftoff Time", 19);
 
+		unsigned hits, misses;
+		GC->rtcc->GetPropagationCacheCounters(hits, misses);
+		sprintf(Buffer, "Coast cache: %u hits %u misses", hits, misses);
+		skp->Text(1 * W / 8, 13 * H / 14, Buffer, strlen(Buffer));
 
 
 		if (G->vesseltype == 0)
@@ -287,7 +287,7 @@ ApolloRTCCMFDButtons::ApolloRTCCMFDButtons()
 		{ "Set launch time", 0, 'K' },
 		{ "Set AGC Epoch", 0, 'E' },
 		{ "Update liftoff time", 0, 'T' },
-		{ "", 0, ' ' },
+		{ "Clear coast cache", 0, 'L' },
 		{ "Back to menu", 0, 'B' },
 	};
 
@@ -304,7 +304,7 @@ ApolloRTCCMFDButtons::ApolloRTCCMFDButtons()
 	RegisterFunction("TIM", OAPI_KEY_K, &ApolloRTCCMFD::menuSetLaunchTime);
 	RegisterFunction("EPO", OAPI_KEY_E, &ApolloRTCCMFD::menuSetAGCEpoch);
 	RegisterFunction("UPD", OAPI_KEY_U, &ApolloRTCCMFD::menuUpdateLiftoffTime);
-	RegisterFunction("", OAPI_KEY_L, &ApolloRTCCMFD::menuVoid);
+	RegisterFunction("CLR", OAPI_KEY_L, &ApolloRTCCMFD::menuClearPropagationCaches);
 	RegisterFunction("BCK", OAPI_KEY_B, &ApolloRTCCMFD::menuSetMenu);
 
 
@@ -2665,7 +2665,7 @@ ApolloRTCCMFDButtons::ApolloRTCCMFDButtons()
 		{ "", 0, ' ' },
 
 		{ "Calc. maneuver", 0, 'C' },
-		{ "", 0, ' ' },
+		{ "Calc. several options", 0, 'G' },
 		{ "", 0, ' ' },
 		{ "", 0, ' ' },
 		{ "Choose engine", 0, 'E' },
@@ -2682,7 +2682,7 @@ ApolloRTCCMFDButtons::ApolloRTCCMFDButtons()
 	RegisterFunction("", OAPI_KEY_Q, &ApolloRTCCMFD::menuVoid);
 
 	RegisterFunction("CLC", OAPI_KEY_C, &ApolloRTCCMFD::menuTLCCCalc);
-	RegisterFunction("", OAPI_KEY_G, &ApolloRTCCMFD::menuVoid);
+	RegisterFunction("ALL", OAPI_KEY_G, &ApolloRTCCMFD::menuTLCCMultiCalc);
 	RegisterFunction("", OAPI_KEY_P, &ApolloRTCCMFD::menuVoid);
 	RegisterFunction("", OAPI_KEY_S, &ApolloRTCCMFD::menuVoid);
 	RegisterFunction("ENG", OAPI_KEY_E, &ApolloRTCCMFD::menuMCCTransferPage);
@@ -21,6 +21,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 **************************************************************************/
 
+#include <algorithm>
 #include "CoastNumericalIntegrator.h"
 #include "OrbMech.h"
 #include "rtcc.h"
@@ -45,7 +46,17 @@ CoastIntegrator2::~CoastIntegrator2()
 
 bool CoastIntegrator2::Propagate(VECTOR3 R00, VECTOR3 V00, double gmt, double tmax, double tmin, double deltat, double dir, int planet, int stopcond)
 {
-	//Initialize
+	Initialize(R00, V00, gmt, tmax, tmin, deltat, dir, planet, stopcond);
+
+	//Initialize forcing function
+	adfunc(R0);
+
+	Run();
+	return true;
+}
+
+void CoastIntegrator2::Initialize(VECTOR3 R00, VECTOR3 V00, double gmt, double tmax, double tmin, double deltat, double dir, int planet, int stopcond)
+{
 	t0 = gmt;
 	R0 = R = R_CON = R00;
 	V0 = V = V_CON = V00;
@@ -117,10 +128,10 @@ bool CoastIntegrator2::Propagate(VECTOR3 R00, VECTOR3 V00, double gmt, double tm
 	tau = TRECT = 0.0;
 	INITF = false;
 	INITE = 0;
+}
 
-	//Initialize forcing function
-	adfunc(R0);
-
+void CoastIntegrator2::Run()
+{
 	do
 	{
 		Edit();
@@ -135,7 +146,19 @@ bool CoastIntegrator2::Propagate(VECTOR3 R00, VECTOR3 V00, double gmt, double tm
 	T2 = CurrentTime();
 	outplanet = P;
 	ITS = ISTOPS;
-	return true;
+}
+
+void CoastIntegrator2::ResumeBounded()
+{
+	//Same as the bounding in Edit
+	RestoreVariables();
+	VAR = dt;
+	dt = (VAR*RES1) / (RES1 - RCALC);
+	RES2 = RCALC;
+	INITE = 1;
+
+	Step();
+	Run();
 }
 
 void CoastIntegrator2::Edit()
@@ -493,6 +516,7 @@ void CoastIntegrator2::SetBodyParameters(int p)
 		P = BODY_EARTH;
 		GMD = 4;
 		GMO = 0; //4 to use the full tesseral data
+		GravityKernel = GravityKernels::SelectKernel(GMD, GMO);
 		ZONAL[0] = 0.0; ZONAL[1] = OrbMech::J2_Earth; ZONAL[2] = OrbMech::J3_Earth; ZONAL[3] = OrbMech::J4_Earth;
 		//Use this when Orbiter simulates it
 		//C[0] = -1.1619e-9; C[1] =  1.5654e-6; C[2] = 2.1625e-6; C[3] =  3.18750e-7; C[4] = 9.7078e-8; C[5] = -5.1257e-7; C[6] = 7.739e-8; C[7] =  5.7700e-8; C[8] = -3.4567e-9;
@@ -509,6 +533,7 @@ void CoastIntegrator2::SetBodyParameters(int p)
 		P = BODY_MOON;
 		GMD = 3;
 		GMO = 0; //3 with L1 model
+		GravityKernel = GravityKernels::SelectKernel(GMD, GMO);
 		ZONAL[0] = 0.0; ZONAL[1] = OrbMech::J2_Moon; ZONAL[2] = OrbMech::J3_Moon; ZONAL[3] = 0.0;
 		//L1 model, use this when Orbiter simulates it
 		//C[0] = 0.0; C[1] = 0.20715e-4; C[2] = 0.34e-4; C[4] = 0.02583e-4;
@@ -559,6 +584,13 @@ void CoastIntegrator2::ACCEL_GRAV()
 	//Starting values for recursive relations used in Pines formulation
 	R0_ZERO = R_E * R_INV;
 	R0_N = R0_ZERO * mu*R_INV*R_INV;
+	//Zonal only models have a specialized kernel
+	if (GravityKernel)
+	{
+		GravityKernel(UR, R0_ZERO, R0_N, ZONAL, G_VEC);
+		G_VEC = rhmul(Rot, G_VEC);
+		return;
+	}
 	MAT_A[0][1] = 3.0*UR.z;
 	MAT_A[1][1] = 3.0;
 	ZETA_REAL[0] = 1.0;
@@ -612,4 +644,509 @@ void CoastIntegrator2::ACCEL_GRAV()
 	//Lastly, the planet fixed acceleration vector shall be obtained and rotated to ecliptic coordinates
 	G_VEC = G_VEC - UR * AUXILIARY;
 	G_VEC = rhmul(Rot, G_VEC);
-}
\ No newline at end of file
+}
+
+CoastBatchIntegrator::CoastBatchIntegrator(RTCC *r) : RTCCModule(r)
+{
+	NumActive = 0;
+	T = T_ENV = 0.0;
+	ENV = false;
+	ROTVALID[0] = ROTVALID[1] = false;
+}
+
+unsigned CoastBatchIntegrator::Add(VECTOR3 R00, VECTOR3 V00, double gmt, double tmax, double tmin, double deltat, double dir, int planet, int stopcond)
+{
+	Integ.push_back(CoastIntegrator2(pRTCC));
+	Integ.back().Initialize(R00, V00, gmt, tmax, tmin, deltat, dir, planet, stopcond);
+	return Integ.size() - 1;
+}
+
+void CoastBatchIntegrator::Propagate()
+{
+	unsigned num = Integ.size();
+
+	R2.assign(num, _V(0, 0, 0));
+	V2.assign(num, _V(0, 0, 0));
+	T2.assign(num, 0.0);
+	outplanet.assign(num, BODY_EARTH);
+	ITS.assign(num, 0);
+
+	Index.resize(num);
+	P.resize(num);
+	mu.resize(num);
+	mu_Q.resize(num);
+	R_E.resize(num);
+	r_dP.resize(num);
+	R_CON.Resize(num);
+	V_CON.Resize(num);
+	delta.Resize(num);
+	nu.Resize(num);
+	R.Resize(num);
+	R_apo.Resize(num);
+	V_apo.Resize(num);
+	alpha.Resize(num);
+	for (int s = 0;s < 3;s++)
+	{
+		k[s].Resize(num);
+	}
+
+	Direction(1.0);
+	Direction(-1.0);
+}
+
+void CoastBatchIntegrator::Direction(double sgn)
+{
+	std::vector<unsigned> order;
+	unsigned next, j;
+	double h, h_j, dt;
+	bool join;
+
+	//Trajectories of this direction, in the order in which they join the batch
+	for (unsigned i = 0;i < Integ.size();i++)
+	{
+		if ((Integ[i].HMULT >= 0.0) == (sgn > 0.0))
+		{
+			order.push_back(i);
+		}
+	}
+	std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b) { return sgn*Integ[a].t0 < sgn*Integ[b].t0; });
+
+	NumActive = 0;
+	next = 0;
+	while (next < order.size() || NumActive > 0)
+	{
+		if (NumActive == 0)
+		{
+			T = Integ[order[next]].t0;
+		}
+		while (next < order.size() && Integ[order[next]].t0 == T)
+		{
+			Join(order[next]);
+			next++;
+		}
+
+		Environment(T);
+
+		//The common step is the shortest step of all trajectories
+		h = -1.0;
+		j = 0;
+		while (j < NumActive)
+		{
+			h_j = Edit(j);
+			if (h_j < 0.0)
+			{
+				Leave(j);
+				continue;
+			}
+			if (h < 0.0 || h_j < h)
+			{
+				h = h_j;
+			}
+			j++;
+		}
+		if (NumActive == 0)
+		{
+			continue;
+		}
+
+		dt = sgn * h;
+		//Don't step past the initial time of the next trajectory
+		join = false;
+		if (next < order.size() && sgn*(Integ[order[next]].t0 - T) <= h)
+		{
+			dt = Integ[order[next]].t0 - T;
+			join = true;
+		}
+
+		Step(dt);
+		for (j = 0;j < NumActive;j++)
+		{
+			Integ[Index[j]].dt = dt;
+		}
+		if (join)
+		{
+			T = Integ[order[next]].t0;
+		}
+	}
+}
+
+void CoastBatchIntegrator::Join(unsigned i)
+{
+	CoastIntegrator2 &c = Integ[i];
+	unsigned j = NumActive;
+
+	NumActive++;
+	Index[j] = i;
+	R_CON.Set(j, c.R0);
+	V_CON.Set(j, c.V0);
+	R.Set(j, c.R0);
+	delta.Set(j, _V(0, 0, 0));
+	nu.Set(j, _V(0, 0, 0));
+	LoadBody(j);
+}
+
+void CoastBatchIntegrator::Leave(unsigned j)
+{
+	//Move the last active trajectory into the free place
+	NumActive--;
+	if (j == NumActive) return;
+
+	Index[j] = Index[NumActive];
+	P[j] = P[NumActive];
+	mu[j] = mu[NumActive];
+	mu_Q[j] = mu_Q[NumActive];
+	R_E[j] = R_E[NumActive];
+	r_dP[j] = r_dP[NumActive];
+	R_CON.Copy(j, NumActive);
+	V_CON.Copy(j, NumActive);
+	delta.Copy(j, NumActive);
+	nu.Copy(j, NumActive);
+	R.Copy(j, NumActive);
+}
+
+double CoastBatchIntegrator::Edit(unsigned j)
+{
+	CoastIntegrator2 &c = Integ[Index[j]];
+	VECTOR3 V;
+	double rr, dt_max, TIME, FUNCT, RCALC, h;
+
+	//Same logic as CoastIntegrator2::Edit, the trajectory leaves the batch when the end condition has been bounded
+	rr = length(R.Get(j));
+	if (P[j] == BODY_MOON)
+	{
+		//Are we leaving the sphere of influence?
+		if (rr > c.r_SPH)
+		{
+			R_CON.Set(j, R_CON.Get(j) + R_EM);
+			V_CON.Set(j, V_CON.Get(j) + V_EM);
+			c.SetBodyParameters(BODY_EARTH);
+			LoadBody(j);
+			Rectification(j);
+			//Reset bounding logic
+			c.INITE = 0;
+		}
+	}
+	else if (length(R.Get(j) - R_EM) < c.r_SPH)
+	{
+		R_CON.Set(j, R_CON.Get(j) - R_EM);
+		V_CON.Set(j, V_CON.Get(j) - V_EM);
+		c.SetBodyParameters(BODY_MOON);
+		LoadBody(j);
+		Rectification(j);
+		//Reset bounding logic
+		c.INITE = 0;
+	}
+	if (length(delta.Get(j)) / length(R_CON.Get(j)) > 0.01 || length(delta.Get(j)) > c.rect1 || length(nu.Get(j)) > c.rect2)
+	{
+		Rectification(j);
+	}
+
+	//Termination control
+	TIME = abs(c.TRECT + c.tau);
+	dt_max = min(CoastIntegrator2::dt_lim, CoastIntegrator2::K*OrbMech::power(rr, 1.5) / sqrt(mu[j]));
+	h = abs(c.HMULT)*dt_max;
+
+	if (c.TMIN > TIME)
+	{
+		//Minimum time not reached
+		return h;
+	}
+	V = V_CON.Get(j) + nu.Get(j);
+	if (c.ISTOPS == 1)
+	{
+		FUNCT = TIME;
+	}
+	else if (c.ISTOPS == 2)
+	{
+		FUNCT = dotp(unit(R.Get(j)), unit(V));
+	}
+	else
+	{
+		FUNCT = length(R.Get(j));
+	}
+	RCALC = FUNCT - c.STOPVA;
+
+	//Special time logic
+	if (c.ISTOPS == 1)
+	{
+		h = abs(c.HMULT)*min(abs(RCALC), dt_max);
+		if (h <= 1e-6)
+		{
+			Finish(j, 1);
+			return -1.0;
+		}
+		return h;
+	}
+	//Other than time
+
+	//Termination check
+	if (abs(RCALC / c.DEV) <= 1.e-12)
+	{
+		Finish(j, c.ISTOPS);
+		return -1.0;
+	}
+
+	if (c.INITE == 0)
+	{
+		//First pass
+		c.INITE = -1;
+	}
+	else if (RCALC*c.RES1 < 0)
+	{
+		//Found it, the last step of the batch went past the end condition. Continue without the batch
+		c.RCALC = RCALC;
+		c.ResumeBounded();
+		Output(Index[j], c);
+		return -1.0;
+	}
+
+	//TMAX check
+	if (c.TMAX - TIME <= 1e-6)
+	{
+		if (c.TMAX == 0.0 || TIME - c.TMAX <= 1e-6)
+		{
+			//The batch doesn't step past TMAX, so this is the state at TMAX
+			Finish(j, 1);
+		}
+		else
+		{
+			//TMAX was passed before the minimum time, integrate back to it
+			c.Propagate(R.Get(j), V, c.t0 + c.TRECT + c.tau, 0.0, 0.0, c.HMULT*(c.TMAX - TIME), 1.0, P[j], 1);
+			Output(Index[j], c);
+		}
+		return -1.0;
+	}
+
+	//Store the state before the next step
+	c.P_S = P[j];
+	c.R_S = R.Get(j);
+	c.V_S = V;
+	c.T_S = c.TRECT + c.tau;
+	c.RES1 = RCALC;
+
+	return min(h, c.TMAX - TIME);
+}
+
+void CoastBatchIntegrator::Step(double dt)
+{
+	const unsigned n = NumActive;
+	unsigned j;
+	double h, s, gamma, r_apo, alpha_N, x_t;
+	VECTOR3 R_C, V_C;
+
+	h = 0.0;
+	for (j = 0;j < n;j++)
+	{
+		R_apo.x[j] = R_CON.x[j]; R_apo.y[j] = R_CON.y[j]; R_apo.z[j] = R_CON.z[j];
+		V_apo.x[j] = V_CON.x[j]; V_apo.y[j] = V_CON.y[j]; V_apo.z[j] = V_CON.z[j];
+		alpha.x[j] = delta.x[j]; alpha.y[j] = delta.y[j]; alpha.z[j] = delta.z[j];
+	}
+	for (int stage = 0;stage < 3;stage++)
+	{
+		//Ephemerides and rotation matrices once per stage for all trajectories
+		Environment(T + 0.5*dt*(double)stage);
+
+		for (j = 0;j < n;j++)
+		{
+			R.x[j] = R_CON.x[j] + alpha.x[j];
+			R.y[j] = R_CON.y[j] + alpha.y[j];
+			R.z[j] = R_CON.z[j] + alpha.z[j];
+		}
+		Forces(k[stage]);
+
+		if (stage < 2)
+		{
+			h = h + 0.5*dt;
+			for (j = 0;j < n;j++)
+			{
+				alpha.x[j] = delta.x[j] + (nu.x[j] + k[stage].x[j] * h*0.5)*h;
+				alpha.y[j] = delta.y[j] + (nu.y[j] + k[stage].y[j] * h*0.5)*h;
+				alpha.z[j] = delta.z[j] + (nu.z[j] + k[stage].z[j] * h*0.5)*h;
+			}
+			//Conic state at the next stage, from the state at the last rectification of each trajectory
+			for (j = 0;j < n;j++)
+			{
+				CoastIntegrator2 &c = Integ[Index[j]];
+
+				c.tau = c.tau + 0.5*dt;
+				r_apo = length(R_apo.Get(j));
+				s = sqrt(mu[j]) / r_apo * 0.5*dt;
+				gamma = dotp(R_apo.Get(j), V_apo.Get(j)) / (r_apo*sqrt(mu[j])*2.0);
+				alpha_N = 2.0 / length(c.R0) - OrbMech::power(length(c.V0), 2.0) / mu[j];
+				x_t = c.x + s * (1.0 - gamma * s*(1.0 - 2.0 * gamma*s) - 1.0 / 6.0 * (1.0 / r_apo - alpha_N)*s*s);
+				OrbMech::rv_from_r0v0(c.R0, c.V0, c.tau, R_C, V_C, mu[j], x_t);
+				R_CON.Set(j, R_C);
+				V_CON.Set(j, V_C);
+			}
+		}
+	}
+	for (j = 0;j < n;j++)
+	{
+		delta.x[j] = delta.x[j] + (nu.x[j] + (k[0].x[j] + k[1].x[j] * 2.0)*dt*1.0 / 6.0)*dt;
+		delta.y[j] = delta.y[j] + (nu.y[j] + (k[0].y[j] + k[1].y[j] * 2.0)*dt*1.0 / 6.0)*dt;
+		delta.z[j] = delta.z[j] + (nu.z[j] + (k[0].z[j] + k[1].z[j] * 2.0)*dt*1.0 / 6.0)*dt;
+		nu.x[j] = nu.x[j] + (k[0].x[j] + k[1].x[j] * 4.0 + k[2].x[j]) * 1.0 / 6.0 *dt;
+		nu.y[j] = nu.y[j] + (k[0].y[j] + k[1].y[j] * 4.0 + k[2].y[j]) * 1.0 / 6.0 *dt;
+		nu.z[j] = nu.z[j] + (k[0].z[j] + k[1].z[j] * 4.0 + k[2].z[j]) * 1.0 / 6.0 *dt;
+		R.x[j] = R_CON.x[j] + delta.x[j];
+		R.y[j] = R_CON.y[j] + delta.y[j];
+		R.z[j] = R_CON.z[j] + delta.z[j];
+	}
+	T = T + 0.5*dt*2.0;
+}
+
+void CoastBatchIntegrator::Forces(VectorArray &acc)
+{
+	const unsigned n = NumActive;
+	unsigned j;
+	double rx, ry, rz, ax, ay, az, r2, cx, cy, cz, r_c, q, fq, fac;
+	double sq, sm, qx, qy, qz, sx, sy, sz, dx, dy, dz, q_Q, q_S, fq_Q, fq_S, fac_Q, fac_S, above;
+
+	//Central body, difference to the conic acceleration (CoastIntegrator2::f)
+	for (j = 0;j < n;j++)
+	{
+		rx = R.x[j]; ry = R.y[j]; rz = R.z[j];
+		ax = alpha.x[j]; ay = alpha.y[j]; az = alpha.z[j];
+		cx = rx - ax; cy = ry - ay; cz = rz - az;
+		r2 = rx * rx + ry * ry + rz * rz;
+		r_c = sqrt(cx*cx + cy * cy + cz * cz);
+		q = ((ax - 2.0*rx)*ax + (ay - 2.0*ry)*ay + (az - 2.0*rz)*az) / r2;
+		fq = q * (3.0 + 3.0 * q + q * q) / (1.0 + (1.0 + q)*sqrt(1.0 + q));
+		fac = -mu[j] / (r_c*r_c*r_c);
+		acc.x[j] = (rx*fq + ax)*fac;
+		acc.y[j] = (ry*fq + ay)*fac;
+		acc.z[j] = (rz*fq + az)*fac;
+	}
+
+	//Perturbations of the other body and the Sun, only above the surface of the primary body (CoastIntegrator2::adfunc)
+	for (j = 0;j < n;j++)
+	{
+		rx = R.x[j]; ry = R.y[j]; rz = R.z[j];
+		r2 = rx * rx + ry * ry + rz * rz;
+		above = r2 > R_E[j] * R_E[j] ? 1.0 : 0.0;
+		//Position of the other body and the Sun relative to the primary body
+		sq = P[j] == BODY_EARTH ? 1.0 : -1.0;
+		sm = P[j] == BODY_EARTH ? 0.0 : 1.0;
+		qx = R_EM.x*sq; qy = R_EM.y*sq; qz = R_EM.z*sq;
+		sx = R_ES.x - R_EM.x*sm; sy = R_ES.y - R_EM.y*sm; sz = R_ES.z - R_EM.z*sm;
+
+		q_Q = ((rx - qx * 2.0)*rx + (ry - qy * 2.0)*ry + (rz - qz * 2.0)*rz) / (qx*qx + qy * qy + qz * qz);
+		q_S = ((rx - sx * 2.0)*rx + (ry - sy * 2.0)*ry + (rz - sz * 2.0)*rz) / (sx*sx + sy * sy + sz * sz);
+		fq_Q = q_Q * (3.0 + 3.0 * q_Q + q_Q * q_Q) / (1.0 + (1.0 + q_Q)*sqrt(1.0 + q_Q));
+		fq_S = q_S * (3.0 + 3.0 * q_S + q_S * q_S) / (1.0 + (1.0 + q_S)*sqrt(1.0 + q_S));
+		dx = rx - qx; dy = ry - qy; dz = rz - qz;
+		fac_Q = dx * dx + dy * dy + dz * dz;
+		fac_Q = -above * mu_Q[j] / (fac_Q*sqrt(fac_Q));
+		dx = rx - sx; dy = ry - sy; dz = rz - sz;
+		fac_S = dx * dx + dy * dy + dz * dz;
+		fac_S = -above * OrbMech::mu_Sun / (fac_S*sqrt(fac_S));
+
+		acc.x[j] += (qx*fq_Q + rx)*fac_Q + (sx*fq_S + rx)*fac_S;
+		acc.y[j] += (qy*fq_Q + ry)*fac_Q + (sy*fq_S + ry)*fac_S;
+		acc.z[j] += (qz*fq_Q + rz)*fac_Q + (sz*fq_S + rz)*fac_S;
+	}
+
+	//Non-spherical gravity of the primary body (CoastIntegrator2::ACCEL_GRAV)
+	for (j = 0;j < n;j++)
+	{
+		VECTOR3 RR, UR, G_VEC;
+		double r, R_INV, R0_ZERO, R0_N;
+
+		RR = R.Get(j);
+		r = length(RR);
+		if (r <= R_E[j] || r >= r_dP[j]) continue;
+
+		CoastIntegrator2 &c = Integ[Index[j]];
+		const MATRIX3 &M = RotationMatrix(P[j]);
+
+		if (c.GravityKernel)
+		{
+			R_INV = 1.0 / r;
+			UR = rhtmul(M, RR)*R_INV;
+			R0_ZERO = R_E[j] * R_INV;
+			R0_N = R0_ZERO * mu[j] * R_INV*R_INV;
+			c.GravityKernel(UR, R0_ZERO, R0_N, c.ZONAL, G_VEC);
+			G_VEC = rhmul(M, G_VEC);
+		}
+		else
+		{
+			//General recursion
+			c.R = RR;
+			c.Rot = M;
+			c.ACCEL_GRAV();
+			G_VEC = c.G_VEC;
+		}
+		acc.x[j] += G_VEC.x;
+		acc.y[j] += G_VEC.y;
+		acc.z[j] += G_VEC.z;
+	}
+}
+
+void CoastBatchIntegrator::Environment(double gmt)
+{
+	if (ENV && gmt == T_ENV) return;
+
+	pRTCC->PLEFEM(1, gmt / 3600.0, 0, &R_EM, &V_EM, &R_ES, NULL);
+	T_ENV = gmt;
+	ENV = true;
+	//Rotation matrices only when needed
+	ROTVALID[0] = ROTVALID[1] = false;
+}
+
+const MATRIX3 &CoastBatchIntegrator::RotationMatrix(int p)
+{
+	if (ROTVALID[p] == false)
+	{
+		Rot[p] = OrbMech::GetRotationMatrix(p, pRTCC->GetGMTBase() + T_ENV / 24.0 / 3600.0);
+		ROTVALID[p] = true;
+	}
+	return Rot[p];
+}
+
+void CoastBatchIntegrator::LoadBody(unsigned j)
+{
+	const CoastIntegrator2 &c = Integ[Index[j]];
+
+	P[j] = c.P;
+	mu[j] = c.mu;
+	mu_Q[j] = c.mu_Q;
+	R_E[j] = c.R_E;
+	r_dP[j] = c.r_dP;
+}
+
+void CoastBatchIntegrator::Rectification(unsigned j)
+{
+	CoastIntegrator2 &c = Integ[Index[j]];
+
+	c.TRECT = c.TRECT + c.tau;
+	c.R0 = R_CON.Get(j) + delta.Get(j);
+	c.V0 = V_CON.Get(j) + nu.Get(j);
+	R_CON.Set(j, c.R0);
+	V_CON.Set(j, c.V0);
+	R.Set(j, c.R0);
+	delta.Set(j, _V(0, 0, 0));
+	nu.Set(j, _V(0, 0, 0));
+	c.x = 0;
+	c.tau = 0;
+}
+
+void CoastBatchIntegrator::Finish(unsigned j, int its)
+{
+	CoastIntegrator2 &c = Integ[Index[j]];
+
+	c.R2 = R_CON.Get(j) + delta.Get(j);
+	c.V2 = V_CON.Get(j) + nu.Get(j);
+	c.T2 = c.CurrentTime();
+	c.outplanet = P[j];
+	c.ITS = its;
+	Output(Index[j], c);
+}
+
+void CoastBatchIntegrator::Output(unsigned i, const CoastIntegrator2 &c)
+{
+	R2[i] = c.R2;
+	V2[i] = c.V2;
+	T2[i] = c.T2;
+	outplanet[i] = c.outplanet;
+	ITS[i] = c.ITS;
+}
@@ -23,8 +23,10 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #pragma once
 
+#include <vector>
 #include "Orbitersdk.h"
 #include "RTCCModule.h"
+#include "GravityKernels.h"
 
 class CoastIntegrator2 : public RTCCModule
 {
@@ -39,6 +41,15 @@ public:
 	//End condition
 	int ITS;
 private:
+	//The batch integrator uses the initialization and the bounding logic of the single trajectory integrator
+	friend class CoastBatchIntegrator;
+
+	void Initialize(VECTOR3 R00, VECTOR3 V00, double gmt, double tmax, double tmin, double deltat, double dir, int planet, int stopcond);
+	//Integrates until the end condition is found and stores the output
+	void Run();
+	//Continues with the bounding logic after the end condition was found between the stored state and the current state. Uses the stored
+	//state, RCALC of the current state and the step length dt from the stored to the current state
+	void ResumeBounded();
 	void Edit();
 	void Step();
 	void Rectification();
@@ -132,6 +143,8 @@ private:
 	double ZETA_REAL[5], ZETA_IMAG[5];
 	//Degree and order of gravity calculations
 	int GMD, GMO;
+	//Specialized kernel for the degree and order, NULL to use the general recursion
+	GravityKernels::PinesKernel GravityKernel;
 	int L, I, N, N1, J;
 	double AUXILIARY;
 	double F1, F2, F3, F4, DNM;
@@ -146,4 +159,79 @@ private:
 	int P_S;
 	VECTOR3 R_S, V_S;
 	double T_S;
-};
\ No newline at end of file
+};
+
+//Batch mode of the coast integrator. All trajectories of one integration direction are integrated in lockstep with a common step length,
+//the smallest step any of them would take, so the Sun/Moon ephemerides and the rotation matrices of Earth and Moon are calculated once per
+//integration stage for the whole batch. The state used in the integration stages is stored as one array per component and the forcing
+//function is evaluated in loops over all active trajectories. A trajectory joins the batch when the common time reaches its initial time
+//and drops out of it when its end condition is found, the last steps to the end condition are done by the bounding logic of CoastIntegrator2.
+class CoastBatchIntegrator : public RTCCModule
+{
+public:
+	CoastBatchIntegrator(RTCC *r);
+	//Adds a trajectory with the inputs of CoastIntegrator2::Propagate, returns its index
+	unsigned Add(VECTOR3 R00, VECTOR3 V00, double gmt, double tmax, double tmin, double deltat, double dir, int planet, int stopcond);
+	unsigned Size() const { return Integ.size(); }
+	//Integrates all trajectories
+	void Propagate();
+
+	//Outputs, one per trajectory
+	std::vector<VECTOR3> R2, V2;
+	std::vector<double> T2;
+	std::vector<int> outplanet;
+	std::vector<int> ITS;
+private:
+	//Components of a vector for each active trajectory
+	struct VectorArray
+	{
+		std::vector<double> x, y, z;
+
+		void Resize(unsigned n) { x.resize(n); y.resize(n); z.resize(n); }
+		VECTOR3 Get(unsigned j) const { return _V(x[j], y[j], z[j]); }
+		void Set(unsigned j, VECTOR3 v) { x[j] = v.x; y[j] = v.y; z[j] = v.z; }
+		void Copy(unsigned to, unsigned from) { x[to] = x[from]; y[to] = y[from]; z[to] = z[from]; }
+	};
+
+	//Integrates all trajectories of one direction (1 = forward, -1 = backward)
+	void Direction(double sgn);
+	void Join(unsigned i);
+	void Leave(unsigned j);
+	//Termination control of active trajectory j. Returns the step length the trajectory allows, or a negative number if it has left the batch
+	double Edit(unsigned j);
+	void Step(double dt);
+	//Forcing function of all active trajectories at the stage positions R, stored in acc
+	void Forces(VectorArray &acc);
+	void Environment(double gmt);
+	const MATRIX3 &RotationMatrix(int p);
+	void LoadBody(unsigned j);
+	void Rectification(unsigned j);
+	void Finish(unsigned j, int its);
+	void Output(unsigned i, const CoastIntegrator2 &c);
+
+	//Single trajectory integrators, keep the parameters of each trajectory and do the bounding
+	std::vector<CoastIntegrator2> Integ;
+
+	//Number of active trajectories
+	unsigned NumActive;
+	//Index of the active trajectories
+	std::vector<unsigned> Index;
+	//Primary body and its parameters
+	std::vector<int> P;
+	std::vector<double> mu, mu_Q, R_E, r_dP;
+	//Conic state, deviation from the conic and position
+	VectorArray R_CON, V_CON, delta, nu, R;
+	//Values used in Step
+	VectorArray R_apo, V_apo, alpha, k[3];
+
+	//Common time of the batch
+	double T;
+	//Time of the shared quantities
+	double T_ENV;
+	bool ENV;
+	bool ROTVALID[2];
+	//Rotation matrices of Earth and Moon
+	MATRIX3 Rot[2];
+	//Moon/Sun Ephemerides
+	VECTOR3 R_EM, V_EM, R_ES;
+};
@@ -543,6 +543,7 @@ void EnckeFreeFlightIntegrator::SetBodyParameters(int p)
 		P = BODY_EARTH;
 		GMD = 4;
 		GMO = 0; //4 to use the full tesseral data
+		GravityKernel = GravityKernels::SelectKernel(GMD, GMO);
 		ZONAL[0] = 0.0; ZONAL[1] = OrbMech::J2_Earth; ZONAL[2] = OrbMech::J3_Earth; ZONAL[3] = OrbMech::J4_Earth;
 		//Use this when Orbiter simulates it
 		//C[0] = -1.1619e-9; C[1] =  1.5654e-6; C[2] = 2.1625e-6; C[3] =  3.18750e-7; C[4] = 9.7078e-8; C[5] = -5.1257e-7; C[6] = 7.739e-8; C[7] =  5.7700e-8; C[8] = -3.4567e-9;
@@ -558,6 +559,7 @@ void EnckeFreeFlightIntegrator::SetBodyParameters(int p)
 		P = BODY_MOON;
 		GMD = 3;
 		GMO = 0; //3 with L1 model
+		GravityKernel = GravityKernels::SelectKernel(GMD, GMO);
 		ZONAL[0] = 0.0; ZONAL[1] = OrbMech::J2_Moon; ZONAL[2] = OrbMech::J3_Moon; ZONAL[3] = 0.0;
 		//L1 model, use this when Orbiter simulates it
 		//C[0] = 0.0; C[1] = 0.20715e-4; C[2] = 0.34e-4; C[4] = 0.02583e-4;
@@ -715,6 +717,13 @@ void EnckeFreeFlightIntegrator::ACCEL_GRAV()
 	//Starting values for recursive relations used in Pines formulation
 	R0_ZERO = R_E * R_INV;
 	R0_N = R0_ZERO * mu*R_INV*R_INV;
+	//Zonal only models have a specialized kernel
+	if (GravityKernel)
+	{
+		GravityKernel(UR, R0_ZERO, R0_N, ZONAL, G_VEC);
+		G_VEC = rhmul(Rot, G_VEC);
+		return;
+	}
 	MAT_A[0][1] = 3.0*UR.z;
 	MAT_A[1][1] = 3.0;
 	ZETA_REAL[0] = 1.0;
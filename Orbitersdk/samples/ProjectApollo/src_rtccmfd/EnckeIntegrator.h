@@ -25,6 +25,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #include "Orbitersdk.h"
 #include "RTCCModule.h"
+#include "GravityKernels.h"
 #include "RTCCTables.h"
 
 struct EMMENIInputTable
@@ -198,6 +199,8 @@ private:
 	double ZETA_REAL[5], ZETA_IMAG[5];
 	//Degree and order of gravity calculations
 	int GMD, GMO;
+	//Specialized kernel for the degree and order, NULL to use the general recursion
+	GravityKernels::PinesKernel GravityKernel;
 	int L, I, N, N1, J;
 	double AUXILIARY;
 	double F1, F2, F3, F4, DNM;
@@ -23,6 +23,7 @@ See http://nassp.sourceforge.net/license/ for more details.
 
 #include "OrbMech.h"
 #include "GeneralizedIterator.h"
+#include "ParallelFor.h"
 
 namespace GenIterator
 {
@@ -42,152 +43,108 @@ namespace GenIterator
 		}
 	}
 
-	void tmat_mul_mat(double **A, double **B, int m, int n, int p, double **C)
+	GeneralizedIteratorArena::GeneralizedIteratorArena()
 	{
-		//A is NxM
-		//B is NxP
-		//C is MxP
-
-		int i, j, k;
-
-		for (i = 0;i < m;i++)
-		{
-			for (j = 0;j < p;j++)
-			{
-				C[i][j] = 0.0;
-				for (k = 0;k < n;k++)
-				{
-					C[i][j] += A[k][i] * B[k][j];
-				}
-			}
-		}
+		P = CARR = DARR = NULL;
+		CVEC = NULL;
+		InUse = false;
 	}
 
-	void diag_mul_mat(const std::vector<double> &a, double **B, int m, int n, double **C)
+	void GeneralizedIteratorArena::Setup(unsigned m, unsigned n)
 	{
-		//a is M
-		//B is MxN
-		//C is MxN
+		unsigned i;
 
-		int i, j;
+		//Storage only grows, so the same problem size doesn't allocate again
+		store.assign(n*m + 2 * m*m + m, 0.0);
+		rows.resize(n + 2 * m);
 
-		for (i = 0;i < m;i++)
+		for (i = 0;i < n + 2 * m;i++)
 		{
-			for (j = 0;j < n;j++)
-			{
-				C[i][j] = a[i] * B[i][j];
-			}
+			rows[i] = &store[i*m];
 		}
-	}
+		P = &rows[0];
+		CARR = P + n;
+		DARR = CARR + m;
+		CVEC = &store[(n + 2 * m)*m];
 
-	void vec_mul_vec(const std::vector<double> &a, const std::vector<double> &b, double *c)
-	{
-		for (unsigned i = 0;i < a.size();i++)
+		Y.resize(m);
+		for (i = 0;i < m;i++)
 		{
-			c[i] = a[i] * b[i];
+			Y[i].assign(n, 0.0);
 		}
 	}
 
-	void vec_mul_skal(const std::vector<double> &a, double b, double *c)
+	//Marks the arena as used while the iterator runs
+	struct ArenaLock
 	{
-		for (unsigned i = 0;i < a.size();i++)
-		{
-			c[i] = a[i] * b;
-		}
-	}
+		ArenaLock(GeneralizedIteratorArena *a) : arena(a) { arena->InUse = true; }
+		~ArenaLock() { arena->InUse = false; }
+		GeneralizedIteratorArena *arena;
+	};
 
-	void mat_mul_vec(double **A, double *b, int m, int n, double *c)
+	void MatrixMultiply(double **P, const std::vector<double> &W_X, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c)
 	{
-		for (int i = 0;i < m;i++)
-		{
-			c[i] = 0.0;
-			for (int j = 0;j < n;j++)
-			{
-				c[i] += A[i][j] * b[j];
-			}
-		}
-	}
+		//W_X is M
+		//W_Y is N
+		//P is NxM
+		//dy is N
+		//c = P^T*W_Y*dy is M
+		//C = P^T*W_Y*P is MxM
 
-	void tmat_mul_vec(double **A, double *b, int m, int n, double *c)
-	{
-		for (int i = 0;i < m;i++)
+		int i, j, k;
+		double b, *Pk;
+
+		for (i = 0;i < m;i++)
 		{
 			c[i] = 0.0;
-			for (int j = 0;j < n;j++)
+			for (j = 0;j < m;j++)
 			{
-				c[i] += A[j][i] * b[j];
+				C[i][j] = 0.0;
 			}
 		}
-	}
-
-	void mat_plus_vec(double **A, double *b, int n, double **C)
-	{
-		int i, j;
 
-		for (i = 0;i < n;i++)
+		//Accumulate one row of P at a time, so all accesses run along the rows
+		for (k = 0;k < n;k++)
 		{
-			for (j = 0;j < n;j++)
+			Pk = P[k];
+			b = W_Y[k] * dy[k];
+			for (i = 0;i < m;i++)
 			{
-				C[i][j] = A[i][j];
-				if (i == j)
+				c[i] += Pk[i] * b;
+				for (j = 0;j < m;j++)
 				{
-					C[i][j] += b[i];
+					C[i][j] += Pk[i] * (W_Y[k] * Pk[j]);
 				}
 			}
 		}
 	}
 
-	void MatrixMultiply(double **P, const std::vector<double> &W_X, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c)
+	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, int n, double **D)
 	{
-		//W_X is M
-		//W_Y is N
-		//P is NxM
-		//dy, b are N
-		//c is M
-		//B is NxM
 		//C is MxM
+		//D = C + lambda*W_X is MxM
 
-		double *b = new double[n];
-		double **B = new double*[n];
-		int i;
+		int i, j;
 
-		for (i = 0;i < n;i++)
+		for (i = 0;i < m;i++)
 		{
-			B[i] = new double[m];
+			for (j = 0;j < m;j++)
+			{
+				D[i][j] = CARR[i][j];
+			}
+			D[i][i] += W_X[i] * lambda;
 		}
-
-		vec_mul_vec(W_Y, dy, b);
-		tmat_mul_vec(P, b, m, n, c);
-		diag_mul_mat(W_Y, P, n, m, B);
-		tmat_mul_mat(P, B, m, n, m, C);
-
-		delete[] b;
-		delete[] B;
-	}
-
-	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, int n, double **D)
-	{
-		//A is M
-		//C is MxM
-		//D is MxM
-		double *A = new double[m];
-
-		vec_mul_skal(W_X, lambda, A);
-		mat_plus_vec(CARR, A, m, D);
-
-		delete[] A;
 	}
 
 	bool SolveEquations(double **D, double *c, int m, std::vector<double> &dx)
 	{
-		int *PP = new int[m + 1];
+		int PP[MGENITER + 1];
 
 		if (OrbMech::LUPDecompose(D, m, 0.0, PP) == 0)
 		{
 			return true;
 		}
 		OrbMech::LUPSolve(D, PP, c, m, dx);
-		delete[] PP;
 		return false;
 	}
 
@@ -216,16 +173,69 @@ namespace GenIterator
 		}
 	}
 
-	bool GeneralizedIterator(bool(*state_evaluation)(void*, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res)
+	//Evaluates the partials of the independent variables first to M-1, each on a worker thread with its own copy of the constants.
+	//Afterwards the constants, trajectory computer input and output are those of the last evaluation the sequential loop would have made
+	bool ParallelPartials(bool(*state_evaluation)(void*, std::vector<double>&, void*, std::vector<double>&, bool), const GeneralizedIteratorWorkspace &workspace, void *constants, void *data, std::vector<int> &xmap, std::vector<int> &ymap,
+		const std::vector<double> &var_star, const std::vector<double> &step, bool select, unsigned first, unsigned M, std::vector<double> &trajin, std::vector<double> &trajout, std::vector<std::vector<double>> &Y)
+	{
+		unsigned num = M - first;
+		unsigned k, last;
+		std::vector<void*> ws(num);
+		std::vector<std::vector<double>> in(num, trajin), out(num, trajout);
+		std::vector<char> err(num, 0);
+
+		for (k = 0;k < num;k++)
+		{
+			ws[k] = workspace.Create(constants);
+		}
+
+		ParallelFor(num, [&](unsigned k)
+		{
+			std::vector<double> v_l = var_star;
+			v_l[first + k] += step[first + k];
+
+			OpenRanks(xmap, v_l, in[k], M);
+			err[k] = state_evaluation(data, in[k], ws[k], out[k], select);
+			CloseRanks(ymap, out[k], Y[first + k], NGENITER);
+		});
+
+		//The sequential loop stops at the first error
+		last = num - 1;
+		for (k = 0;k < num;k++)
+		{
+			if (err[k])
+			{
+				last = k;
+				break;
+			}
+		}
+		workspace.Copy(constants, ws[last]);
+		trajin = in[last];
+		trajout = out[last];
+
+		for (k = 0;k < num;k++)
+		{
+			workspace.Destroy(ws[k]);
+		}
+		return err[last] != 0;
+	}
+
+	bool GeneralizedIterator(bool(*state_evaluation)(void*, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res, const GeneralizedIteratorWorkspace *workspace)
 	{
 		double lambda, R, R_old, w_avg, **P, **CARR, *CVEC, **DARR;
 		bool select = true, hasclass3, errind;
 		int n, nMax, class1num, j_optm;
 		unsigned N, M, i, j;
-		std::vector<double> Target, var_star, v_l, *Y, var_star_temp, var_star_cur, Y_star, C, dx, dy, dy_temp, W_Y, W_Y_apo, W_X, step, LowerLimit, UpperLimit, trajin, trajout, depweight, borderinterval;
+		std::vector<double> Target, var_star, v_l, var_star_temp, var_star_cur, Y_star, C, dx, dy, dy_temp, W_Y, W_Y_apo, W_X, step, LowerLimit, UpperLimit, trajin, trajout, depweight, borderinterval;
 		std::vector<double> Y_star_best;
 		std::vector<int> xmap, ymap, yclass, KPULL;
 
+		//Scratch matrices from the arena of this thread. A trajectory computer which runs an iteration itself gets its own
+		static thread_local GeneralizedIteratorArena ThreadArena;
+		GeneralizedIteratorArena LocalArena;
+		GeneralizedIteratorArena *arena = ThreadArena.InUse ? &LocalArena : &ThreadArena;
+		ArenaLock lock(arena);
+
 		trajin.assign(MGENITER, 0);
 		trajout.assign(NGENITER, 0);
 
@@ -271,9 +281,6 @@ namespace GenIterator
 			}
 		}
 
-		//Set up a vector
-		Y = new std::vector<double>[M];
-
 		var_star.assign(M, 0);
 		var_star_cur.assign(M, 0);
 		dx.assign(M, 0);
@@ -290,34 +297,12 @@ namespace GenIterator
 		KPULL.assign(N, 0);
 		j_optm = -1;
 
-		for (i = 0;i < M;i++)
-		{
-			Y[i].assign(N, 0);
-		}
-
-		P = new double*[N];
-		CARR = new double *[M];
-		DARR = new double *[M];
-		CVEC = new double[M];
-		for (i = 0;i < M;i++)
-		{
-			CVEC[i] = 0.0;
-			CARR[i] = new double[M];
-			DARR[i] = new double[M];
-			for (j = 0;j < M;j++)
-			{
-				CARR[i][j] = 0.0;
-				DARR[i][j] = 0.0;
-			}
-		}
-		for (i = 0;i < N;i++)
-		{
-			P[i] = new double[M];
-			for (j = 0;j < M;j++)
-			{
-				P[i][j] = 0.0;
-			}
-		}
+		arena->Setup(M, N);
+		P = arena->P;
+		CARR = arena->CARR;
+		DARR = arena->DARR;
+		CVEC = arena->CVEC;
+		std::vector<std::vector<double>> &Y = arena->Y;
 
 		//Set up iteration counters
 		nMax = 100;
@@ -511,6 +496,16 @@ namespace GenIterator
 		//Partial computation
 		for (j = 0;j < M;j++)
 		{
+			//The first partial is always evaluated here, the trajectory computer can update the constants on its first call in a mode
+			if (workspace && j > 0)
+			{
+				if (ParallelPartials(state_evaluation, *workspace, constants, data, xmap, ymap, var_star, step, select, j, M, trajin, trajout, Y))
+				{
+					return true;
+				}
+				break;
+			}
+
 			//Evalue trajectory computer
 			v_l = var_star;
 			v_l[j] += step[j];
@@ -523,8 +518,10 @@ namespace GenIterator
 			{
 				return true;
 			}
-
-			//Calculate matrix valuess
+		}
+		//Calculate matrix valuess
+		for (j = 0;j < M;j++)
+		{
 			for (i = 0;i < N;i++)
 			{
 				P[i][j] = (Y[j][i] - Y_star[i]) / step[j];
@@ -781,11 +778,6 @@ namespace GenIterator
 		goto NewGeneralizedIterator_EE;
 
 	NewGeneralizedIterator_END:
-		delete[] Y;
-		delete[] P;
-		delete[] CARR;
-		delete[] CVEC;
-
 		x_res = var_star;
 		y_res = Y_star_best;
 
@@ -46,9 +46,59 @@ namespace GenIterator
 		double DepVarWeight[30];
 	};
 
+	//Copies of the constants, to evaluate the partials on several threads. The state evaluation function then may only write
+	//to the constants it is given. Without a workspace the partials are evaluated one after another
+	struct GeneralizedIteratorWorkspace
+	{
+		//Allocate a copy of the constants
+		void *(*Create)(void *constants);
+		//Copy a workspace back into the constants
+		void(*Copy)(void *dst, void *src);
+		void(*Destroy)(void *ws);
+	};
+
+	template <class T> struct TypedWorkspace
+	{
+		static void *Create(void *constants) { return new T(*static_cast<T*>(constants)); }
+		static void Copy(void *dst, void *src) { *static_cast<T*>(dst) = *static_cast<T*>(src); }
+		static void Destroy(void *ws) { delete static_cast<T*>(ws); }
+	};
+
+	//Workspace for constants of type T, which have to be copyable
+	template <class T> GeneralizedIteratorWorkspace Workspace()
+	{
+		GeneralizedIteratorWorkspace ws = { &TypedWorkspace<T>::Create, &TypedWorkspace<T>::Copy, &TypedWorkspace<T>::Destroy };
+		return ws;
+	}
+
+	//Scratch matrices of the iterator in contiguous row-major storage. Sized once per problem and reused by the next call on the same thread
+	class GeneralizedIteratorArena
+	{
+	public:
+		GeneralizedIteratorArena();
+		//m independent and n dependent variables
+		void Setup(unsigned m, unsigned n);
+
+		//Sensitivity matrix, NxM
+		double **P;
+		//Normal equations matrix, MxM
+		double **CARR;
+		//Coefficient matrix, MxM. The LU decomposition swaps its rows
+		double **DARR;
+		//Normal equations vector, M
+		double *CVEC;
+		//Dependent variables of the perturbed trajectories, M vectors of N
+		std::vector<std::vector<double>> Y;
+
+		bool InUse;
+	protected:
+		std::vector<double> store;
+		std::vector<double*> rows;
+	};
+
 	void OpenRanks(std::vector<int> &xmap, std::vector<double> &in, std::vector<double> &out, int m);
 	void CloseRanks(std::vector<int> &ymap, std::vector<double> &in, std::vector<double> &out, int n2);
-	bool GeneralizedIterator(bool(*state_evaluation)(void *, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res);
+	bool GeneralizedIterator(bool(*state_evaluation)(void *, std::vector<double>&, void*, std::vector<double>&, bool), GeneralizedIteratorBlock vars, void *constants, void *data, std::vector<double> &x_res, std::vector<double> &y_res, const GeneralizedIteratorWorkspace *workspace = NULL);
 	void MatrixMultiply(double **P, const std::vector<double> &W_X, const std::vector<double> &W_Y, const std::vector<double> &dy, int m, int n, double **C, double *c);
 	void ComputeCoefficients(double **CARR, const std::vector<double> &W_X, double lambda, int m, int n, double **D);
 	bool SolveEquations(double **D, double *c, int m, std::vector<double> &dx);
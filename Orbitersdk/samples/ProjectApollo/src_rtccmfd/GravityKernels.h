@@ -0,0 +1,88 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Specialized Gravity Kernels for the RTCC Integrators (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include "Orbitersdk.h"
+
+namespace GravityKernels
+{
+	//Planet fixed acceleration from the planet fixed unit position vector UR, the ratio of body radius and position radius R0_ZERO,
+	//the starting value R0_N of the distance factor (R0_ZERO*mu/r^2) and the zonal harmonics coefficients (J1 to J4)
+	typedef void(*PinesKernel)(const VECTOR3 &UR, double R0_ZERO, double R0_N, const double *ZONAL, VECTOR3 &G_VEC);
+
+	//Factors 2N+1 and divisors J of the Legendre function recursion
+	static constexpr double PinesDegreeFactor[5] = { 1.0, 3.0, 5.0, 7.0, 9.0 };
+	static constexpr double PinesDivisor[5] = { 0.0, 1.0, 2.0, 3.0, 4.0 };
+
+	//Pines recursion of ACCEL_GRAV without tesseral harmonics (order 0), for a fixed degree. With the loop limits known at compile time the
+	//recursion is unrolled completely. The operations are the same as in the general recursion, so the result is identical.
+	template <int GMD> void PinesZonal(const VECTOR3 &UR, double R0_ZERO, double R0_N, const double *ZONAL, VECTOR3 &G_VEC)
+	{
+		static_assert(GMD >= 2 && GMD <= 4, "Gravity kernel degree has to be 2 to 4");
+
+		double MAT_A[GMD + 1][2];
+		double F3, F4, G_Z, AUXILIARY;
+
+		MAT_A[0][1] = 3.0*UR.z;
+		MAT_A[1][1] = 3.0;
+		G_Z = 0.0;
+		AUXILIARY = 0.0;
+
+		for (int N = 2;N <= GMD;N++)
+		{
+			MAT_A[N][1] = PinesDegreeFactor[N] * MAT_A[N - 1][1];
+			MAT_A[N - 1][0] = MAT_A[N - 1][1];
+			MAT_A[N - 1][1] = UR.z*MAT_A[N][1];
+			for (int J = 2;J <= N;J++)
+			{
+				MAT_A[N - J][0] = MAT_A[N - J][1];
+				MAT_A[N - J][1] = (UR.z*MAT_A[N - J + 1][1] - MAT_A[N - J + 1][0]) / PinesDivisor[J];
+			}
+			F3 = -MAT_A[0][0] * ZONAL[N - 1];
+			F4 = -MAT_A[0][1] * ZONAL[N - 1];
+
+			R0_N = R0_N * R0_ZERO;
+			G_Z = G_Z + R0_N * F3;
+			AUXILIARY = AUXILIARY + R0_N * F4;
+		}
+		G_VEC = _V(0.0, 0.0, G_Z) - UR * AUXILIARY;
+	}
+
+	//Kernel for a gravity model, NULL if the general recursion has to be used
+	inline PinesKernel SelectKernel(int GMD, int GMO)
+	{
+		if (GMO != 0) return NULL;
+
+		switch (GMD)
+		{
+		case 2:
+			return &PinesZonal<2>;
+		case 3:
+			return &PinesZonal<3>;
+		case 4:
+			return &PinesZonal<4>;
+		}
+		return NULL;
+	}
+}
@@ -287,8 +287,10 @@ namespace rtcc
 		EphemerisData sv_H;
 		VECTOR3 V_A, u;
 		double gamma_H, r_H, psi_H, v_A, psi_A, gamma_A, decl, rtasc;
-		int ITS;
+		PMMCENBatchTable batch;
+		unsigned index[8];
 
+		//Integrate to the LOI radius of all solutions together
 		for (int i = 0;i < 8;i++)
 		{
 			//If intersection solution wasn't calculated, skip
@@ -299,7 +301,18 @@ namespace rtcc
 			out.data[i].display.dv_LOI2 = DELV2(out.data[i].R_LOI, out.data[i].USSAV, RA_LPO + DHASAV, out.data[i].display.h_P + opt.R_LLS + DHPSAV, out.data[i].display.W_P);
 			sgn = OrbMech::sign(dotp(crossp(U_PC, out.data[i].R_LOI), U_H));
 
-			pRTCC->PMMCEN(opt.SPH, 0.0, 24.0*3600.0, 3, length(out.data[i].R_LOI), sgn, sv_H, ITS);
+			index[i] = batch.Add(opt.SPH, 0.0, 24.0*3600.0, 3, length(out.data[i].R_LOI), sgn);
+		}
+
+		pRTCC->PMMCEN(batch);
+
+		for (int i = 0;i < 8;i++)
+		{
+			if (out.data[i].GMT_LOI == 0.0)
+			{
+				continue;
+			}
+			sv_H = batch.sv_out[index[i]];
 
 			gamma_H = PI05 - acos2(dotp(unit(sv_H.R), unit(sv_H.V)));
 			r_H = length(sv_H.R);
@@ -117,7 +117,8 @@ bool LunarTargetingProgram::ConvergeOnImpact(double pitch, double yaw, double dv
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	return GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIteratorWorkspace workspace = GenIterator::Workspace<LUNTARGeneralizedIteratorArray>();
+	return GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &workspace);
 }
 
 EphemerisData LunarTargetingProgram::SimulateBurn(double pitch, double yaw, double dv, double &mass_f, double &bt)
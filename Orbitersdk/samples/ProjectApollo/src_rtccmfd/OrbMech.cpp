@@ -1,4 +1,5 @@
 #include "OrbMech.h"
+#include "PropagationCache.h"
 #include <limits>
 #include <vector>
 
@@ -990,8 +991,41 @@ VECTOR3 elegant_lambert(VECTOR3 R1, VECTOR3 V1, VECTOR3 R2, double dt, int N, bo
 	}
 }
 
+//Output of oneclickcoast
+struct OneClickCoastResult
+{
+	VECTOR3 R1, V1;
+	int gravout;
+	bool soichange;
+};
+
+//The integrator only depends on its inputs, so the cache never has to be invalidated
+static PropagationCache<10, OneClickCoastResult> OneClickCoastCache;
+
+void GetCoastCacheCounters(unsigned &hits, unsigned &misses)
+{
+	hits = OneClickCoastCache.GetHits();
+	misses = OneClickCoastCache.GetMisses();
+}
+
+void ClearCoastCache()
+{
+	OneClickCoastCache.Clear();
+}
+
 bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1, VECTOR3 &V1, int gravref, int &gravout)
 {
+	OneClickCoastResult res;
+	PropagationCache<10, OneClickCoastResult>::Key key = { R0.x, R0.y, R0.z, V0.x, V0.y, V0.z, mjd0, dt, (double)gravref, (double)gravout };
+
+	if (OneClickCoastCache.Find(key, res))
+	{
+		R1 = res.R1;
+		V1 = res.V1;
+		gravout = res.gravout;
+		return res.soichange;
+	}
+
 	bool stop, soichange;
 	CoastIntegrator* coast;
 	coast = new CoastIntegrator(R0, V0, mjd0, dt, gravref, gravout);
@@ -1005,6 +1039,13 @@ bool oneclickcoast(VECTOR3 R0, VECTOR3 V0, double mjd0, double dt, VECTOR3 &R1,
 	gravout = coast->outplanet;
 	soichange = coast->soichange;
 	delete coast;
+
+	res.R1 = R1;
+	res.V1 = V1;
+	res.gravout = gravout;
+	res.soichange = soichange;
+	OneClickCoastCache.Store(key, res);
+
 	return soichange;
 }
 
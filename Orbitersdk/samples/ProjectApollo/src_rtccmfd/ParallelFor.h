@@ -0,0 +1,70 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Parallel Loop (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <functional>
+
+//Set on the threads running the indices of a ParallelFor
+inline bool &ParallelForActive()
+{
+	static thread_local bool active = false;
+	return active;
+}
+
+//Runs func for the indices 0 to Count-1 on parallel threads. Each thread takes the next index when done with the previous one.
+//A ParallelFor called from one of the indices runs all its indices on the calling thread, the outer loop already has a thread per core
+inline void ParallelFor(unsigned Count, const std::function<void(unsigned)> &func)
+{
+	std::atomic<unsigned> next(0);
+
+	auto worker = [&]()
+	{
+		bool &active = ParallelForActive();
+		bool outer = active;
+		unsigned i;
+
+		active = true;
+		while ((i = next++) < Count)
+		{
+			func(i);
+		}
+		active = outer;
+	};
+
+	unsigned NumThreads = ParallelForActive() ? 1 : std::thread::hardware_concurrency();
+	if (NumThreads > Count) NumThreads = Count;
+	std::vector<std::thread> workers;
+	for (unsigned i = 1;i < NumThreads;i++)
+	{
+		workers.push_back(std::thread(worker));
+	}
+	worker();
+	for (unsigned i = 0;i < workers.size();i++)
+	{
+		workers[i].join();
+	}
+}
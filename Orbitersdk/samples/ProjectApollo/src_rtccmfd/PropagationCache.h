@@ -0,0 +1,140 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Propagation Result Cache (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <string.h>
+
+//FNV-1a hash of values, used for the cache keys and the stamps of the data the results depend on
+inline unsigned long long PropagationCacheHash(const double *val, int num)
+{
+	const unsigned char *p = (const unsigned char *)val;
+	unsigned long long h = 14695981039346656037ULL;
+	for (size_t i = 0;i < num * sizeof(double);i++)
+	{
+		h = (h ^ p[i]) * 1099511628211ULL;
+	}
+	return h;
+}
+
+//Stores the results of the last propagations, so a propagation that is repeated with the same inputs (display refresh, PAD regeneration,
+//iterators revisiting a guess) doesn't have to be integrated again. The key is the N input values of the propagation, an entry is only
+//used if all of them are bit-identical, so a cached result is always the result the integrator would have calculated.
+//Thread-safe, the batch propagation runs several integrators at once.
+template <int N, class Result> class PropagationCache
+{
+public:
+	typedef std::array<double, N> Key;
+
+	PropagationCache(unsigned size = 256) : MaxSize(size), Stamp(0), Hits(0), Misses(0) {}
+
+	//Hash of data the cached results depend on, other than the inputs. Clears the cache when it has changed since the last call
+	void Validate(unsigned long long stamp)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (stamp != Stamp)
+		{
+			Index.clear();
+			Entries.clear();
+			Stamp = stamp;
+		}
+	}
+
+	//Returns false if the key isn't stored
+	bool Find(const Key &key, Result &res)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = Index.find(key);
+		if (it == Index.end())
+		{
+			Misses++;
+			return false;
+		}
+		//Most recently used entry first
+		Entries.splice(Entries.begin(), Entries, it->second);
+		res = it->second->second;
+		Hits++;
+		return true;
+	}
+
+	void Store(const Key &key, const Result &res)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = Index.find(key);
+		if (it != Index.end())
+		{
+			//Another thread calculated it in the meantime
+			Entries.splice(Entries.begin(), Entries, it->second);
+			return;
+		}
+		if (Entries.size() >= MaxSize)
+		{
+			Index.erase(Entries.back().first);
+			Entries.pop_back();
+		}
+		Entries.push_front(std::make_pair(key, res));
+		Index[key] = Entries.begin();
+	}
+
+	void Clear()
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		Index.clear();
+		Entries.clear();
+		Hits = Misses = 0;
+	}
+
+	unsigned GetHits()
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return Hits;
+	}
+
+	unsigned GetMisses()
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return Misses;
+	}
+protected:
+	struct KeyHash
+	{
+		size_t operator()(const Key &key) const { return (size_t)PropagationCacheHash(key.data(), N); }
+	};
+	//Bitwise, so -0.0 and 0.0 are different keys, like they can be different inputs
+	struct KeyEqual
+	{
+		bool operator()(const Key &a, const Key &b) const { return memcmp(a.data(), b.data(), N * sizeof(double)) == 0; }
+	};
+	typedef std::list<std::pair<Key, Result>> EntryList;
+
+	std::mutex lock;
+	unsigned MaxSize;
+	unsigned long long Stamp;
+	unsigned Hits, Misses;
+	EntryList Entries;
+	std::unordered_map<Key, typename EntryList::iterator, KeyHash, KeyEqual> Index;
+};
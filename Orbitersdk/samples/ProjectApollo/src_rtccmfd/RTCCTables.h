@@ -291,6 +291,34 @@ struct PLAWDTOutput
 	double KFactor;
 };
 
+//Trajectories for the batch mode of the coast integrator, each input and output stored in its own array
+struct PMMCENBatchTable
+{
+	//Add a trajectory with the same inputs as PMMCEN, returns its index
+	unsigned Add(const EphemerisData &sv0, double t_min, double t_max, int option, double end_cond, double direction)
+	{
+		sv.push_back(sv0);
+		tmin.push_back(t_min);
+		tmax.push_back(t_max);
+		opt.push_back(option);
+		endcond.push_back(end_cond);
+		dir.push_back(direction);
+		return sv.size() - 1;
+	}
+	unsigned Size() const { return sv.size(); }
+
+	//Inputs
+	std::vector<EphemerisData> sv;
+	std::vector<double> tmin;
+	std::vector<double> tmax;
+	std::vector<int> opt;
+	std::vector<double> endcond;
+	std::vector<double> dir;
+	//Outputs
+	std::vector<EphemerisData> sv_out;
+	std::vector<int> ITS;
+};
+
 struct EMSLSFInputTable
 {
 	bool ECIEphemerisIndicator = false;
@@ -0,0 +1,194 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Chebyshev Sun/Moon Ephemeris Cache
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "SunMoonEphemeris.h"
+
+#define SUNMOON_CHEB_VERSION 1
+
+struct SunMoonChebyshevFileHeader
+{
+	char magic[8];
+	int version;
+	int epoch;
+	double mjd0;
+	int days;
+	int degree;
+	int components;
+	int reserved;
+};
+
+//First and last component of the groups selected in Evaluate
+static const int SunMoonChebyshevGroups[4][2] = { { 0, 3 }, { 3, 6 }, { 6, 9 }, { 9, 18 } };
+
+SunMoonChebyshevEphemeris::SunMoonChebyshevEphemeris()
+{
+	Clear();
+}
+
+void SunMoonChebyshevEphemeris::Clear()
+{
+	valid = false;
+	epoch = 0;
+	mjd0 = 0.0;
+	coef.clear();
+}
+
+void SunMoonChebyshevEphemeris::Generate(int ep, double mjd, std::function<void(double, double*)> sample)
+{
+	const int N = Degree + 1;
+	const double PI = 3.14159265358979323846;
+	double node[N], f[N][Components];
+	int d, i, j, k;
+
+	epoch = ep;
+	mjd0 = mjd;
+	coef.assign(Days*Components*N, 0.0);
+
+	for (j = 0;j < N;j++)
+	{
+		node[j] = cos(PI*((double)j + 0.5) / (double)N);
+	}
+
+	for (d = 0;d < Days;d++)
+	{
+		//Sample at the Chebyshev nodes of the day
+		for (j = 0;j < N;j++)
+		{
+			sample(mjd0 + (double)d + 0.5*(node[j] + 1.0), f[j]);
+		}
+		for (i = 0;i < Components;i++)
+		{
+			double *c = &coef[(d*Components + i)*N];
+			for (k = 0;k < N;k++)
+			{
+				for (j = 0;j < N;j++)
+				{
+					c[k] += f[j][i] * cos(PI*(double)k*((double)j + 0.5) / (double)N);
+				}
+				c[k] *= 2.0 / (double)N;
+			}
+			//Store the first coefficient halved, so evaluation is a plain sum
+			c[0] *= 0.5;
+		}
+	}
+	valid = true;
+}
+
+bool SunMoonChebyshevEphemeris::Load(const char *file, int ep, double mjd)
+{
+	SunMoonChebyshevFileHeader head;
+	FILE *f;
+
+	Clear();
+
+	f = fopen(file, "rb");
+	if (f == NULL) return false;
+
+	if (fread(&head, sizeof(head), 1, f) != 1 || strncmp(head.magic, "NASSPEPH", 8) || head.version != SUNMOON_CHEB_VERSION || head.epoch != ep ||
+		head.mjd0 != mjd || head.days != Days || head.degree != Degree || head.components != Components)
+	{
+		fclose(f);
+		return false;
+	}
+
+	coef.resize(Days*Components*(Degree + 1));
+	if (fread(coef.data(), sizeof(double), coef.size(), f) != coef.size())
+	{
+		fclose(f);
+		coef.clear();
+		return false;
+	}
+	fclose(f);
+
+	epoch = ep;
+	mjd0 = mjd;
+	valid = true;
+	return true;
+}
+
+bool SunMoonChebyshevEphemeris::Save(const char *file) const
+{
+	SunMoonChebyshevFileHeader head;
+	FILE *f;
+	bool ok;
+
+	if (!valid) return false;
+
+	f = fopen(file, "wb");
+	if (f == NULL) return false;
+
+	memset(&head, 0, sizeof(head));
+	memcpy(head.magic, "NASSPEPH", 8);
+	head.version = SUNMOON_CHEB_VERSION;
+	head.epoch = epoch;
+	head.mjd0 = mjd0;
+	head.days = Days;
+	head.degree = Degree;
+	head.components = Components;
+
+	ok = fwrite(&head, sizeof(head), 1, f) == 1 && fwrite(coef.data(), sizeof(double), coef.size(), f) == coef.size();
+	fclose(f);
+	return ok;
+}
+
+bool SunMoonChebyshevEphemeris::Evaluate(double mjd, const bool *groups, double *x) const
+{
+	const int N = Degree + 1;
+	double T[N], u, s;
+	int d, g, i, k;
+
+	if (!valid) return false;
+
+	u = mjd - mjd0;
+	d = (int)floor(u);
+	if (d < 0 || d >= Days) return false;
+
+	//Chebyshev polynomials at the time, scaled to -1 to 1 over the day
+	u = 2.0*(u - (double)d) - 1.0;
+	T[0] = 1.0;
+	T[1] = u;
+	for (k = 2;k < N;k++)
+	{
+		T[k] = 2.0*u*T[k - 1] - T[k - 2];
+	}
+
+	for (g = 0;g < 4;g++)
+	{
+		if (groups[g] == false) continue;
+
+		for (i = SunMoonChebyshevGroups[g][0];i < SunMoonChebyshevGroups[g][1];i++)
+		{
+			const double *c = &coef[(d*Components + i)*N];
+			s = 0.0;
+			for (k = 0;k < N;k++)
+			{
+				s += c[k] * T[k];
+			}
+			x[i] = s;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,60 @@
+/****************************************************************************
+This file is part of Project Apollo - NASSP
+
+Chebyshev Sun/Moon Ephemeris Cache (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <functional>
+
+//Chebyshev series of the 18 Sun/Moon ephemeris quantities of the MDGSUN table, one series per day of the mission span.
+//Generated once per launch day and saved to a file, so later sessions only have to read it.
+class SunMoonChebyshevEphemeris
+{
+public:
+	//Days covered, starting 5 days before midnight of launch day
+	static const int Days = 40;
+	//Degree of the Chebyshev series
+	static const int Degree = 10;
+	//0-2: Sun position vector (Er), 3-5: Moon position vector (Er), 6-8: Moon velocity vector (Er/hr), 9-17: Moon libration matrix
+	static const int Components = 18;
+
+	SunMoonChebyshevEphemeris();
+	void Clear();
+	bool IsValid() const { return valid; }
+
+	//Fit the series to a function returning the 18 quantities at a MJD
+	void Generate(int epoch, double mjd0, std::function<void(double, double*)> sample);
+	//Read the series from a file. Fails if the file doesn't exist or was made for another epoch or start time
+	bool Load(const char *file, int epoch, double mjd0);
+	bool Save(const char *file) const;
+	//Evaluate the series at a MJD. The 4 groups select Sun position, Moon position, Moon velocity and libration matrix, like in PLEFEM.
+	//Returns false if the time isn't covered
+	bool Evaluate(double mjd, const bool *groups, double *x) const;
+protected:
+	bool valid;
+	int epoch;
+	//MJD of the start of the first day
+	double mjd0;
+	//Coefficients, [day][component][degree]
+	std::vector<double> coef;
+};
@@ -26,6 +26,9 @@ See http://nassp.sourceforge.net/license/ for more details.
 #include "rtcc.h"
 #include "TLMCC.h"
 
+//The trajectory computers only write to the iterator array they are given, so the partials can be computed in parallel
+static const GenIterator::GeneralizedIteratorWorkspace TLMCCWorkspace = GenIterator::Workspace<TLMCCGeneralizedIteratorArray>();
+
 TLMCCProcessor::TLMCCProcessor(RTCC *r) : RTCCModule(r)
 {
 	R_E = OrbMech::R_Earth;
@@ -1613,7 +1616,7 @@ bool TLMCCProcessor::ConvergeTLMC(double V, double azi, double lng, double lat,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	return GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	return GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::IntegratedXYZTTrajectory(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double R_nd, double lat_nd, double lng_nd, double GMT_node)
@@ -1661,7 +1664,7 @@ void TLMCCProcessor::IntegratedXYZTTrajectory(EphemerisData sv0, double dv_guess
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFreeReturnInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double inc_pg, double lat_pl_min, double lat_pl_max)
@@ -1718,7 +1721,7 @@ void TLMCCProcessor::ConicFreeReturnInclinationFlyby(EphemerisData sv0, double d
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double inc_pg_min, double inc_pg_max, int inc_class)
@@ -1774,7 +1777,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedInclinationFlyby(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::IntegratedFreeReturnFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double lat_pl)
@@ -1826,7 +1829,7 @@ void TLMCCProcessor::IntegratedFreeReturnFlyby(EphemerisData sv0, double dv_gues
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFreeReturnFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double lat_pl)
@@ -1879,7 +1882,7 @@ void TLMCCProcessor::ConicFreeReturnFlyby(EphemerisData sv0, double dv_guess, do
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::IntegratedFreeReturnInclinationFlyby(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double H_pl, double inc_fr)
@@ -1926,7 +1929,7 @@ void TLMCCProcessor::IntegratedFreeReturnInclinationFlyby(EphemerisData sv0, dou
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi)
@@ -1994,7 +1997,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicNonfreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double T_min, double T_max)
@@ -2054,7 +2057,7 @@ void TLMCCProcessor::ConicNonfreeReturnOptimizedFixedOrbitToLLS(EphemerisData sv
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double dpsi_loi, double DT_lls, double AZ_min, double AZ_max)
@@ -2150,7 +2153,7 @@ void TLMCCProcessor::ConicFreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0,
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicNonfreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double T_min, double T_max, double h_pl)
@@ -2231,7 +2234,7 @@ void TLMCCProcessor::ConicNonfreeReturnOptimizedFreeOrbitToLOPC(EphemerisData sv
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicTransEarthInjection(double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, bool lngiter)
@@ -2296,7 +2299,7 @@ void TLMCCProcessor::ConicTransEarthInjection(double T_lo, double dv_tei, double
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFullMissionFreeOrbit(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double h_pl, double gamma_loi, double dpsi_loi, double dt_lls, double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, double AZ_min, double AZ_max, double mass, bool freereturn, double T_min, double T_max)
@@ -2466,7 +2469,7 @@ void TLMCCProcessor::ConicFullMissionFreeOrbit(EphemerisData sv0, double dv_gues
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 void TLMCCProcessor::ConicFullMissionFixedOrbit(EphemerisData sv0, double dv_guess, double dgamma_guess, double dpsi_guess, double gamma_loi, double T_lo, double dv_tei, double dgamma_tei, double dpsi_tei, double T_te, double mass, bool freereturn, double T_min, double T_max)
@@ -2600,7 +2603,7 @@ void TLMCCProcessor::ConicFullMissionFixedOrbit(EphemerisData sv0, double dv_gue
 
 	std::vector<double> result;
 	std::vector<double> y_vals;
-	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals);
+	GenIterator::GeneralizedIterator(fptr, block, constPtr, (void*)this, result, y_vals, &TLMCCWorkspace);
 }
 
 bool ConvergeTLMCPointer(void *data, std::vector<double> &var, void *varPtr, std::vector<double>& arr, bool mode)
@@ -2752,7 +2755,7 @@ bool TLMCCProcessor::IntegratedTrajectoryComputer(std::vector<double> &var, void
 	sv0 = sv0_apo = vars->sv0;
 
 	BURN(sv0.R, sv0.V, dv_mcc, dgamma_mcc, dpsi_mcc, isp_SPS, mfm0, sv0_apo.R, sv0_apo.V);
-	outarray.M_mcc = outarray.M_i*mfm0;
+	vars->M_mcc = vars->M_i*mfm0;
 	if (vars->NodeStopIndicator)
 	{
 		VECTOR3 R_node_emp, V_node_emp, R_pl, V_pl;
@@ -2824,7 +2827,7 @@ bool TLMCCProcessor::IntegratedTrajectoryComputer(std::vector<double> &var, void
 		{
 			double dlng;
 			RNTSIM(sv_r.R, sv_r.V, sv_r.GMT, Constants.lambda_IP, vars->lat_ip, vars->lng_ip, dlng);
-			outarray.GMT_ip = sv_r.GMT + Reentry_dt;
+			vars->GMT_ip = sv_r.GMT + Reentry_dt;
 		}
 
 		arr[4] = vars->h_pl / R_E;
@@ -2920,7 +2923,7 @@ bool TLMCCProcessor::ConicMissionComputer(std::vector<double> &var, void *varPtr
 	}
 
 	BURN(sv0.R, sv0.V, dv_mcc, dgamma_mcc, dpsi_mcc, isp_SPS, mfm0, RF, VF);
-	outarray.M_mcc = outarray.M_i * mfm0;
+	vars->M_mcc = vars->M_i * mfm0;
 
 	//TBD: MCOMP?
 	
@@ -2984,7 +2987,7 @@ bool TLMCCProcessor::ConicMissionComputer(std::vector<double> &var, void *varPtr
 			arr[2] = vars->incl_pl;
 			arr[4] = vars->incl_fr;
 			arr[3] = vars->h_fr / R_E;
-			arr[15] = outarray.M_mcc;
+			arr[15] = vars->M_mcc;
 			return false;
 		}
 	}
@@ -3009,7 +3012,7 @@ bool TLMCCProcessor::ConicMissionComputer(std::vector<double> &var, void *varPtr
 	vars->sv_loi.GMT = vars->GMT_nd;
 
 	//Apply offset
-	V_LOI += outarray.LOIOffset;
+	V_LOI += vars->LOIOffset;
 
 	VECTOR3 H_LOI;
 	double i_EMP;
@@ -3032,8 +3035,8 @@ bool TLMCCProcessor::ConicMissionComputer(std::vector<double> &var, void *varPtr
 	double dv, GMT_LPO;
 	dv = Constants.V_pcynlo - length(V_LOI);
 	BURN(R_LOI, V_LOI, dv, -vars->gamma_nd, vars->dpsi_loi, isp_MCC, mfm0, RF, VF);
-	outarray.M_loi = mfm0 * outarray.M_mcc;
-	outarray.M_cir = MCOMP(157.8*0.3048, MEDQuantities.Config, MEDQuantities.useSPS, outarray.M_loi);
+	vars->M_loi = mfm0 * vars->M_mcc;
+	vars->M_cir = MCOMP(157.8*0.3048, MEDQuantities.Config, MEDQuantities.useSPS, vars->M_loi);
 	vars->GMT_nd += vars->dt_bias_conic_prec*3600.0;
 	GMT_LPO = vars->GMT_nd + Constants.dt_bias*3600.0;
 
@@ -3084,11 +3087,11 @@ TLMCC_Conic_A1:
 	DV_LOI = sqrt(v_H*v_H + V1 * V1 - 2.0*v_H*V1*(cos(gamma_H)*dotp(U_DS, U_H))) + 10.0*0.3048; //10 ft/s calibration DV to account for finite burn loss
 	vars->dpsi_loi = acos(dotp(U_DS, U_H));
 
-	outarray.M_loi = MCOMP(DV_LOI, MEDQuantities.Config, MEDQuantities.useSPS, outarray.M_mcc);
+	vars->M_loi = MCOMP(DV_LOI, MEDQuantities.Config, MEDQuantities.useSPS, vars->M_mcc);
 
 	gamma = vars->gamma_L - vars->gamma1;
 	double DV_DOI = sqrt(vars->V2*vars->V2 + vars->V_L * vars->V_L - 2.0*vars->V_L*vars->V2*cos(gamma));
-	outarray.M_cir = MCOMP(DV_DOI, MEDQuantities.Config, MEDQuantities.useSPS, outarray.M_loi);
+	vars->M_cir = MCOMP(DV_DOI, MEDQuantities.Config, MEDQuantities.useSPS, vars->M_loi);
 
 	LIBRAT(vars->sv_lls1.R, vars->sv_lls1.V, vars->sv_lls1.GMT, 5);
 	vars->sv_lls1.GMT = vars->GMT_nd + vars->dt_lls;
@@ -3099,7 +3102,7 @@ TLMCC_Conic_A1:
 		goto TLMCC_Conic_Out;
 	}
 
-	outarray.M_lopc = outarray.M_cir - MEDQuantities.LMMass;
+	vars->M_lopc = vars->M_cir - MEDQuantities.LMMass;
 
 	goto TLMCC_Conic_F5;
 TLMCC_Conic_C4:
@@ -3120,13 +3123,13 @@ TLMCC_Conic_C4:
 	ELEMT(R_LLS, V_LLS, mu_M, H, a, e, i, n, P, eta);
 	P = PI2 / (length(V_LLS) / length(R_LLS) + OrbMech::w_Moon);
 	
-	LOPC(R_LLS, V_LLS, GMT_LLS, unit(R_temp), Constants.m, Constants.n, P, vars->sv_lls2.R, vars->sv_lls2.V, vars->sv_lls2.GMT, mfm0, dpsi_lopc, outarray.DV_LOPC);
+	LOPC(R_LLS, V_LLS, GMT_LLS, unit(R_temp), Constants.m, Constants.n, P, vars->sv_lls2.R, vars->sv_lls2.V, vars->sv_lls2.GMT, mfm0, dpsi_lopc, vars->DV_LOPC);
 	if (vars->FixedOrbitIndicator == false && abs(dpsi_lopc) < 8e-3)
 	{
 		DV_R = 2.0*length(vars->sv_lls2.V)*(31.24975000037*dpsi_lopc*dpsi_lopc + 2.0000053333202e-3);
 		mfm0 = exp(-DV_R / isp_MCC);
 	}
-	outarray.M_lopc = (outarray.M_cir - MEDQuantities.LMMass)*mfm0;
+	vars->M_lopc = (vars->M_cir - MEDQuantities.LMMass)*mfm0;
 
 TLMCC_Conic_F5:
 
@@ -3138,7 +3141,7 @@ TLMCC_Conic_F5:
 	CTBODY(vars->sv_lls2.R, vars->sv_lls2.V, vars->sv_lls2.GMT, vars->GMT_tei, 2, mu_M, R_TEI, V_TEI);
 	BURN(R_TEI, V_TEI, dv_tei, vars->dgamma_tei, vars->dpsi_tei, isp_MCC, mfm0, R_TEC, V_TEC);
 	vars->DV_TEI = V_TEC - V_TEI;
-	outarray.M_tei = outarray.M_lopc * mfm0;
+	vars->M_tei = vars->M_lopc * mfm0;
 	GMT_TEC = vars->GMT_tei;
 	if (PATCH(R_TEC, V_TEC, GMT_TEC, 1, 2))
 	{
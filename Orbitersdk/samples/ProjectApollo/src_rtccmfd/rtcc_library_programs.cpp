@@ -293,17 +293,74 @@ RTCC_ELNMVC_2B:
 	return err;
 }
 
+//Index of the first vector at or after GMT, starting at vector I. The ephemeris is ordered by time, so this gives the same vector as a linear search
+static unsigned EphemerisLowerBound(const std::vector<EphemerisData2> &table, unsigned I, double GMT)
+{
+	unsigned LO = I, HI = table.size(), temp;
+
+	while (LO < HI)
+	{
+		temp = (LO + HI) / 2;
+		if (GMT > table[temp].GMT)
+		{
+			LO = temp + 1;
+		}
+		else
+		{
+			HI = temp;
+		}
+	}
+	return LO;
+}
+
+//Index of the first maneuver ending at or after GMT
+static unsigned ManeuverTimesLowerBound(const ManeuverTimesTable &mantimes, double GMT)
+{
+	unsigned LO = 0, HI = mantimes.Table.size(), temp;
+
+	while (LO < HI)
+	{
+		temp = (LO + HI) / 2;
+		if (GMT > mantimes.Table[temp].ManData[1])
+		{
+			LO = temp + 1;
+		}
+		else
+		{
+			HI = temp;
+		}
+	}
+	return LO;
+}
+
+//Finds the first vector at or after GMT from the window offset on
+static unsigned ELVARYSearch(const EphemerisDataTable2 &EPH, const EphemerisHeader &window, double GMT)
+{
+	unsigned i = EphemerisLowerBound(EPH.table, window.Offset, GMT);
+	//Extrapolation beyond the last vector
+	if (i >= EPH.table.size())
+	{
+		i = EPH.table.size() - 1;
+	}
+	return i;
+}
+
 //Vector interpolation routine
-int RTCC::ELVARY(EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out)
+int RTCC::ELVARY(const EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out)
+{
+	return ELVARY(EPH, EPH.Header, ORER, GMT, EXTRAP, sv_out, ORER_out);
+}
+
+int RTCC::ELVARY(const EphemerisDataTable2 &EPH, const EphemerisHeader &window, unsigned ORER, double GMT, bool EXTRAP, EphemerisData2 &sv_out, unsigned &ORER_out)
 {
 	EphemerisData2 RES;
 	VECTOR3 TERM1, TERM2;
 	double TERM3;
 	unsigned DESLEF, DESRI;
-	unsigned i = EPH.Header.Offset;
+	unsigned i;
 	int ERR = 0;
 	//Ephemeris too small
-	if (EPH.Header.NumVec < 2)
+	if (window.NumVec < 2)
 	{
 		return 128;
 	}
@@ -312,33 +369,30 @@ int RTCC::ELVARY(EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRA
 	{
 		return 64;
 	}
-	if (EPH.Header.NumVec > ORER)
+	if (window.NumVec > ORER)
 	{
 		//Store Order(?)
 	}
 	else
 	{
 		ERR += 2;
-		ORER = EPH.Header.NumVec - 1;
+		ORER = window.NumVec - 1;
 	}
 
-	if (GMT < EPH.Header.TL)
+	if (GMT < window.TL)
 	{
 		if (EXTRAP == false) return 32;
-		if (GMT < EPH.Header.TL - 4.0) { return 8; }
+		if (GMT < window.TL - 4.0) { return 8; }
 		else { ERR += 1; }
 	}
-	if (GMT > EPH.Header.TR)
+	if (GMT > window.TR)
 	{
 		if (EXTRAP == false) return 16;
-		if (GMT > EPH.Header.TR + 4.0) { return 4; }
+		if (GMT > window.TR + 4.0) { return 4; }
 		else { ERR += 1; }
 	}
 
-	while (GMT > EPH.table[i].GMT)
-	{
-		i++;
-	}
+	i = ELVARYSearch(EPH, window, GMT);
 
 	//Direct hit
 	if (GMT == EPH.table[i].GMT)
@@ -357,13 +411,13 @@ int RTCC::ELVARY(EphemerisDataTable2 &EPH, unsigned ORER, double GMT, bool EXTRA
 		DESRI = ORER / 2;
 	}
 
-	if (i < DESLEF + EPH.Header.Offset)
+	if (i < DESLEF + window.Offset)
 	{
-		i = EPH.Header.Offset;
+		i = window.Offset;
 	}
-	else if (i > EPH.Header.Offset + EPH.Header.NumVec - DESRI)
+	else if (i > window.Offset + window.NumVec - DESRI)
 	{
-		i = EPH.Header.Offset + EPH.Header.NumVec - ORER - 1;
+		i = window.Offset + window.NumVec - ORER - 1;
 	}
 	else
 	{
@@ -740,7 +794,7 @@ void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out)
 	ELVCTR(in, out, EPHEM, MANTIMES, &LUNSTAY);
 }
 
-void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, EphemerisDataTable2 &EPH, ManeuverTimesTable &mantimes, LunarStayTimesTable *LUNRSTAY)
+void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, const EphemerisDataTable2 &EPH, ManeuverTimesTable &mantimes, LunarStayTimesTable *LUNRSTAY)
 {
 	//Is order of interpolation correct?
 	if (in.ORER == 0 || in.ORER > 8)
@@ -749,9 +803,8 @@ void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, Ephemeris
 		return;
 	}
 
-	unsigned nvec = 0;
-	double TS_stored = 0, TE_stored = 0;
-	bool restore = false;
+	//Part of the ephemeris ELVARY interpolates in, the ephemeris itself is left alone
+	EphemerisHeader window = EPH.Header;
 	unsigned ORER = in.ORER;
 	int I;
 	out.VPI = 0;
@@ -780,46 +833,39 @@ void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, Ephemeris
 	{
 		double TS = EPH.Header.TL;
 		double TE = EPH.Header.TR;
-		unsigned J = 0;
-		for (J = 0;J < mantimes.Table.size();J++)
+		unsigned J = ManeuverTimesLowerBound(mantimes, in.GMT);
+		if (J < mantimes.Table.size())
 		{
 			//Equal to maneuver initiate time, go directly to 5A
 			if (mantimes.Table[J].ManData[1] == in.GMT)
 			{
 				goto RTCC_ELVCTR_5A;
 			}
-			else if (mantimes.Table[J].ManData[1] > in.GMT)
+			//Equal to maneuver end time, go directly to 5A
+			if (mantimes.Table[J].ManData[0] == in.GMT)
 			{
-				//Equal to maneuver end time, go directly to 5A
-				if (mantimes.Table[J].ManData[0] == in.GMT)
+				goto RTCC_ELVCTR_5A;
+			}
+			//Inside burn
+			if (mantimes.Table[J].ManData[0] < in.GMT)
+			{
+				out.VPI = 1;
+				goto RTCC_ELVCTR_3;
+			}
+			if (J == 0)
+			{
+				//Maneuver outside ephemeris range, let ELVARY handle the error
+				if (mantimes.Table[J].ManData[0] > TE)
 				{
 					goto RTCC_ELVCTR_5A;
 				}
-				//Inside burn
-				if (mantimes.Table[J].ManData[0] < in.GMT)
-				{
-					out.VPI = 1;
-					goto RTCC_ELVCTR_3;
-				}
-				if (J == 0)
-				{
-					//Maneuver outside ephemeris range, let ELVARY handle the error
-					if (mantimes.Table[J].ManData[0] > TE)
-					{
-						goto RTCC_ELVCTR_5A;
-					}
-					//Constrain ephemeris end to begin of first maneuver
-					TE = mantimes.Table[J].ManData[0];
-					goto RTCC_ELVCTR_H;
-				}
-				else
-				{
-					if (mantimes.Table[J].ManData[0] < TE)
-					{
-						TE = mantimes.Table[J].ManData[0];
-					}
-					break;
-				}
+				//Constrain ephemeris end to begin of first maneuver
+				TE = mantimes.Table[J].ManData[0];
+				goto RTCC_ELVCTR_H;
+			}
+			if (mantimes.Table[J].ManData[0] < TE)
+			{
+				TE = mantimes.Table[J].ManData[0];
 			}
 		}
 		//Constrain ephemeris start to end of previous maneuver
@@ -830,62 +876,397 @@ void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, Ephemeris
 		goto RTCC_ELVCTR_H;
 	RTCC_ELVCTR_3:
 		ORER = 1;
-		unsigned E = 0;
-		while (EPH.table[E].GMT <= in.GMT)
+		unsigned E = EphemerisLowerBound(EPH.table, 0, in.GMT);
+		//Direct hit
+		if (EPH.table[E].GMT == in.GMT)
 		{
-			//Direct hit
-			if (EPH.table[E].GMT == in.GMT)
-			{
-				goto RTCC_ELVCTR_5A;
-			}
-			E++;
+			goto RTCC_ELVCTR_5A;
 		}
 		TE = EPH.table[E].GMT;
 		TS = EPH.table[E - 1].GMT;
 	RTCC_ELVCTR_H:
-		unsigned V = 0;
-		while (TS >= EPH.table[V].GMT)
+		unsigned V = EphemerisLowerBound(EPH.table, 0, TS);
+		if (V < EPH.table.size() && TS == EPH.table[V].GMT)
 		{
-			if (TS == EPH.table[V].GMT)
-			{
-				goto RTCC_ELVCTR_4;
-			}
-			V++;
+			goto RTCC_ELVCTR_4;
 		}
 		out.ErrorCode = 255;
 		return;
 	RTCC_ELVCTR_4:
-		//Save stuff
-		restore = true;
-		nvec = EPH.Header.NumVec;
-		TS_stored = EPH.Header.TL;
-		TE_stored = EPH.Header.TR;
-		unsigned NV = 1;
-		while (abs (TE - EPH.table[NV - 1].GMT) > 0.000001) //To avoid floating point issues
-		{
-			if (TE < EPH.table[NV - 1].GMT)
+		//First vector within the tolerance of TE, to avoid floating point issues
+		unsigned LO = 0, HI = EPH.table.size(), temp;
+		while (LO < HI)
+		{
+			temp = (LO + HI) / 2;
+			if (TE - EPH.table[temp].GMT > 0.000001)
 			{
-				out.ErrorCode = 255;
-				return;
+				LO = temp + 1;
+			}
+			else
+			{
+				HI = temp;
 			}
-			NV++;
 		}
-		EPH.Header.NumVec = NV - V;
-		EPH.Header.Offset = V;
-		EPH.Header.TL = TS;
-		EPH.Header.TR = TE;
+		//Passed TE without a vector at TE
+		if (LO == EPH.table.size() || abs(TE - EPH.table[LO].GMT) > 0.000001)
+		{
+			out.ErrorCode = 255;
+			return;
+		}
+		unsigned NV = LO + 1;
+		window.NumVec = NV - V;
+		window.Offset = V;
+		window.TL = TS;
+		window.TR = TE;
 	}
 
 RTCC_ELVCTR_5A:
-	out.ErrorCode = ELVARY(EPH, ORER, in.GMT, false, out.SV, out.ORER);
-	if (restore)
+	out.ErrorCode = ELVARY(EPH, window, ORER, in.GMT, false, out.SV, out.ORER);
+	return;
+}
+
+//Times interpolated together in one block of a batch
+static const unsigned ELVCTR_BLOCK = 64;
+
+//Index of the first time at or after GMT, starting at index I
+static unsigned TimesLowerBound(const std::vector<double> &t, unsigned I, double GMT)
+{
+	unsigned LO = I, HI = t.size(), temp;
+
+	while (LO < HI)
 	{
-		EPH.Header.NumVec = nvec;
-		EPH.Header.Offset = 0;
-		EPH.Header.TL = TS_stored;
-		EPH.Header.TR = TE_stored;
+		temp = (LO + HI) / 2;
+		if (GMT > t[temp])
+		{
+			LO = temp + 1;
+		}
+		else
+		{
+			HI = temp;
+		}
+	}
+	return LO;
+}
+
+//Interpolation window of one time in a batch, with the same checks as ELVCTR and ELVARY. Returns true if the state vector has to be interpolated from vector I on,
+//otherwise the output is complete. Cursor is the vector found for the previous time
+static bool ELVCTRBatchWindow(const EphemerisInterpolationTable &tab, double GMT, unsigned ORER, unsigned &cursor, ELVCTROutputTable2 &out, unsigned &I)
+{
+	unsigned Offset = tab.Header.Offset, NumVec = tab.Header.NumVec, size = tab.GMT.size();
+	double TL = tab.Header.TL, TR = tab.Header.TR;
+	unsigned DESLEF, DESRI, i;
+
+	out.SV = EphemerisData2();
+	out.VPI = 0;
+	out.TUP = tab.Header.TUP;
+	out.ORER = ORER;
+	out.ErrorCode = 0;
+
+	if (ORER == 0 || ORER > 8)
+	{
+		out.ErrorCode = 64;
+		return false;
+	}
+	if (size == 0)
+	{
+		out.ErrorCode = 128;
+		return false;
+	}
+	if (GMT < tab.GMT.front())
+	{
+		out.ErrorCode = 8;
+		return false;
+	}
+	if (GMT > tab.GMT.back())
+	{
+		out.ErrorCode = 16;
+		return false;
+	}
+	if (tab.LunarStay && GMT >= tab.LUNRSTAY.LunarStayBeginGMT && GMT <= tab.LUNRSTAY.LunarStayEndGMT)
+	{
+		out.VPI = -1;
+	}
+
+	//Constrain the ephemeris to the free flight around GMT, or to the vectors around it during a maneuver
+	if (tab.MANTIMES.Table.size() > 0)
+	{
+		const std::vector<MANTIMESData> &man = tab.MANTIMES.Table;
+		double TS = TL, TE = TR;
+		unsigned J = ManeuverTimesLowerBound(tab.MANTIMES, GMT);
+		bool window = true;
+
+		if (J < man.size() && (man[J].ManData[1] == GMT || man[J].ManData[0] == GMT))
+		{
+			window = false;
+		}
+		else if (J < man.size() && man[J].ManData[0] < GMT)
+		{
+			//Inside burn
+			out.VPI = 1;
+			ORER = 1;
+			unsigned E = TimesLowerBound(tab.GMT, 0, GMT);
+			if (tab.GMT[E] == GMT)
+			{
+				window = false;
+			}
+			else
+			{
+				TE = tab.GMT[E];
+				TS = tab.GMT[E - 1];
+			}
+		}
+		else if (J == 0)
+		{
+			//Maneuver outside ephemeris range, ELVARY handles the error
+			if (man[J].ManData[0] > TE)
+			{
+				window = false;
+			}
+			else
+			{
+				TE = man[J].ManData[0];
+			}
+		}
+		else
+		{
+			if (J < man.size() && man[J].ManData[0] < TE)
+			{
+				TE = man[J].ManData[0];
+			}
+			if (man[J - 1].ManData[1] > TS)
+			{
+				TS = man[J - 1].ManData[1];
+			}
+		}
+
+		if (window)
+		{
+			unsigned V = TimesLowerBound(tab.GMT, 0, TS);
+			if (V == size || tab.GMT[V] != TS)
+			{
+				out.ErrorCode = 255;
+				return false;
+			}
+			unsigned LO = 0, HI = size, temp;
+			while (LO < HI)
+			{
+				temp = (LO + HI) / 2;
+				if (TE - tab.GMT[temp] > 0.000001)
+				{
+					LO = temp + 1;
+				}
+				else
+				{
+					HI = temp;
+				}
+			}
+			if (LO == size || abs(TE - tab.GMT[LO]) > 0.000001)
+			{
+				out.ErrorCode = 255;
+				return false;
+			}
+			Offset = V;
+			NumVec = LO + 1 - V;
+			TL = TS;
+			TR = TE;
+		}
+	}
+
+	//ELVARY
+	if (NumVec < 2)
+	{
+		out.ErrorCode = 128;
+		return false;
+	}
+	if (NumVec <= ORER)
+	{
+		out.ErrorCode += 2;
+		ORER = NumVec - 1;
+	}
+	out.ORER = ORER;
+	if (GMT < TL)
+	{
+		out.ErrorCode = 32;
+		return false;
+	}
+	if (GMT > TR)
+	{
+		out.ErrorCode = 16;
+		return false;
+	}
+
+	if (cursor >= Offset && cursor < size && GMT <= tab.GMT[cursor] && (cursor == Offset || GMT > tab.GMT[cursor - 1]))
+	{
+		i = cursor;
+	}
+	else
+	{
+		i = TimesLowerBound(tab.GMT, Offset, GMT);
+		cursor = i;
+	}
+
+	//Direct hit
+	if (GMT == tab.GMT[i])
+	{
+		out.SV.GMT = tab.GMT[i];
+		out.SV.R = _V(tab.R[0][i], tab.R[1][i], tab.R[2][i]);
+		out.SV.V = _V(tab.V[0][i], tab.V[1][i], tab.V[2][i]);
+		return false;
+	}
+
+	if (ORER % 2)
+	{
+		DESLEF = DESRI = (ORER + 1) / 2;
+	}
+	else
+	{
+		DESLEF = ORER / 2 + 1;
+		DESRI = ORER / 2;
+	}
+
+	if (i < DESLEF + Offset)
+	{
+		I = Offset;
+	}
+	else if (i > Offset + NumVec - DESRI)
+	{
+		I = Offset + NumVec - ORER - 1;
+	}
+	else
+	{
+		I = i - DESLEF;
+	}
+	return true;
+}
+
+//Lagrange interpolation from vector I on at up to ELVCTR_BLOCK times. The times are the innermost loop, so it vectorises across them,
+//and the operations for each time are the same as in ELVARY
+static void ELVCTRBatchLagrange(const EphemerisInterpolationTable &tab, unsigned I, unsigned ORER, const double *GMT, unsigned n, ELVCTROutputTable2 *out)
+{
+	double TERM3[ELVCTR_BLOCK], RES[6][ELVCTR_BLOCK];
+	double tj, tk, c;
+	unsigned j, k, l, q;
+
+	for (l = 0; l < 6; l++)
+	{
+		for (q = 0; q < n; q++)
+		{
+			RES[l][q] = 0.0;
+		}
+	}
+
+	for (j = 0; j < ORER + 1; j++)
+	{
+		tj = tab.GMT[I + j];
+		for (q = 0; q < n; q++)
+		{
+			TERM3[q] = 1.0;
+		}
+		for (k = 0; k < ORER + 1; k++)
+		{
+			if (k != j)
+			{
+				tk = tab.GMT[I + k];
+				for (q = 0; q < n; q++)
+				{
+					TERM3[q] *= (GMT[q] - tk) / (tj - tk);
+				}
+			}
+		}
+		for (l = 0; l < 3; l++)
+		{
+			c = tab.R[l][I + j];
+			for (q = 0; q < n; q++)
+			{
+				RES[l][q] += c * TERM3[q];
+			}
+			c = tab.V[l][I + j];
+			for (q = 0; q < n; q++)
+			{
+				RES[l + 3][q] += c * TERM3[q];
+			}
+		}
+	}
+
+	for (q = 0; q < n; q++)
+	{
+		out[q].SV.GMT = GMT[q];
+		out[q].SV.R = _V(RES[0][q], RES[1][q], RES[2][q]);
+		out[q].SV.V = _V(RES[3][q], RES[4][q], RES[5][q]);
+	}
+}
+
+void RTCC::ELVCTR(const ELVCTRInputTable &in, ELVCTROutputTable2 &out, const EphemerisInterpolationTable &tab)
+{
+	unsigned cursor = tab.Header.Offset, I;
+
+	if (ELVCTRBatchWindow(tab, in.GMT, in.ORER, cursor, out, I))
+	{
+		ELVCTRBatchLagrange(tab, I, out.ORER, &in.GMT, 1, &out);
+	}
+}
+
+void RTCC::ELVCTR(const std::vector<double> &GMT, unsigned ORER, std::vector<ELVCTROutputTable2> &out, const EphemerisInterpolationTable &tab)
+{
+	unsigned cursor = tab.Header.Offset, I, I_run = 0, ORER_run = 0, n = 0, q;
+	bool inter;
+
+	out.resize(GMT.size());
+
+	//Times interpolated from the same vectors are collected into blocks
+	for (q = 0; q < GMT.size(); q++)
+	{
+		inter = ELVCTRBatchWindow(tab, GMT[q], ORER, cursor, out[q], I);
+
+		if (n > 0 && (inter == false || I != I_run || out[q].ORER != ORER_run || n == ELVCTR_BLOCK))
+		{
+			ELVCTRBatchLagrange(tab, I_run, ORER_run, &GMT[q - n], n, &out[q - n]);
+			n = 0;
+		}
+		if (inter)
+		{
+			if (n == 0)
+			{
+				I_run = I;
+				ORER_run = out[q].ORER;
+			}
+			n++;
+		}
+	}
+	if (n > 0)
+	{
+		ELVCTRBatchLagrange(tab, I_run, ORER_run, &GMT[q - n], n, &out[q - n]);
+	}
+}
+
+void RTCC::ELVCTRLoad(const EphemerisDataTable2 &EPH, const ManeuverTimesTable &mantimes, const LunarStayTimesTable *LUNRSTAY, EphemerisInterpolationTable &tab)
+{
+	unsigned i, l, size = EPH.table.size();
+
+	tab.Header = EPH.Header;
+	tab.MANTIMES = mantimes;
+	tab.LunarStay = (LUNRSTAY != NULL);
+	if (LUNRSTAY)
+	{
+		tab.LUNRSTAY = *LUNRSTAY;
+	}
+
+	tab.GMT.resize(size);
+	for (l = 0; l < 3; l++)
+	{
+		tab.R[l].resize(size);
+		tab.V[l].resize(size);
+	}
+	for (i = 0; i < size; i++)
+	{
+		tab.GMT[i] = EPH.table[i].GMT;
+		tab.R[0][i] = EPH.table[i].R.x;
+		tab.R[1][i] = EPH.table[i].R.y;
+		tab.R[2][i] = EPH.table[i].R.z;
+		tab.V[0][i] = EPH.table[i].V.x;
+		tab.V[1][i] = EPH.table[i].V.y;
+		tab.V[2][i] = EPH.table[i].V.z;
 	}
-	return;
 }
 
 //Fixed point centiseconds to floating point hours
@@ -1998,23 +2379,8 @@ bool RTCC::PLEFEM(int IND, double HOUR, int YEAR, VECTOR3 *R_EM, VECTOR3 *V_EM,
 		HOUR = HOUR + SystemParameters.MCCBES;
 	}
 	//TBD: Convert from universal time to ephemeris time
-	//T is 0 to 1, from last to next 12 hour interval
-	T = (HOUR - floor(HOUR / 12.0) * 12.0) / 12.0;
-	C[0] = -((T + 1.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 120.0;
-	C[1] = ((T + 2.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 24.0;
-	C[2] = -((T + 2.0)*(T + 1.0)*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 12.0;
-	C[3] = ((T + 2.0)*(T + 1.0)*T*(T - 2.0)*(T - 3.0)) / 12.0;
-	C[4] = -((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 3.0)) / 24.0;
-	C[5] = ((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 2.0)) / 120.0;
-
 	//Calculate MJD from GMT
 	double MJD = SystemParameters.GMTBASE + HOUR / 24.0;
-	//Calculate position of time in array
-	i = (int)((MJD - MDGSUN.MJD)*2.0);
-	//Calculate starting point in the array
-	j = i - 2;
-	//Is time contained in Sun/Moon data array?
-	if (j < 0 || j > 65) goto RTCC_PLEFEM_A;
 
 	double x[18];
 	bool des[4] = {false, false, false, false};
@@ -2041,6 +2407,27 @@ bool RTCC::PLEFEM(int IND, double HOUR, int YEAR, VECTOR3 *R_EM, VECTOR3 *V_EM,
 		goto RTCC_PLEFEM_A;
 	}
 
+	//T is 0 to 1, from last to next 12 hour interval
+	T = (HOUR - floor(HOUR / 12.0) * 12.0) / 12.0;
+	C[0] = -((T + 1.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 120.0;
+	C[1] = ((T + 2.0)*T*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 24.0;
+	C[2] = -((T + 2.0)*(T + 1.0)*(T - 1.0)*(T - 2.0)*(T - 3.0)) / 12.0;
+	C[3] = ((T + 2.0)*(T + 1.0)*T*(T - 2.0)*(T - 3.0)) / 12.0;
+	C[4] = -((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 3.0)) / 24.0;
+	C[5] = ((T + 2.0)*(T + 1.0)*T*(T - 1.0)*(T - 2.0)) / 120.0;
+
+	//Calculate position of time in array
+	i = (int)((MJD - MDGSUN.MJD)*2.0);
+	//Calculate starting point in the array
+	j = i - 2;
+	//Is time contained in Sun/Moon data array?
+	if (j < 0 || j > 65)
+	{
+		//Chebyshev ephemeris extends the span of the array
+		if (MDGCHEB.Evaluate(MJD, des, x)) goto RTCC_PLEFEM_B;
+		goto RTCC_PLEFEM_A;
+	}
+
 	for (k = 0;k < 18;k++)
 	{
 		if (k < 3)
@@ -2065,6 +2452,7 @@ bool RTCC::PLEFEM(int IND, double HOUR, int YEAR, VECTOR3 *R_EM, VECTOR3 *V_EM,
 		}
 		x[k] = C[0] * MDGSUN.data[j][k] + C[1] * MDGSUN.data[j + 1][k] + C[2] * MDGSUN.data[j + 2][k] + C[3] * MDGSUN.data[j + 3][k] + C[4] * MDGSUN.data[j + 4][k] + C[5] * MDGSUN.data[j + 5][k];
 	}
+RTCC_PLEFEM_B:
 	if (des[0] && R_ES)
 	{
 		*R_ES = _V(x[0], x[1], x[2])*OrbMech::R_Earth;
@@ -26,6 +26,10 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "orbitersdk.h"
 #include <stdio.h>
+#include <emmintrin.h>
+#include <vector>
+#include <map>
+#include <string>
 
 #include "nasspdefs.h"
 
@@ -51,6 +55,8 @@ FDAI::FDAI() {
 	lastPaintAtt = _V(0, 0, 0);
 
 	lastPaintTime = -1;
+	ballPixels = 0;
+	ballTexture = 0;
 	LM_FDAI = false;
 	DCSource = NULL;
 	ACSource = NULL;
@@ -63,117 +69,139 @@ void FDAI::Init(VESSEL *v)
 	vessel = v;
 }
 
-void FDAI::InitGL() {
+//
+// The ball is rendered in software. Camera, sphere and lighting never change, so the sphere
+// normal and lighting of every pixel are worked out once and shared by all FDAIs. Drawing a
+// new attitude then only needs one rotation and a texture lookup per pixel. The normals are
+// kept as separate x/y/z arrays padded to a multiple of four, so the rotation can be done with
+// SSE2 four pixels at a time.
+//
+
+#define FDAI_BALL_SIZE			180			///< Size of the rendered ball bitmap in pixels.
+#define FDAI_BALL_LOOKUP_SIZE	1024		///< Number of entries in the texture coordinate tables.
+#define FDAI_BALL_PIXEL_ANGLE	0.0125		///< Rotation moving the centre of the ball by about one pixel.
+
+struct FDAIBallTexture
+{
+	int width;
+	int height;
+	std::vector<DWORD> texels;
+};
+
+static bool BallTablesBuilt = false;
+static std::vector<float> BallNX, BallNY, BallNZ;
+static std::vector<float> BallPX, BallPY;		///< Rotated normals of the last render, only used by RenderBall.
+static std::vector<int> BallZIndex;
+static std::vector<int> BallOffset;
+static std::vector<unsigned int> BallShade;
+static float BallAtanTable[FDAI_BALL_LOOKUP_SIZE + 1];
+static float BallTTable[FDAI_BALL_LOOKUP_SIZE + 1];
+static std::map<std::string, FDAIBallTexture> BallTextures;
+
+static void BuildBallTables()
+
+{
+	if (BallTablesBuilt)
+		return;
+
+	//
+	// Same view as the old OpenGL renderer: a sphere of radius 12 seen from 35 units away
+	// with a 45 degree field of view, lit by a directional light from the upper left.
+	//
+
+	const double tanHalfFov = tan(22.5 * RAD);
+	const double radius = 12.0;
+	const VECTOR3 centre = _V(0.0, 0.0, -35.0);
+	const VECTOR3 light = unit(_V(-10.0, 10.0, 10.0));
+	const VECTOR3 half = unit(light + _V(0.0, 0.0, 1.0));
+
+	for (int sy = 0; sy < FDAI_BALL_SIZE; sy++) {
+		for (int sx = 0; sx < FDAI_BALL_SIZE; sx++) {
+			VECTOR3 d = unit(_V(((sx + 0.5) / (FDAI_BALL_SIZE / 2) - 1.0) * tanHalfFov, (1.0 - (sy + 0.5) / (FDAI_BALL_SIZE / 2)) * tanHalfFov, -1.0));
+			double b = dotp(d, centre);
+			double disc = b * b - dotp(centre, centre) + radius * radius;
+			if (disc < 0)
+				continue;
+
+			VECTOR3 n = (d * (b - sqrt(disc)) - centre) / radius;
+
+			// Ambient, diffuse and specular terms of the old OpenGL material and light
+			double ndotl = dotp(n, light);
+			double shade = 0.24;
+			if (ndotl > 0)
+				shade += 0.8 * ndotl + 0.25 * pow(max(dotp(n, half), 0.0), 5);
+
+			// The camera looks along +y with +z up
+			BallNX.push_back((float)n.x);
+			BallNY.push_back((float)-n.z);
+			BallNZ.push_back((float)n.y);
+			BallOffset.push_back(sy * FDAI_BALL_SIZE + sx);
+			BallShade.push_back((unsigned int)(min(shade, 1.0) * 256.0));
+		}
+	}
+
+	// Padding for the SSE2 rotation, these are never drawn
+	while (BallNX.size() % 4) {
+		BallNX.push_back(0.0f);
+		BallNY.push_back(0.0f);
+		BallNZ.push_back(0.0f);
+	}
+	BallPX.resize(BallNX.size());
+	BallPY.resize(BallNX.size());
+	BallZIndex.resize(BallNX.size());
+
+	for (int i = 0; i <= FDAI_BALL_LOOKUP_SIZE; i++) {
+		BallAtanTable[i] = (float)atan((double)i / FDAI_BALL_LOOKUP_SIZE);
+		BallTTable[i] = (float)(1.0 - acos(2.0 * i / FDAI_BALL_LOOKUP_SIZE - 1.0) / PI);
+	}
+
+	BallTablesBuilt = true;
+}
+
+void FDAI::InitBall() {
+
+	BuildBallTables();
 
-	GLuint      PixelFormat;
-	BITMAPINFOHEADER BIH;
-	int iSize = sizeof(BITMAPINFOHEADER);
-	BIH.biSize = iSize;
-	BIH.biWidth = 180;				//size of the sphere is 180x180
-	BIH.biHeight = 180;
-	BIH.biPlanes = 1;
-	BIH.biBitCount = 16;//default is 16.
-	BIH.biCompression = BI_RGB;
-	BIH.biSizeImage = 0;
-	void* m_pBits;
-	hDC2 = CreateCompatibleDC(NULL);//we make a new DC and DIbitmap for OpenGL to draw onto
-	static  PIXELFORMATDESCRIPTOR pfd2;
-	DescribePixelFormat(hDC2, 1, sizeof(PIXELFORMATDESCRIPTOR), &pfd2);//just get a random pixel format.. 
-	BIH.biBitCount = pfd2.cColorBits;//to get the current bit depth.. !?
-	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &m_pBits, NULL, 0);
-	hBMP_old = (HBITMAP)SelectObject(hDC2, hBMP);
-	static  PIXELFORMATDESCRIPTOR pfd = {                             // pfd Tells Windows How We Want Things To Be
-		sizeof(PIXELFORMATDESCRIPTOR),                              // Size Of This Pixel Format Descriptor
-		1,                                                          // Version Number
-		PFD_DRAW_TO_BITMAP |                                        // Format Must Support Bitmap Rendering
-		PFD_SUPPORT_OPENGL |
-		PFD_SUPPORT_GDI,											// Format Must Support OpenGL,                                           
-		0,//        PFD_TYPE_RGBA,                                              // Request An RGBA Format
-		16,															// Select Our Color Depth
-		0, 0, 0, 0, 0, 0,                                           // Color Bits Ignored
-		0,//1,                                                          // No Alpha Buffer
-		0,                                                          // Shift Bit Ignored
-		0,                                                          // No Accumulation Buffer
-		0, 0, 0, 0,                                                 // Accumulation Bits Ignored
-		0,//16,                                                         // 16Bit Z-Buffer (Depth Buffer)  
-		0,                                                          // No Stencil Buffer
-		0,                                                          // No Auxiliary Buffer
-		0,//PFD_MAIN_PLANE,                                             // Main Drawing Layer
-		0,                                                          // Reserved
-		0, 0, 0                                                     // Layer Masks Ignored
-	};
-	pfd.cColorBits = pfd2.cColorBits;//same color depth needed.
-	DWORD code;
-	code = GetLastError();
-	PixelFormat = ChoosePixelFormat(hDC2, &pfd);// now pretend we want a new format
-	int ret;
-	ret = SetPixelFormat(hDC2, PixelFormat, &pfd);
-	code = GetLastError();
-	hRC = wglCreateContext(hDC2);
-	ret = wglMakeCurrent(hDC2, hRC);				//all standard OpenGL init so far
-
-	//We load the texture
-	int texture_index;
 	if (LM_FDAI)
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
+		ballTexture = LoadBallTexture("Textures\\ProjectApollo\\FDAI_Ball_LM.dds");
 	}
 	else
 	{
-		texture_index = LoadOGLBitmap("Textures\\ProjectApollo\\FDAI_Ball.dds");
-	}
-	if (texture_index > 0) glEnable(GL_TEXTURE_2D);
-
-	glShadeModel(GL_SMOOTH);                        // Enable Smooth Shading
-	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);           // Panel Background color
-	glClearDepth(1.0f);                             // Depth Buffer Setup
-	glEnable(GL_DEPTH_TEST);                        // Enables Depth Testing
-	glDepthFunc(GL_LESS);                           // The Type Of Depth Testing To Do
-	glViewport(0, 0, 180, 180);                     // Reset The Current Viewport
-	glMatrixMode(GL_PROJECTION);                    // Select The Projection Matrix
-	glLoadIdentity();                               // Reset The Projection Matrix
-	gluPerspective(45.0f, 1.0, 1.0f, 1000.0f);
-	glMatrixMode(GL_MODELVIEW);                     // Select The Modelview Matrix          
-	glLoadIdentity();                               // Reset The Projection Matrix
-
-	//some ambiental setup
-	GLfloat light_position[] = { -10.0,10.0,10.0,0.0 };
-	GLfloat light_diffuse[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat light_ambient[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	GLfloat mat_specular[] = { (float) 0.5, (float) 0.5, (float) 0.5, 1.0 };
-	GLfloat mat_shin[] = { 5.0 };
-	glMaterialfv(GL_FRONT, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHTING);
-	glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
-	glLightfv(GL_LIGHT0, GL_POSITION, light_position);
-	glLightfv(GL_LIGHT0, GL_AMBIENT, light_ambient);
-	glLightfv(GL_LIGHT0, GL_SPECULAR, mat_specular);
-	glEnable(GL_LIGHT0);
-
-	//defining our geometry and composing a display list;
-	list_name = glGenLists(1);
-	glNewList(list_name, GL_COMPILE);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);             // Clear The Screen And The Depth Buffer        
-	glColor3f(1.0, 1.0, 1.0);
-	quadObj = gluNewQuadric();
-	gluQuadricTexture(quadObj, GL_TRUE);
-	gluSphere(quadObj, 12, 24, 24);
-	glEndList();
-
-	init = 1;		//that's it. If we made it so far, we can use OpenGL
+		ballTexture = LoadBallTexture("Textures\\ProjectApollo\\FDAI_Ball.dds");
+	}
+
+	//
+	// Top-down 32 bit DIB we render into and blit onto the panel from.
+	//
+
+	BITMAPINFOHEADER BIH;
+	memset(&BIH, 0, sizeof(BIH));
+	BIH.biSize = sizeof(BITMAPINFOHEADER);
+	BIH.biWidth = FDAI_BALL_SIZE;
+	BIH.biHeight = -FDAI_BALL_SIZE;
+	BIH.biPlanes = 1;
+	BIH.biBitCount = 32;
+	BIH.biCompression = BI_RGB;
+
+	void *bits = 0;
+	hDC2 = CreateCompatibleDC(NULL);
+	hBMP = CreateDIBSection(hDC2, (BITMAPINFO*)&BIH, DIB_RGB_COLORS, &bits, NULL, 0);
+	hBMP_old = (HBITMAP)SelectObject(hDC2, hBMP);
+	ballPixels = (DWORD *)bits;
+	memset(ballPixels, 0, FDAI_BALL_SIZE * FDAI_BALL_SIZE * sizeof(DWORD));
+
+	init = 1;
 }
 
 FDAI::~FDAI() {
 
 	if (init) {
-		gluDeleteQuadric(quadObj);
-		wglMakeCurrent(NULL, NULL);	//standard OpenGL release
-		BOOL ret = wglDeleteContext(hRC);
-		hRC = NULL;
 		SelectObject(hDC2, hBMP_old);//remember to delete DC and bitmap memory we created
 		DeleteObject(hBMP);
 		DeleteDC(hDC2);
 		hDC2 = 0;
+		ballPixels = 0;
 	}
 }
 
@@ -266,33 +294,107 @@ void FDAI::RotateBall(double simdt) {
 		now.x += delta;
 }
 
-void FDAI::MoveBall2D()
-{
-	glLoadIdentity();
-	gluLookAt(0.0, -35.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
-
-	glRotatef(90.0, 0.0, 1.0, 0.0);
+void FDAI::RenderBall()
 
-	glRotated(now.y / PI * 180.0, 0.0, 1.0, 0.0);	//attitude.x
-	glRotated(now.x / PI * 180.0, 1.0, 0.0, 0.0);	//attitude.z
-	glRotated(now.z / PI * 180.0, 0.0, 0.0, 1.0);	//attitude.y
+{
+	//
+	// Ball to panel rotation, as glRotate about y by 90 degrees plus roll, then x by yaw,
+	// then z by pitch. We need the transpose to take panel normals back to the ball.
+	//
+
+	double cy = cos(PI05 + now.y), sy = sin(PI05 + now.y);
+	double cx = cos(now.x), sx = sin(now.x);
+	double cz = cos(now.z), sz = sin(now.z);
+
+	float r11 = (float)(cy * cz + sy * sx * sz), r12 = (float)(-cy * sz + sy * sx * cz), r13 = (float)(sy * cx);
+	float r21 = (float)(cx * sz), r22 = (float)(cx * cz), r23 = (float)(-sx);
+	float r31 = (float)(-sy * cz + cy * sx * sz), r32 = (float)(sy * sz + cy * sx * cz), r33 = (float)(cy * cx);
+
+	const float *nx = &BallNX[0];
+	const float *ny = &BallNY[0];
+	const float *nz = &BallNZ[0];
+	float *rx = &BallPX[0];
+	float *ry = &BallPY[0];
+	int *zIndex = &BallZIndex[0];
+	const int padded = (int)BallNX.size();
+
+	//
+	// First pass: rotate the normals, four pixels at a time. Only x and y are kept, z is only
+	// needed as the index into the t table, which is clamped and converted right away.
+	//
+
+	const __m128 m11 = _mm_set1_ps(r11), m21 = _mm_set1_ps(r21), m31 = _mm_set1_ps(r31);
+	const __m128 m12 = _mm_set1_ps(r12), m22 = _mm_set1_ps(r22), m32 = _mm_set1_ps(r32);
+	const __m128 m13 = _mm_set1_ps(r13), m23 = _mm_set1_ps(r23), m33 = _mm_set1_ps(r33);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 zScale = _mm_set1_ps((float)(FDAI_BALL_LOOKUP_SIZE / 2));
+	const __m128 zMax = _mm_set1_ps((float)FDAI_BALL_LOOKUP_SIZE);
+	const __m128 zero = _mm_setzero_ps();
+
+	for (int i = 0; i < padded; i += 4) {
+		__m128 x = _mm_loadu_ps(nx + i);
+		__m128 y = _mm_loadu_ps(ny + i);
+		__m128 z = _mm_loadu_ps(nz + i);
+
+		__m128 px = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m11, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m31, z));
+		__m128 py = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m12, x), _mm_mul_ps(m22, y)), _mm_mul_ps(m32, z));
+		__m128 pz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m13, x), _mm_mul_ps(m23, y)), _mm_mul_ps(m33, z));
+
+		__m128 zi = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(pz, one), zScale), zero), zMax);
+
+		_mm_storeu_ps(rx + i, px);
+		_mm_storeu_ps(ry + i, py);
+		_mm_storeu_si128((__m128i *)(zIndex + i), _mm_cvttps_epi32(zi));
+	}
 
-	lastPaintAtt = now;
+	//
+	// Second pass: texture lookup. Texture coordinates as generated by gluSphere: s runs once
+	// around the z axis starting from +y, t from the -z pole to the +z pole.
+	//
+
+	const DWORD *texels = &ballTexture->texels[0];
+	const int width = ballTexture->width;
+	const float sScale = (float)(width / PI2);
+	const float tScale = (float)(ballTexture->height - 1);
+	const int count = (int)BallOffset.size();
+
+	for (int i = 0; i < count; i++) {
+		float px = rx[i], py = ry[i];
+		float ax = fabs(px), ay = fabs(py);
+		float phi;
+		if (ax <= ay)
+			phi = (ay > 0.0f) ? BallAtanTable[(int)(ax / ay * FDAI_BALL_LOOKUP_SIZE)] : 0.0f;
+		else
+			phi = (float)PI05 - BallAtanTable[(int)(ay / ax * FDAI_BALL_LOOKUP_SIZE)];
+		if (py < 0.0f)
+			phi = (float)PI - phi;
+		if (px < 0.0f)
+			phi = (float)PI2 - phi;
+
+		int u = width - 1 - (int)(phi * sScale);
+		if (u < 0) u = 0;
+
+		int v = (int)(BallTTable[zIndex[i]] * tScale);
+
+		DWORD c = texels[v * width + u];
+		unsigned int shade = BallShade[i];
+		ballPixels[BallOffset[i]] = (((c & 0xFF00FF) * shade >> 8) & 0xFF00FF) | (((c & 0x00FF00) * shade >> 8) & 0x00FF00);
+	}
 }
 
 void FDAI::PaintMe(VECTOR3 rates, VECTOR3 errors, SURFHANDLE surf, SURFHANDLE hFDAI,
 	SURFHANDLE hFDAIRoll, SURFHANDLE hFDAIOff, SURFHANDLE hFDAINeedles, HBITMAP hBmpRoll, int smooth) {
 
-	if (!init) InitGL();
-
-	// Don't do the OpenGL calculations every timestep
-	if (smooth || lastPaintTime == -1 || ((length(lastPaintAtt - target) > 0.005 || oapiGetSysTime() > lastPaintTime + 2.0) && oapiGetSysTime() > lastPaintTime + 0.1)) {
-		int ret = wglMakeCurrent(hDC2, hRC);
-		MoveBall2D();
-		glCallList(list_name);	//render
-		glFlush();
-		glFinish();
+	if (!init) InitBall();
 
+	//
+	// Only render the ball again once it moved by a pixel, at most ten times a second
+	// unless smooth rendering was selected.
+	//
+	double moved = max(fabs(now.x - lastPaintAtt.x), max(fabs(now.y - lastPaintAtt.y), fabs(now.z - lastPaintAtt.z)));
+	if (lastPaintTime == -1 || (smooth && moved > 0.0) || (moved > FDAI_BALL_PIXEL_ANGLE && oapiGetSysTime() > lastPaintTime + 0.1)) {
+		RenderBall();
+		lastPaintAtt = now;
 		lastPaintTime = oapiGetSysTime();
 	}
 
@@ -459,50 +561,56 @@ void FDAI::SystemTimestep(double simdt) {
 	}
 }
 
-int FDAI::LoadOGLBitmap(char *filename) {
+const FDAIBallTexture *FDAI::LoadBallTexture(char *filename) {
+
+	std::map<std::string, FDAIBallTexture>::iterator it = BallTextures.find(filename);
+	if (it != BallTextures.end())
+		return &it->second;
 
-	unsigned char *l_texture;
-	int l_index, l_index2 = 0;
+	FDAIBallTexture &tex = BallTextures[filename];
 	FILE *file;
 	BITMAPFILEHEADER fileheader;
 	BITMAPINFOHEADER infoheader;
 	RGBTRIPLE rgb;
-	int num_texture = 1; //we only use one OGL texture ,so...
-
-
-	if ((file = fopen(filename, "rb")) == NULL) return (-1);
-	fread(&fileheader, sizeof(fileheader), 1, file);
-	fseek(file, sizeof(fileheader), SEEK_SET);
-	fread(&infoheader, sizeof(infoheader), 1, file);
-
-	l_texture = (byte *)malloc(infoheader.biWidth * infoheader.biHeight * 4);
-	memset(l_texture, 0, infoheader.biWidth * infoheader.biHeight * 4);
 
-	for (l_index = 0; l_index < infoheader.biWidth*infoheader.biHeight; l_index++)
-	{
-		fread(&rgb, sizeof(rgb), 1, file);
+	//
+	// The ball textures are uncompressed 24 bit bitmaps, stored bottom row first like
+	// OpenGL textures.
+	//
+
+	if ((file = fopen(filename, "rb")) != NULL) {
+		fread(&fileheader, sizeof(fileheader), 1, file);
+		fseek(file, sizeof(fileheader), SEEK_SET);
+		fread(&infoheader, sizeof(infoheader), 1, file);
+		fseek(file, fileheader.bfOffBits, SEEK_SET);
+
+		tex.width = infoheader.biWidth;
+		tex.height = abs(infoheader.biHeight);
+		tex.texels.resize(tex.width * tex.height);
+
+		int padding = (4 - (tex.width * 3) % 4) % 4;
+		for (int y = 0; y < tex.height; y++) {
+			for (int x = 0; x < tex.width; x++) {
+				fread(&rgb, sizeof(rgb), 1, file);
+				tex.texels[y * tex.width + x] = (rgb.rgbtRed << 16) | (rgb.rgbtGreen << 8) | rgb.rgbtBlue;
+			}
+			fseek(file, padding, SEEK_CUR);
+		}
 
-		l_texture[l_index2 + 0] = rgb.rgbtRed; // Red component
-		l_texture[l_index2 + 1] = rgb.rgbtGreen; // Green component
-		l_texture[l_index2 + 2] = rgb.rgbtBlue; // Blue component
-		l_texture[l_index2 + 3] = 255; // Alpha value
-		l_index2 += 4; // Go to the next position
+		fclose(file);
 	}
 
-	fclose(file); // Closes the file stream
+	//
+	// Plain white ball if the texture is missing.
+	//
 
-	glBindTexture(GL_TEXTURE_2D, num_texture);
-
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	//glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-	glTexImage2D(GL_TEXTURE_2D, 0, 4, infoheader.biWidth, infoheader.biHeight,
-		0, GL_RGBA, GL_UNSIGNED_BYTE, l_texture);
-	free(l_texture);
+	if (tex.texels.empty()) {
+		tex.width = 1;
+		tex.height = 1;
+		tex.texels.assign(1, 0xFFFFFF);
+	}
 
-	return (num_texture);
+	return &tex;
 }
 
 void DrawTransparentBitmap(HDC hdc, HBITMAP hBitmap, short xStart,
@@ -25,8 +25,7 @@
 /// \bug Avoids bug in VC++
 #pragma once
 
-#include < GL\gl.h >                                
-#include < GL\glu.h >
+struct FDAIBallTexture;
 
 class FDAI {
 
@@ -56,24 +55,23 @@ protected:
 	int ScrY;			//coords on screen
 	int idx;			//index on the panel list 
 	int init;
-	int list_name; //we store the rendering into a display list
 	VECTOR3 now, target, lastRates, lastErrors, lastPaintAtt;
 	double lastPaintTime;
 
-	//some stuff for OpenGL
+	//the ball is rendered into a DIB section
 	HDC hDC2;
-	HGLRC hRC;
 	HBITMAP hBMP;
 	HBITMAP hBMP_old;
-	GLUquadricObj *quadObj;
+	DWORD *ballPixels;
+	const FDAIBallTexture *ballTexture;
 
 	e_object *DCSource, *ACSource;
 	bool noAC;
 
-	void InitGL();
+	void InitBall();
 	void RotateBall(double simdt);
-	void MoveBall2D();
-	int LoadOGLBitmap(char *filename);
+	void RenderBall();
+	static const FDAIBallTexture *LoadBallTexture(char *filename);
 
 	VESSEL *vessel;
 };
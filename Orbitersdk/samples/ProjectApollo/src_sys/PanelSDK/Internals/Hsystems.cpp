@@ -26,6 +26,7 @@
 #include "orbitersdk.h"
 #include <stdio.h>
 #include <math.h>
+#include <ctype.h>
 #include "nasspdefs.h"
 //const float CONST_R=8.31904f/1000.0f;
 //const float TEMP_PRESS_RATIO=0.07;
@@ -66,6 +67,7 @@ ship_system::ship_system()
 
 {
 	List.next=NULL;
+	NameIndexValid = false;
 }
 
 ship_system::~ship_system()
@@ -96,6 +98,8 @@ ship_object* ship_system::AddSystem(ship_object *object)
 	while (runner->next) runner=runner->next;
 	runner->next=object;
 	object->next=NULL;
+	if (NameIndexValid)
+		NameIndex.emplace(NameKey(object->name), object);
 	return object;
 }
 
@@ -106,6 +110,7 @@ void ship_system::DeleteSystem(ship_object *object)
 	while ((object!=runner->next)&&(runner->next)) runner=runner->next;
 	if (object==runner->next) {
 		runner->next=object->next;
+		NameIndexValid = false;
 		BroadcastDemision(object);
 		if (object->deletable)
 			 delete object;
@@ -128,12 +133,47 @@ void ship_system::Refresh(double dt)
 				 runner=runner->next;}
 };
 
+std::string ship_system::NameKey(const char *r_name)
+{
+	std::string key(r_name);
+	for (size_t i = 0; i < key.size(); i++)
+		key[i] = (char)tolower((unsigned char)key[i]);
+	return key;
+}
+
+void ship_system::BuildNameIndex()
+{
+	NameIndex.clear();
+	ship_object *runner = List.next;
+	while (runner) {
+		// First match wins, same as the old list walk
+		NameIndex.emplace(NameKey(runner->name), runner);
+		runner = runner->next;
+	}
+	NameIndexValid = true;
+}
+
 ship_object* ship_system::GetSystemByName(char *r_name)
-{ship_object *runner;
- runner=List.next;
- while (runner){ if (!stricmp (runner->name, r_name)) return runner;
-				 runner=runner->next;}
-return NULL;
+{
+	if (!NameIndexValid) BuildNameIndex();
+
+	std::unordered_map<std::string, ship_object*>::iterator it = NameIndex.find(NameKey(r_name));
+	if (it != NameIndex.end() && !stricmp(it->second->name, r_name))
+		return it->second;
+
+	//
+	// Objects renamed after they were added won't be in the index, so fall back to
+	// the list and re-index if we find it that way.
+	//
+	ship_object *runner = List.next;
+	while (runner) {
+		if (!stricmp(runner->name, r_name)) {
+			BuildNameIndex();
+			return runner;
+		}
+		runner = runner->next;
+	}
+	return NULL;
 };
 void ship_system::SetMaxStage(char *name, int stage)
 {
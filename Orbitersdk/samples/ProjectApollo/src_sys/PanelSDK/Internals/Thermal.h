@@ -30,6 +30,9 @@
 #pragma include_alias( <fstream.h>, <fstream> )
 #include "orbitersdk.h"
 
+#include <string>
+#include <unordered_map>
+
 class therm_obj			//thermal object.an object that can receive thermal energy
 { public:
 
@@ -164,5 +167,16 @@ class ship_system
 	virtual void Load (FILEHANDLE scn)=0;
 	virtual void Save (FILEHANDLE scn)=0;
 	virtual void Build()=0;
+
+protected:
+	///
+	/// Case-insensitive name to object index, so scenario loading and config parsing
+	/// don't have to walk the whole object list for every line.
+	///
+	std::unordered_map<std::string, ship_object*> NameIndex;
+	bool NameIndexValid;
+
+	void BuildNameIndex();
+	static std::string NameKey(const char *r_name);
 };
 #endif
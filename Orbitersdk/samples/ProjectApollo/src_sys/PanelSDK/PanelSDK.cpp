@@ -197,6 +197,7 @@ void PanelSDK::Load(FILEHANDLE scn) {
 
 	// check version 
 	dontLoad = true;
+	buffer[0] = 0;
 	oapiReadScenario_nextline (scn, line);
     if (!strnicmp (line, "<VERSION>", 9)) {
 		sscanf(line + 9, "%s", buffer);
@@ -206,6 +207,9 @@ void PanelSDK::Load(FILEHANDLE scn) {
 
 	oapiReadScenario_nextline (scn, line);
 	if (dontLoad) {
+		char logbuf[256];
+		sprintf(logbuf, "(PanelSDK) Saved state version %s doesn't match %s, using default systems state.", buffer[0] ? buffer : "(none)", PANELSDK_VERSION);
+		oapiWriteLog(logbuf);
 		while (strnicmp(line,"</INTERNALS>",12)) {
 			oapiReadScenario_nextline (scn, line);
 		}
@@ -225,6 +229,10 @@ void PanelSDK::Load(FILEHANDLE scn) {
 	}
 }
 
+//
+// The state stays one text line per object. Each object reads and writes its own line, and Load
+// finds the object by name through the system's name index, so loading is no longer a list walk per line.
+//
 void PanelSDK::Save(FILEHANDLE scn) {
 
 	oapiWriteScenario_string(scn, "<INTERNALS>","");
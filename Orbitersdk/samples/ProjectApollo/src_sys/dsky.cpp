@@ -759,6 +759,56 @@ void DSKY::RenderData(SURFHANDLE surf, SURFHANDLE digits, SURFHANDLE disp, int x
 	RenderSixDigitDisplay(surf, digits, 1 + xOffset, 151 + yOffset, R3, ELOff);
 }
 
+bool DSKY::DataChanged(int area)
+
+{
+	//
+	// Everything RenderData() draws from: the digit strings and the flags
+	// which blank or light parts of the display.
+	//
+
+	char State[28];
+
+	memcpy(State, Prog, 2);
+	memcpy(State + 2, Verb, 2);
+	memcpy(State + 4, Noun, 2);
+	memcpy(State + 6, R1, 6);
+	memcpy(State + 12, R2, 6);
+	memcpy(State + 18, R3, 6);
+	State[24] = (IsPowered() && !ELOff) ? '1' : '0';
+	State[25] = CompActy ? '1' : '0';
+	State[26] = VerbFlashing ? '1' : '0';
+	State[27] = NounFlashing ? '1' : '0';
+
+	std::string &Drawn = DrawnData[area];
+	if (Drawn.size() == sizeof(State) && !Drawn.compare(0, sizeof(State), State, sizeof(State)))
+		return false;
+
+	Drawn.assign(State, sizeof(State));
+	return true;
+}
+
+bool DSKY::LightsChanged(int area)
+
+{
+	unsigned State = 0;
+
+	if (IsPowered()) {
+		State = 1 |
+			(UplinkLit() << 1) | (NoAttLit() << 2) | (StbyLit() << 3) | (KbRelLit() << 4) |
+			(OprErrLit() << 5) | (TempLit() << 6) | (GimbalLockLit() << 7) | (ProgLit() << 8) |
+			(RestartLit() << 9) | (TrackerLit() << 10) | (AltLit() << 11) | (VelLit() << 12) |
+			(PrioDispLit() << 13) | (NoDAPLit() << 14);
+	}
+
+	std::unordered_map<int, unsigned>::iterator it = DrawnLights.find(area);
+	if (it != DrawnLights.end() && it->second == State)
+		return false;
+
+	DrawnLights[area] = State;
+	return true;
+}
+
 void DSKY::RenderKeys(SURFHANDLE surf, SURFHANDLE keys, int xOffset, int yOffset)
 
 {
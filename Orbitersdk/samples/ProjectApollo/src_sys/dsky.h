@@ -33,6 +33,9 @@
 #include "toggleswitch.h"
 #include "apolloguidance.h"
 
+#include <string>
+#include <unordered_map>
+
 class DSKY : public e_object
 
 {
@@ -148,6 +151,20 @@ public:
 	void RenderLights(SURFHANDLE surf, SURFHANDLE lights, int xoffset = 0, int yoffset = 0, bool hasAltVel = true, bool hasDAPPrioDisp = false);
 	void RenderData(SURFHANDLE surf, SURFHANDLE digits, SURFHANDLE disp, int xoffset = 0, int yoffset = 0);
 	void RenderKeys(SURFHANDLE surf, SURFHANDLE keys, int xoffset = 0, int yoffset = 0);
+
+	///
+	/// \brief Check whether the register display differs from what was last drawn into a panel area.
+	/// \param area Panel area ID the display is drawn into.
+	/// \return True if the area has to be redrawn.
+	///
+	bool DataChanged(int area);
+
+	///
+	/// \brief Check whether the status lights differ from what was last drawn into a panel area.
+	/// \param area Panel area ID the lights are drawn into.
+	/// \return True if the area has to be redrawn.
+	///
+	bool LightsChanged(int area);
 	void ProcessChannel10(ChannelValue val);
 	void ProcessChannel13(ChannelValue val);
 	void ProcessChannel11Bit(int bit, bool val);
@@ -271,6 +288,13 @@ protected:
 	bool FirstTimeStep;
 	RotationalSwitch *DimmerRotationalSwitch;
 
+	//
+	// Display and light state last drawn into each panel area.
+	//
+
+	std::unordered_map<int, std::string> DrawnData;
+	std::unordered_map<int, unsigned> DrawnLights;
+
 	//
 	// Local helper functions.
 	//
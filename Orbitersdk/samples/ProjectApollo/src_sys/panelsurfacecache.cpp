@@ -0,0 +1,79 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+Panel Surface Cache
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "Orbitersdk.h"
+#include "panelsurfacecache.h"
+
+std::unordered_map<int, SURFHANDLE> PanelSurfaceCache::Surfaces;
+std::unordered_map<SURFHANDLE, int> PanelSurfaceCache::SurfaceIds;
+int PanelSurfaceCache::Owners = 0;
+int PanelSurfaceCache::LoadCount = 0;
+
+void PanelSurfaceCache::AddOwner()
+
+{
+	Owners++;
+}
+
+void PanelSurfaceCache::RemoveOwner()
+
+{
+	if (Owners > 0)
+		Owners--;
+
+	if (Owners == 0)
+	{
+		for (std::unordered_map<int, SURFHANDLE>::iterator it = Surfaces.begin(); it != Surfaces.end(); ++it)
+		{
+			oapiDestroySurface(it->second);
+		}
+		Surfaces.clear();
+		SurfaceIds.clear();
+	}
+}
+
+SURFHANDLE PanelSurfaceCache::LoadBitmapSurface(HINSTANCE hDLL, int id)
+
+{
+	std::unordered_map<int, SURFHANDLE>::iterator it = Surfaces.find(id);
+	if (it != Surfaces.end())
+		return it->second;
+
+	SURFHANDLE s = oapiCreateSurface(LoadBitmap(hDLL, MAKEINTRESOURCE(id)));
+	if (!s)
+		return s;
+
+	Surfaces[id] = s;
+	SurfaceIds[s] = id;
+	LoadCount++;
+
+	return s;
+}
+
+void PanelSurfaceCache::ReleaseSurface(SURFHANDLE s)
+
+{
+	if (SurfaceIds.find(s) == SurfaceIds.end())
+		oapiDestroySurface(s);
+}
@@ -0,0 +1,78 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+Panel Surface Cache (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include "Orbitersdk.h"
+#include <unordered_map>
+
+///
+/// Panel bitmaps are loaded from the module resources once, and then shared by every vessel
+/// created from this module. They stay loaded across panel changes until the last vessel using
+/// the cache is deleted. Only use this for surfaces which are never drawn into, since all users
+/// see the same surface.
+/// \brief Shared cache of panel surfaces loaded from bitmap resources.
+/// \ingroup PanelItems
+///
+class PanelSurfaceCache
+{
+public:
+	///
+	/// \brief Register a vessel using the cache.
+	///
+	static void AddOwner();
+
+	///
+	/// When the last owner is removed, all cached surfaces are destroyed.
+	/// \brief Unregister a vessel using the cache.
+	///
+	static void RemoveOwner();
+
+	///
+	/// \brief Get the surface for a bitmap resource, loading it on first use.
+	/// \param hDLL Module containing the bitmap resource.
+	/// \param id Bitmap resource ID.
+	/// \return Shared surface.
+	///
+	static SURFHANDLE LoadBitmapSurface(HINSTANCE hDLL, int id);
+
+	///
+	/// Cached surfaces stay loaded for the next panel change. Surfaces which didn't come
+	/// from the cache are destroyed, so this can be used on any panel surface.
+	/// \brief Stop using a surface.
+	/// \param s Surface to release.
+	///
+	static void ReleaseSurface(SURFHANDLE s);
+
+	///
+	/// \brief Number of bitmaps actually loaded from the resources so far.
+	///
+	static int GetLoadCount() { return LoadCount; };
+
+protected:
+	static std::unordered_map<int, SURFHANDLE> Surfaces;
+	static std::unordered_map<SURFHANDLE, int> SurfaceIds;
+	static int Owners;
+	static int LoadCount;
+};
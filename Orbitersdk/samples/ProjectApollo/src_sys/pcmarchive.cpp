@@ -0,0 +1,575 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Telemetry Archive
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "pcmarchive.h"
+#include <io.h>
+#include <string.h>
+#include <algorithm>
+
+// 256 kB, about 30 seconds of HBR data
+#define PCM_ARCHIVE_CHUNK_SIZE	0x40000
+
+static const char PCMArchiveMagic[8] = { 'N', 'A', 'S', 'S', 'P', 'P', 'C', 'M' };
+
+static bool ValidChunk(const PCMArchiveChunk &c, unsigned long long offset, unsigned long long fileSize)
+{
+	if (c.magic != PCM_ARCHIVE_CHUNK_MAGIC) return false;
+	if (c.recordSize != sizeof(PCMArchiveFrame) + c.frameWords) return false;
+	if (c.size != sizeof(PCMArchiveChunk) + (unsigned long long)c.frameCount * c.recordSize) return false;
+	if (c.size > PCM_ARCHIVE_CHUNK_SIZE) return false;
+	return offset + c.size <= fileSize;
+}
+
+//
+// The index from the footer has to describe the chunks back to back up to the index
+// itself, each one small enough to be read back into the chunk buffer.
+//
+
+static bool ValidIndex(const std::vector<PCMArchiveIndexEntry> &index, unsigned long long indexOffset)
+{
+	unsigned long long offset = sizeof(PCMArchiveHeader);
+
+	for (unsigned i = 0; i < index.size(); i++) {
+		const PCMArchiveIndexEntry &e = index[i];
+		if (e.offset != offset || e.size < sizeof(PCMArchiveChunk) || e.size > PCM_ARCHIVE_CHUNK_SIZE) return false;
+		offset += e.size;
+	}
+	return offset == indexOffset;
+}
+
+static PCMArchiveIndexEntry IndexEntry(const PCMArchiveChunk &c, unsigned long long offset)
+{
+	PCMArchiveIndexEntry e;
+	e.firstMET = c.firstMET;
+	e.lastMET = c.lastMET;
+	e.offset = offset;
+	e.size = c.size;
+	e.frameCount = c.frameCount;
+	return e;
+}
+
+static bool IndexBefore(const PCMArchiveIndexEntry &e, double met)
+{
+	return e.lastMET < met;
+}
+
+PCMArchiveWriter::PCMArchiveWriter() : file(NULL), endOffset(0), frame(NULL), nextWord(0), frames(0), rewinds(0)
+
+{
+}
+
+PCMArchiveWriter::~PCMArchiveWriter()
+
+{
+	Close();
+}
+
+bool PCMArchiveWriter::Open(const char *fname, int vehicle)
+
+{
+	Close();
+
+	chunk.assign(PCM_ARCHIVE_CHUNK_SIZE, 0);
+	frame = NULL;
+	index.clear();
+
+	file = fopen(fname, "r+b");
+	if (file) {
+		PCMArchiveHeader h;
+		if (fread(&h, sizeof(h), 1, file) == 1) {
+			if (memcmp(h.magic, PCMArchiveMagic, sizeof(h.magic)) || h.version != PCM_ARCHIVE_VERSION || h.vehicle != (unsigned)vehicle) {
+				fclose(file);
+				file = NULL;
+				return false;
+			}
+			return Recover();
+		}
+
+		// Empty file, start over
+		fclose(file);
+	}
+
+	file = fopen(fname, "w+b");
+	if (!file) {
+		return false;
+	}
+
+	PCMArchiveHeader h;
+	memcpy(h.magic, PCMArchiveMagic, sizeof(h.magic));
+	h.version = PCM_ARCHIVE_VERSION;
+	h.vehicle = vehicle;
+
+	if (fwrite(&h, sizeof(h), 1, file) != 1) {
+		fclose(file);
+		file = NULL;
+		return false;
+	}
+	endOffset = sizeof(h);
+	return true;
+}
+
+//
+// Find the end of the recorded chunks, from the index if the archive was closed
+// properly, or by walking the chunks otherwise. The index and anything incomplete
+// behind the chunks is cut off, it's written again on Close().
+//
+
+bool PCMArchiveWriter::Recover()
+
+{
+	_fseeki64(file, 0, SEEK_END);
+	unsigned long long fileSize = _ftelli64(file);
+
+	endOffset = sizeof(PCMArchiveHeader);
+
+	PCMArchiveFooter footer;
+	if (fileSize >= endOffset + sizeof(footer)) {
+		_fseeki64(file, fileSize - sizeof(footer), SEEK_SET);
+		if (fread(&footer, sizeof(footer), 1, file) == 1 && footer.magic == PCM_ARCHIVE_FOOTER_MAGIC &&
+			footer.indexOffset + (unsigned long long)footer.count * sizeof(PCMArchiveIndexEntry) + sizeof(footer) == fileSize) {
+			index.resize(footer.count);
+			_fseeki64(file, footer.indexOffset, SEEK_SET);
+			if ((footer.count == 0 || fread(index.data(), sizeof(PCMArchiveIndexEntry), footer.count, file) == footer.count) &&
+				ValidIndex(index, footer.indexOffset)) {
+				endOffset = footer.indexOffset;
+			}
+			else {
+				index.clear();
+			}
+		}
+	}
+
+	if (index.empty()) {
+		PCMArchiveChunk c;
+		for (;;) {
+			_fseeki64(file, endOffset, SEEK_SET);
+			if (fread(&c, sizeof(c), 1, file) != 1 || !ValidChunk(c, endOffset, fileSize)) {
+				break;
+			}
+			index.push_back(IndexEntry(c, endOffset));
+			endOffset += c.size;
+		}
+	}
+
+	if (endOffset < fileSize) {
+		fflush(file);
+		_chsize_s(_fileno(file), endOffset);
+	}
+	_fseeki64(file, endOffset, SEEK_SET);
+	return true;
+}
+
+void PCMArchiveWriter::Close()
+
+{
+	if (!file)
+		return;
+
+	Flush();
+
+	if (file) {
+		PCMArchiveFooter footer;
+		footer.magic = PCM_ARCHIVE_FOOTER_MAGIC;
+		footer.count = index.size();
+		footer.indexOffset = endOffset;
+
+		if (!index.empty()) {
+			fwrite(index.data(), sizeof(PCMArchiveIndexEntry), index.size(), file);
+		}
+		fwrite(&footer, sizeof(footer), 1, file);
+		fclose(file);
+		file = NULL;
+	}
+}
+
+double PCMArchiveWriter::LastMET()
+
+{
+	PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+
+	if (c->frameCount > 0) return c->lastMET;
+	if (!index.empty()) return index.back().lastMET;
+	return -1e300;
+}
+
+void PCMArchiveWriter::Write(const unsigned char *words, int count, int firstWord, int frameWords, double wordTime, double met, double simt, double mjd)
+
+{
+	if (!file)
+		return;
+
+	int i = 0;
+	while (i < count) {
+		PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+		int addr = (firstWord + i) % frameWords;
+
+		//
+		// Start a new frame at the frame boundary, and when the stream isn't continuous.
+		//
+
+		if (frame == NULL || addr != nextWord || (int)c->frameWords != frameWords || c->wordTime != wordTime) {
+			double dt = i * wordTime;
+
+			frame = NULL;
+			if (met + dt < LastMET()) {
+				Rewind(met + dt);
+				if (!file) return;
+			}
+
+			unsigned capacity = (c->recordSize > 0) ? (chunk.size() - sizeof(PCMArchiveChunk)) / c->recordSize : 0;
+			if ((int)c->frameWords != frameWords || c->wordTime != wordTime || c->frameCount >= capacity) {
+				Flush();
+				if (!file) return;
+				StartChunk(frameWords, wordTime);
+			}
+			StartFrame(addr, met + dt, simt + dt, mjd + dt / 86400.0);
+		}
+
+		int n = std::min(count - i, frameWords - addr);
+		memcpy((unsigned char *)(frame + 1) + addr, words + i, n);
+		frame->words += n;
+		nextWord = addr + n;
+		i += n;
+
+		if (nextWord >= frameWords) {
+			frame = NULL;
+		}
+	}
+}
+
+void PCMArchiveWriter::StartChunk(int frameWords, double wordTime)
+
+{
+	PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+
+	memset(c, 0, sizeof(PCMArchiveChunk));
+	c->magic = PCM_ARCHIVE_CHUNK_MAGIC;
+	c->frameWords = frameWords;
+	c->recordSize = sizeof(PCMArchiveFrame) + frameWords;
+	c->wordTime = wordTime;
+}
+
+void PCMArchiveWriter::StartFrame(int firstWord, double met, double simt, double mjd)
+
+{
+	PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+
+	frame = (PCMArchiveFrame *)(chunk.data() + sizeof(PCMArchiveChunk) + c->frameCount * c->recordSize);
+	memset(frame, 0, c->recordSize);
+	frame->met = met;
+	frame->simt = simt;
+	frame->mjd = mjd;
+	frame->firstWord = firstWord;
+	nextWord = firstWord;
+
+	if (c->frameCount == 0) {
+		c->firstMET = met;
+		c->firstMJD = mjd;
+	}
+	c->lastMET = met;
+	c->frameCount++;
+	frames++;
+}
+
+void PCMArchiveWriter::Flush()
+
+{
+	PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+
+	frame = NULL;
+
+	if (c->frameCount > 0) {
+		c->size = sizeof(PCMArchiveChunk) + c->frameCount * c->recordSize;
+
+		// The chunk goes to disk in one piece, so a crash only loses the chunk being assembled.
+		if (fwrite(chunk.data(), 1, c->size, file) != c->size || fflush(file) != 0) {
+			fclose(file);
+			file = NULL;
+			return;
+		}
+
+		index.push_back(IndexEntry(*c, endOffset));
+		endOffset += c->size;
+	}
+
+	memset(c, 0, sizeof(PCMArchiveChunk));
+}
+
+//
+// Drop everything recorded at or after the given mission time. The frames before it
+// in the same chunk are read back and continue to be assembled.
+//
+
+void PCMArchiveWriter::Rewind(double met)
+
+{
+	Flush();
+	if (!file)
+		return;
+
+	std::vector<PCMArchiveIndexEntry>::iterator it = std::lower_bound(index.begin(), index.end(), met, IndexBefore);
+	if (it == index.end())
+		return;
+
+	PCMArchiveIndexEntry e = *it;
+	PCMArchiveChunk *c = (PCMArchiveChunk *)chunk.data();
+
+	// A chunk that doesn't fit the buffer or doesn't match its index entry is dropped with the rest.
+	_fseeki64(file, e.offset, SEEK_SET);
+	if (e.size >= sizeof(PCMArchiveChunk) && e.size <= chunk.size() && fread(chunk.data(), 1, e.size, file) == e.size &&
+		ValidChunk(*c, e.offset, e.offset + e.size) && c->size == e.size) {
+		const unsigned char *records = chunk.data() + sizeof(PCMArchiveChunk);
+		unsigned n = 0;
+
+		while (n < c->frameCount && ((const PCMArchiveFrame *)(records + n * c->recordSize))->met < met) {
+			n++;
+		}
+
+		c->frameCount = n;
+		if (n > 0) {
+			c->lastMET = ((const PCMArchiveFrame *)(records + (n - 1) * c->recordSize))->met;
+		}
+	}
+	else {
+		memset(c, 0, sizeof(PCMArchiveChunk));
+	}
+
+	index.erase(it, index.end());
+	endOffset = e.offset;
+
+	fflush(file);
+	_chsize_s(_fileno(file), endOffset);
+	_fseeki64(file, endOffset, SEEK_SET);
+	rewinds++;
+}
+
+PCMArchiveReader::PCMArchiveReader() : file(INVALID_HANDLE_VALUE), mapping(NULL), fileSize(0), granularity(0x10000), vehicle(-1),
+	view(NULL), chunk(NULL), chunkNo(0), frameNo(0)
+
+{
+}
+
+PCMArchiveReader::~PCMArchiveReader()
+
+{
+	Close();
+}
+
+bool PCMArchiveReader::Open(const char *fname)
+
+{
+	Close();
+
+	file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	PCMArchiveHeader h;
+
+	if (!GetFileSizeEx(file, &size) || !ReadAt(0, &h, sizeof(h)) ||
+		memcmp(h.magic, PCMArchiveMagic, sizeof(h.magic)) || h.version != PCM_ARCHIVE_VERSION) {
+		Close();
+		return false;
+	}
+
+	fileSize = size.QuadPart;
+	vehicle = h.vehicle;
+
+	if (!LoadIndex()) {
+		Close();
+		return false;
+	}
+
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping) {
+		Close();
+		return false;
+	}
+
+	SYSTEM_INFO si;
+	GetSystemInfo(&si);
+	granularity = si.dwAllocationGranularity;
+	return true;
+}
+
+void PCMArchiveReader::Close()
+
+{
+	Unmap();
+
+	if (mapping) {
+		CloseHandle(mapping);
+		mapping = NULL;
+	}
+	if (file != INVALID_HANDLE_VALUE) {
+		CloseHandle(file);
+		file = INVALID_HANDLE_VALUE;
+	}
+	index.clear();
+	vehicle = -1;
+}
+
+bool PCMArchiveReader::ReadAt(unsigned long long offset, void *data, unsigned len)
+
+{
+	OVERLAPPED ov;
+	DWORD done;
+
+	memset(&ov, 0, sizeof(ov));
+	ov.Offset = (DWORD)offset;
+	ov.OffsetHigh = (DWORD)(offset >> 32);
+
+	return ReadFile(file, data, len, &done, &ov) && done == len;
+}
+
+//
+// Use the index if the archive was closed properly, otherwise walk the chunks.
+//
+
+bool PCMArchiveReader::LoadIndex()
+
+{
+	PCMArchiveFooter footer;
+
+	if (fileSize >= sizeof(PCMArchiveHeader) + sizeof(footer) && ReadAt(fileSize - sizeof(footer), &footer, sizeof(footer)) &&
+		footer.magic == PCM_ARCHIVE_FOOTER_MAGIC &&
+		footer.indexOffset + (unsigned long long)footer.count * sizeof(PCMArchiveIndexEntry) + sizeof(footer) == fileSize) {
+		index.resize(footer.count);
+		if ((footer.count == 0 || ReadAt(footer.indexOffset, index.data(), footer.count * sizeof(PCMArchiveIndexEntry))) &&
+			ValidIndex(index, footer.indexOffset)) {
+			return true;
+		}
+		index.clear();
+	}
+
+	unsigned long long offset = sizeof(PCMArchiveHeader);
+	PCMArchiveChunk c;
+
+	while (ReadAt(offset, &c, sizeof(c)) && ValidChunk(c, offset, fileSize)) {
+		index.push_back(IndexEntry(c, offset));
+		offset += c.size;
+	}
+	return true;
+}
+
+bool PCMArchiveReader::MapChunk(unsigned i)
+
+{
+	if (chunk && chunkNo == i)
+		return true;
+
+	Unmap();
+
+	unsigned long long offset = index[i].offset;
+	unsigned long long base = offset - offset % granularity;
+
+	view = MapViewOfFile(mapping, FILE_MAP_READ, (DWORD)(base >> 32), (DWORD)base, (SIZE_T)(offset - base + index[i].size));
+	if (!view) {
+		return false;
+	}
+
+	chunk = (const PCMArchiveChunk *)((const char *)view + (offset - base));
+	chunkNo = i;
+	frameNo = 0;
+
+	// The frames are only indexed through the header, so it has to match the mapped size.
+	if (!ValidChunk(*chunk, offset, offset + index[i].size) || chunk->size != index[i].size) {
+		Unmap();
+		return false;
+	}
+	return true;
+}
+
+void PCMArchiveReader::Unmap()
+
+{
+	if (view) {
+		UnmapViewOfFile(view);
+		view = NULL;
+	}
+	chunk = NULL;
+}
+
+unsigned long long PCMArchiveReader::GetFrameCount()
+
+{
+	unsigned long long n = 0;
+
+	for (unsigned i = 0; i < index.size(); i++) {
+		n += index[i].frameCount;
+	}
+	return n;
+}
+
+bool PCMArchiveReader::Seek(double met)
+
+{
+	std::vector<PCMArchiveIndexEntry>::iterator it = std::lower_bound(index.begin(), index.end(), met, IndexBefore);
+	if (it == index.end() || !MapChunk(it - index.begin())) {
+		return false;
+	}
+
+	const unsigned char *records = (const unsigned char *)(chunk + 1);
+	unsigned lo = 0, hi = chunk->frameCount;
+
+	while (lo < hi) {
+		unsigned mid = (lo + hi) / 2;
+		if (((const PCMArchiveFrame *)(records + mid * chunk->recordSize))->met < met) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+
+	frameNo = lo;
+	return frameNo < chunk->frameCount;
+}
+
+bool PCMArchiveReader::Next()
+
+{
+	if (!chunk)
+		return false;
+
+	if (++frameNo < chunk->frameCount)
+		return true;
+
+	if (chunkNo + 1 >= index.size()) {
+		frameNo = chunk->frameCount;
+		return false;
+	}
+	return MapChunk(chunkNo + 1);
+}
+
+const PCMArchiveFrame *PCMArchiveReader::GetFrame()
+
+{
+	if (!chunk || frameNo >= chunk->frameCount)
+		return NULL;
+
+	return (const PCMArchiveFrame *)((const unsigned char *)(chunk + 1) + frameNo * chunk->recordSize);
+}
@@ -0,0 +1,238 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Telemetry Archive (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <windows.h>
+#include <stdio.h>
+#include <vector>
+
+//
+// Archive layout: a file header, then chunks of fixed size frame records, then the
+// chunk index and a footer. The index and footer are only written when the archive
+// is closed properly, otherwise the chunks are walked to rebuild it.
+//
+
+#define PCM_ARCHIVE_VERSION		1
+
+#define PCM_ARCHIVE_CSM			0
+#define PCM_ARCHIVE_LM			1
+
+#define PCM_ARCHIVE_CHUNK_MAGIC		0x4B43504E	// "NPCK"
+#define PCM_ARCHIVE_FOOTER_MAGIC	0x4958504E	// "NPXI"
+
+///
+/// \brief Archive file header.
+///
+struct PCMArchiveHeader
+{
+	char magic[8];				///< "NASSPPCM"
+	unsigned int version;
+	unsigned int vehicle;		///< PCM_ARCHIVE_CSM or PCM_ARCHIVE_LM
+};
+
+///
+/// All frames in a chunk have the same bit rate and are stored as records of the
+/// same size, so a frame can be found by binary search.
+/// \brief Header in front of each chunk.
+///
+struct PCMArchiveChunk
+{
+	unsigned int magic;
+	unsigned int size;			///< Size of the chunk including this header
+	unsigned int frameWords;	///< Words per frame at this bit rate
+	unsigned int recordSize;	///< Size of a frame record including its header
+	unsigned int frameCount;
+	unsigned int reserved;
+	double wordTime;			///< Seconds per word
+	double firstMET;
+	double lastMET;
+	double firstMJD;
+};
+
+///
+/// The words of the frame follow the record header. Frames which were only partially
+/// generated, at the start of a recording or after a bit rate change, start at firstWord.
+/// \brief Frame record header.
+///
+struct PCMArchiveFrame
+{
+	double met;					///< Mission time of the first word
+	double simt;				///< Simulation time of the first word
+	double mjd;					///< MJD of the first word
+	unsigned short firstWord;	///< Word address of the first word
+	unsigned short words;		///< Number of valid words
+	unsigned int reserved;
+};
+
+///
+/// \brief Index entry of one chunk.
+///
+struct PCMArchiveIndexEntry
+{
+	double firstMET;
+	double lastMET;
+	unsigned long long offset;
+	unsigned int size;
+	unsigned int frameCount;
+};
+
+///
+/// \brief Archive footer, locates the index.
+///
+struct PCMArchiveFooter
+{
+	unsigned int magic;
+	unsigned int count;
+	unsigned long long indexOffset;
+};
+
+///
+/// Frames are assembled from the downlink words in memory and written a chunk at a time.
+/// An existing archive is appended to. If the mission time goes back, e.g. because an
+/// earlier scenario was loaded, the frames recorded after that time are discarded so
+/// the archive always follows one timeline.
+/// \brief Records PCM frames into an archive.
+///
+class PCMArchiveWriter
+{
+public:
+	PCMArchiveWriter();
+	virtual ~PCMArchiveWriter();
+
+	///
+	/// \brief Open an archive for appending, or create it.
+	/// \return False if the file can't be opened or belongs to another vehicle.
+	///
+	bool Open(const char *fname, int vehicle);
+
+	///
+	/// \brief Write the pending chunk and the index, and close the file.
+	///
+	void Close();
+
+	bool IsOpen() { return file != NULL; };
+
+	///
+	/// \brief Record downlink words.
+	/// \param words Downlink words.
+	/// \param count Number of words.
+	/// \param firstWord Word address of the first word in its frame.
+	/// \param frameWords Words per frame at the current bit rate.
+	/// \param wordTime Seconds per word at the current bit rate.
+	/// \param met Mission time of the first word.
+	/// \param simt Simulation time of the first word.
+	/// \param mjd MJD of the first word.
+	///
+	void Write(const unsigned char *words, int count, int firstWord, int frameWords, double wordTime, double met, double simt, double mjd);
+
+	unsigned long long GetFrames() { return frames; };
+	unsigned long long GetRewinds() { return rewinds; };
+
+protected:
+	bool Recover();
+	void StartChunk(int frameWords, double wordTime);
+	void StartFrame(int firstWord, double met, double simt, double mjd);
+	void Flush();
+	void Rewind(double met);
+	double LastMET();
+
+	FILE *file;
+	unsigned long long endOffset;	// End of the last complete chunk in the file
+	std::vector<PCMArchiveIndexEntry> index;
+
+	// Chunk being assembled
+	std::vector<unsigned char> chunk;
+	PCMArchiveFrame *frame;			// Frame being assembled, NULL between frames
+	int nextWord;					// Word address expected next in the current frame
+
+	unsigned long long frames;
+	unsigned long long rewinds;
+};
+
+///
+/// The archive is memory mapped a chunk at a time, so even archives larger than the
+/// address space can be read. Frames are returned as pointers into the mapping and are
+/// valid until the reader moves to another chunk.
+/// \brief Reads PCM frames from an archive.
+///
+class PCMArchiveReader
+{
+public:
+	PCMArchiveReader();
+	virtual ~PCMArchiveReader();
+
+	bool Open(const char *fname);
+	void Close();
+
+	int GetVehicle() { return vehicle; };
+	unsigned GetChunkCount() { return index.size(); };
+	const PCMArchiveIndexEntry &GetChunkEntry(unsigned i) { return index[i]; };
+	unsigned long long GetFrameCount();
+
+	///
+	/// \brief Move to the first frame at or after a mission time.
+	/// \return False if there is no such frame.
+	///
+	bool Seek(double met);
+
+	///
+	/// \brief Move to the next frame.
+	/// \return False at the end of the archive.
+	///
+	bool Next();
+
+	///
+	/// \brief Current frame, NULL if there is none.
+	///
+	const PCMArchiveFrame *GetFrame();
+
+	///
+	/// \brief Chunk of the current frame, NULL if there is none.
+	///
+	const PCMArchiveChunk *GetChunk() { return chunk; };
+
+	///
+	/// \brief Words of a frame record.
+	///
+	static const unsigned char *GetWords(const PCMArchiveFrame *f) { return (const unsigned char *)(f + 1); };
+
+protected:
+	bool LoadIndex();
+	bool ReadAt(unsigned long long offset, void *data, unsigned len);
+	bool MapChunk(unsigned i);
+	void Unmap();
+
+	HANDLE file;
+	HANDLE mapping;
+	unsigned long long fileSize;
+	unsigned granularity;
+	int vehicle;
+	std::vector<PCMArchiveIndexEntry> index;
+
+	void *view;
+	const PCMArchiveChunk *chunk;
+	unsigned chunkNo;
+	unsigned frameNo;
+};
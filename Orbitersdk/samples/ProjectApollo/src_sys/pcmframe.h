@@ -0,0 +1,247 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Frame Engine (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+// PCM words generated by the PCM itself instead of being measured. Smaller types are
+// measurement types of the vehicle and are passed on to its measure().
+#define PCM_WORD_CONST		10	// Constant, value in the channel code
+#define PCM_WORD_FRAMECOUNT	11	// SYNC 4, channel code plus the subcommutation frame count
+#define PCM_WORD_FRAMEADDR	12	// SYNC 4, channel code plus the frame address
+#define PCM_WORD_AGC		13	// Guidance computer digital data, channel code 0-4 (DS1A-E)
+#define PCM_WORD_COMMUTATED	14	// Commutated over the frame address, channel code is the row in the commutation table
+
+// The same word in all subcommutated frames
+#define PCM_WORD_ALL(channel, type, ccode) { channel, type, ccode }, { channel, type, ccode }, { channel, type, ccode }, { channel, type, ccode }, { channel, type, ccode }
+
+///
+/// \brief Content of one PCM downlink word slot: a measurement or a PCM_WORD_* word.
+///
+struct PCMWordDef {
+	int channel;
+	int type;
+	int ccode;
+};
+
+//
+// A frame format is a struct with these compile-time constants and static tables:
+//
+//   Words             words per frame
+//   FramesPerSecond   frames per second
+//   Subframes         subcommutated frames, the frame count selects one
+//   FrameAddrCycle    frames until the frame address wraps
+//   FrameCountCycle   frames until the frame count wraps
+//   CommutatedWords   rows in the commutation table
+//   Map               PCMWordDef Map[Words][Subframes]
+//   Commutated        CommutatedWords rows of FrameAddrCycle entries, NULL without any
+//   Downrupt(word)    true if the word triggers DOWNRUPT in the guidance computer
+//
+// The vehicle PCM provides word_addr, frame_addr, frame_count and frame_serial, and
+// measure(channel, type, ccode), agc_word(ccode) and downrupt().
+//
+
+///
+/// The word map of the format is compiled into a table of word operations once, and
+/// each measurement in it gets a slot in a sample cache, so a measurement which appears
+/// several times in a frame is only taken once per frame.
+/// \brief Generates the downlink words of one PCM frame format.
+///
+template <class Format, class Source> class PCMFrameEngine
+{
+public:
+	PCMFrameEngine();
+
+	///
+	/// \brief Seconds per word.
+	///
+	static double WordTime() { return 1.0 / (Format::Words * Format::FramesPerSecond); };
+
+	///
+	/// \brief Generate downlink words and advance the frame counters of the source.
+	/// \param src Vehicle PCM.
+	/// \param out Buffer for the words.
+	/// \param count Number of words.
+	///
+	void Generate(Source &src, unsigned char *out, int count);
+
+	///
+	/// \brief Advance the frame counters of the source by whole frames without generating them.
+	///
+	void SkipFrames(Source &src, int count);
+
+protected:
+	enum { OP_CONST, OP_FRAMECOUNT, OP_FRAMEADDR, OP_AGC, OP_SAMPLE, OP_COMMUTATED };
+
+	struct WordOp {
+		unsigned char op;
+		unsigned char downrupt;
+		unsigned short arg;		// Value, counter offset, channel code, sample slot or commutation row
+	};
+
+	int Register(const PCMWordDef &def);
+	unsigned char Sample(Source &src, int slot);
+	void NextFrame(Source &src);
+
+	WordOp ops[Format::Subframes][Format::Words];
+	std::vector<unsigned short> commutated;	// Sample slots of the commutation table
+
+	std::vector<PCMWordDef> sample_defs;	// Distinct measurements in the format
+	std::vector<unsigned char> sample_value; // Last sampled value
+	std::vector<int> sample_frame;			// frame_serial of the last sample
+};
+
+template <class Format, class Source> PCMFrameEngine<Format, Source>::PCMFrameEngine()
+{
+	int i, j;
+
+	for (i = 0; i < Format::CommutatedWords * Format::FrameAddrCycle; i++) {
+		commutated.push_back(Register(Format::Commutated[i]));
+	}
+
+	for (i = 0; i < Format::Words; i++) {
+		for (j = 0; j < Format::Subframes; j++) {
+			const PCMWordDef &w = Format::Map[i][j];
+			WordOp &op = ops[j][i];
+
+			op.downrupt = Format::Downrupt(i);
+			op.arg = w.ccode;
+
+			switch (w.type) {
+			case PCM_WORD_CONST:
+				op.op = OP_CONST;
+				break;
+			case PCM_WORD_FRAMECOUNT:
+				op.op = OP_FRAMECOUNT;
+				break;
+			case PCM_WORD_FRAMEADDR:
+				op.op = OP_FRAMEADDR;
+				break;
+			case PCM_WORD_AGC:
+				op.op = OP_AGC;
+				break;
+			case PCM_WORD_COMMUTATED:
+				op.op = OP_COMMUTATED;
+				op.arg = w.ccode * Format::FrameAddrCycle;
+				break;
+			default:
+				op.op = OP_SAMPLE;
+				op.arg = Register(w);
+				break;
+			}
+		}
+	}
+
+	sample_value.assign(sample_defs.size(), 0);
+	sample_frame.assign(sample_defs.size(), -1);
+}
+
+template <class Format, class Source> int PCMFrameEngine<Format, Source>::Register(const PCMWordDef &def)
+{
+	for (unsigned i = 0; i < sample_defs.size(); i++) {
+		if (sample_defs[i].channel == def.channel && sample_defs[i].type == def.type && sample_defs[i].ccode == def.ccode) {
+			return i;
+		}
+	}
+
+	sample_defs.push_back(def);
+	return sample_defs.size() - 1;
+}
+
+// Measure a registered telemetry item, at most once per downlink frame.
+
+template <class Format, class Source> unsigned char PCMFrameEngine<Format, Source>::Sample(Source &src, int slot)
+{
+	if (sample_frame[slot] != src.frame_serial) {
+		const PCMWordDef &def = sample_defs[slot];
+		sample_value[slot] = src.measure(def.channel, def.type, def.ccode);
+		sample_frame[slot] = src.frame_serial;
+	}
+	return sample_value[slot];
+}
+
+template <class Format, class Source> void PCMFrameEngine<Format, Source>::NextFrame(Source &src)
+{
+	src.word_addr = 0;
+	src.frame_serial++;
+	src.frame_addr = (src.frame_addr + 1) % Format::FrameAddrCycle;
+	src.frame_count = (src.frame_count + 1) % Format::FrameCountCycle;
+}
+
+template <class Format, class Source> void PCMFrameEngine<Format, Source>::Generate(Source &src, unsigned char *out, int count)
+{
+	if (count <= 0)
+		return;
+
+	// A longer frame of another bit rate was interrupted, finish it with a blank word
+	if (src.word_addr >= Format::Words) {
+		*out++ = 0;
+		count--;
+		NextFrame(src);
+	}
+
+	const WordOp *frame = ops[src.frame_count % Format::Subframes];
+
+	for (int i = 0; i < count; i++) {
+		const WordOp &op = frame[src.word_addr];
+
+		switch (op.op) {
+		case OP_CONST:
+			out[i] = (unsigned char)op.arg;
+			break;
+		case OP_FRAMECOUNT:
+			out[i] = (unsigned char)(op.arg + src.frame_count);
+			break;
+		case OP_FRAMEADDR:
+			out[i] = (unsigned char)(op.arg + src.frame_addr);
+			break;
+		case OP_AGC:
+			out[i] = src.agc_word(op.arg);
+			break;
+		case OP_SAMPLE:
+			out[i] = Sample(src, op.arg);
+			break;
+		case OP_COMMUTATED:
+			out[i] = Sample(src, commutated[op.arg + src.frame_addr]);
+			break;
+		}
+
+		if (op.downrupt) {
+			src.downrupt();
+		}
+
+		if (++src.word_addr == Format::Words) {
+			NextFrame(src);
+			frame = ops[src.frame_count % Format::Subframes];
+		}
+	}
+}
+
+template <class Format, class Source> void PCMFrameEngine<Format, Source>::SkipFrames(Source &src, int count)
+{
+	src.frame_serial += count;
+	src.frame_addr = (src.frame_addr + count) % Format::FrameAddrCycle;
+	src.frame_count = (src.frame_count + count) % Format::FrameCountCycle;
+}
@@ -0,0 +1,283 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Downlink Transport
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#include "pcmtransport.h"
+#include <algorithm>
+#include <chrono>
+
+// 1 MB, about 160 seconds of HBR data
+#define PCM_RING_SIZE_LOG2		20
+
+// How long the transport thread sleeps when there's nothing to do
+#define PCM_TRANSPORT_IDLE_MS	20
+
+// How long a socket send may wait for a slow client before the data is dropped
+#define PCM_SOCKET_TIMEOUT_MS	250
+
+PCMRingBuffer::PCMRingBuffer(int sizeLog2) : head(0), tail(0)
+
+{
+	buffer.resize(1u << sizeLog2);
+	mask = (1u << sizeLog2) - 1;
+}
+
+unsigned PCMRingBuffer::Write(const unsigned char *data, unsigned len)
+
+{
+	unsigned h = head.load(std::memory_order_relaxed);
+	unsigned t = tail.load(std::memory_order_acquire);
+	unsigned n = std::min(len, (unsigned)buffer.size() - (h - t));
+
+	for (unsigned i = 0; i < n; i++) {
+		buffer[(h + i) & mask] = data[i];
+	}
+
+	head.store(h + n, std::memory_order_release);
+	return n;
+}
+
+unsigned PCMRingBuffer::Read(unsigned char *data, unsigned len)
+
+{
+	unsigned t = tail.load(std::memory_order_relaxed);
+	unsigned h = head.load(std::memory_order_acquire);
+	unsigned n = std::min(len, h - t);
+
+	for (unsigned i = 0; i < n; i++) {
+		data[i] = buffer[(t + i) & mask];
+	}
+
+	tail.store(t + n, std::memory_order_release);
+	return n;
+}
+
+PCMFileSink::PCMFileSink(FILE *f)
+
+{
+	file = f;
+}
+
+PCMFileSink::~PCMFileSink()
+
+{
+	if (file) {
+		fclose(file);
+	}
+}
+
+int PCMFileSink::Send(const unsigned char *data, unsigned len)
+
+{
+	if (fwrite(data, 1, len, file) != len) {
+		return -1;
+	}
+	return len;
+}
+
+PCMSocketSink::PCMSocketSink(SOCKET s) : failed(false), error(0)
+
+{
+	sock = s;
+}
+
+PCMSocketSink::~PCMSocketSink()
+
+{
+	closesocket(sock);
+}
+
+int PCMSocketSink::Send(const unsigned char *data, unsigned len)
+
+{
+	unsigned done = 0;
+	int waited = 0;
+
+	while (done < len) {
+		int n = send(sock, (const char *)(data + done), len - done, 0);
+
+		if (n == SOCKET_ERROR) {
+			long errnumber = WSAGetLastError();
+
+			if (errnumber != WSAEWOULDBLOCK) {
+				error = errnumber;
+				failed = true;
+				return -1;
+			}
+
+			//
+			// The client isn't keeping up, give it some time before dropping the rest.
+			//
+
+			if (waited >= PCM_SOCKET_TIMEOUT_MS) {
+				break;
+			}
+
+			fd_set fds;
+			FD_ZERO(&fds);
+			FD_SET(sock, &fds);
+
+			timeval tv;
+			tv.tv_sec = 0;
+			tv.tv_usec = PCM_TRANSPORT_IDLE_MS * 1000;
+
+			select(0, NULL, &fds, NULL, &tv);
+			waited += PCM_TRANSPORT_IDLE_MS;
+			continue;
+		}
+
+		done += n;
+	}
+	return done;
+}
+
+PCMTransport::PCMTransport() : ring(PCM_RING_SIZE_LOG2), sinkCount(0), sent(0), dropped(0), running(false)
+
+{
+}
+
+PCMTransport::~PCMTransport()
+
+{
+	Stop();
+
+	// Sinks detached after the transport thread last looked
+	std::lock_guard<std::mutex> guard(sinkMutex);
+	for (unsigned i = 0; i < removedSinks.size(); i++) {
+		delete removedSinks[i];
+	}
+	removedSinks.clear();
+}
+
+void PCMTransport::Push(const unsigned char *data, unsigned len)
+
+{
+	if (!HasSinks())
+		return;
+
+	unsigned n = ring.Write(data, len);
+	if (n < len) {
+		dropped += len - n;
+	}
+
+	//
+	// The transport thread polls the buffer, only wake it early when the buffer is filling up.
+	//
+
+	if (ring.Used() > (1u << (PCM_RING_SIZE_LOG2 - 1))) {
+		wake.notify_one();
+	}
+}
+
+void PCMTransport::AddSink(PCMSink *s)
+
+{
+	{
+		std::lock_guard<std::mutex> guard(sinkMutex);
+		addedSinks.push_back(s);
+		sinkCount++;
+	}
+
+	if (!running) {
+		running = true;
+		worker = std::thread(&PCMTransport::Run, this);
+	}
+}
+
+void PCMTransport::RemoveSink(PCMSink *s)
+
+{
+	{
+		std::lock_guard<std::mutex> guard(sinkMutex);
+		removedSinks.push_back(s);
+		sinkCount--;
+	}
+	wake.notify_one();
+}
+
+//
+// Called by the transport thread only. The sim thread never waits for more than this.
+//
+
+void PCMTransport::UpdateSinks()
+
+{
+	std::vector<PCMSink *> removed;
+
+	{
+		std::lock_guard<std::mutex> guard(sinkMutex);
+		sinks.insert(sinks.end(), addedSinks.begin(), addedSinks.end());
+		addedSinks.clear();
+		removed.swap(removedSinks);
+	}
+
+	for (unsigned i = 0; i < removed.size(); i++) {
+		sinks.erase(std::remove(sinks.begin(), sinks.end(), removed[i]), sinks.end());
+		delete removed[i];
+	}
+}
+
+void PCMTransport::Stop()
+
+{
+	if (running) {
+		running = false;
+		wake.notify_one();
+		worker.join();
+	}
+}
+
+void PCMTransport::Run()
+
+{
+	unsigned char data[4096];
+
+	while (running) {
+		{
+			std::unique_lock<std::mutex> lock(wakeMutex);
+			wake.wait_for(lock, std::chrono::milliseconds(PCM_TRANSPORT_IDLE_MS));
+		}
+
+		unsigned n;
+		UpdateSinks();
+		while ((n = ring.Read(data, sizeof(data))) > 0) {
+			for (unsigned i = 0; i < sinks.size();) {
+				int delivered = sinks[i]->Send(data, n);
+				if (delivered < 0) {
+					// Failed sinks stop getting data, their owner notices and removes them.
+					dropped += n;
+					sinks.erase(sinks.begin() + i);
+					continue;
+				}
+				if ((unsigned)delivered < n) {
+					dropped += n - delivered;
+				}
+				sent += delivered;
+				i++;
+			}
+
+			// Don't keep sending to sinks which were detached in the meantime
+			UpdateSinks();
+		}
+	}
+}
@@ -0,0 +1,195 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Downlink Transport (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <winsock.h>
+#include <stdio.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// Lock-free as long as there is only one writer thread and one reader thread.
+/// \brief Byte ring buffer between the PCM and its transport thread.
+///
+class PCMRingBuffer
+{
+public:
+	///
+	/// \brief Constructor.
+	/// \param sizeLog2 Buffer size as a power of two.
+	///
+	PCMRingBuffer(int sizeLog2);
+
+	///
+	/// \brief Append data, as much as fits.
+	/// \return Number of bytes written.
+	///
+	unsigned Write(const unsigned char *data, unsigned len);
+
+	///
+	/// \brief Take data out of the buffer.
+	/// \return Number of bytes read.
+	///
+	unsigned Read(unsigned char *data, unsigned len);
+
+	///
+	/// \brief Number of bytes waiting to be read.
+	///
+	unsigned Used() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); };
+
+protected:
+	std::vector<unsigned char> buffer;
+	unsigned mask;
+
+	// Free-running positions, only ever advanced by the writer and the reader respectively.
+	std::atomic<unsigned> head;
+	std::atomic<unsigned> tail;
+};
+
+///
+/// Sinks are called from the transport thread only. Subclass this to receive the
+/// downlink stream in-process.
+/// \brief Destination of the PCM downlink stream.
+///
+class PCMSink
+{
+public:
+	virtual ~PCMSink() {};
+
+	///
+	/// \brief Deliver downlink words.
+	/// \return Number of bytes delivered, or -1 if the sink failed and has to be removed.
+	///
+	virtual int Send(const unsigned char *data, unsigned len) = 0;
+};
+
+///
+/// \brief Writes the raw downlink stream to a local file.
+///
+class PCMFileSink : public PCMSink
+{
+public:
+	PCMFileSink(FILE *f);
+	virtual ~PCMFileSink();
+
+	int Send(const unsigned char *data, unsigned len);
+
+protected:
+	FILE *file;
+};
+
+///
+/// The sink owns the socket and closes it when it is deleted.
+/// \brief Sends the downlink stream to a connected telemetry client.
+///
+class PCMSocketSink : public PCMSink
+{
+public:
+	PCMSocketSink(SOCKET s);
+	virtual ~PCMSocketSink();
+
+	int Send(const unsigned char *data, unsigned len);
+
+	///
+	/// \brief Check whether the connection failed while sending.
+	///
+	bool Failed() { return failed; };
+
+	///
+	/// \brief Winsock error that made the connection fail.
+	///
+	long GetError() { return error; };
+
+protected:
+	SOCKET sock;
+	std::atomic<bool> failed;
+	std::atomic<long> error;
+};
+
+///
+/// The PCM writes its downlink words into a ring buffer, and a worker thread passes them
+/// on to the attached sinks. When the buffer is full, the words which don't fit are
+/// dropped and counted.
+/// \brief PCM downlink transport.
+///
+class PCMTransport
+{
+public:
+	PCMTransport();
+	virtual ~PCMTransport();
+
+	///
+	/// \brief Queue downlink words for the sinks. Does nothing when no sink is attached.
+	///
+	void Push(const unsigned char *data, unsigned len);
+
+	///
+	/// The transport thread is started with the first sink, and picks the sink up the next
+	/// time it wakes.
+	/// \brief Attach a sink. The sink stays owned by the caller until it is removed.
+	///
+	void AddSink(PCMSink *s);
+
+	///
+	/// Doesn't wait for the transport thread, which may be busy sending to a slow client.
+	/// The transport takes over the sink and deletes it once the thread is done with it.
+	/// \brief Detach a sink.
+	///
+	void RemoveSink(PCMSink *s);
+
+	bool HasSinks() { return sinkCount.load() > 0; };
+
+	///
+	/// \brief Number of bytes the sinks accepted, summed over all sinks.
+	///
+	unsigned long long GetSent() { return sent.load(); };
+
+	///
+	/// \brief Number of bytes which didn't fit into the buffer or which a sink didn't accept.
+	///
+	unsigned long long GetDropped() { return dropped.load(); };
+
+protected:
+	void Run();
+	void Stop();
+	void UpdateSinks();
+
+	PCMRingBuffer ring;
+	std::vector<PCMSink *> sinks;			// Only used by the transport thread
+	std::vector<PCMSink *> addedSinks;		// Attached since the transport thread last looked
+	std::vector<PCMSink *> removedSinks;	// Detached, to be deleted by the transport thread
+	std::atomic<int> sinkCount;
+	std::atomic<unsigned long long> sent;
+	std::atomic<unsigned long long> dropped;
+
+	std::thread worker;
+	std::mutex sinkMutex;
+	std::mutex wakeMutex;
+	std::condition_variable wake;
+	std::atomic<bool> running;
+};
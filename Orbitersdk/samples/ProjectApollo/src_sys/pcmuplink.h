@@ -0,0 +1,96 @@
+/***************************************************************************
+This file is part of Project Apollo - NASSP
+Copyright 2026
+
+PCM Uplink Queue (Header)
+
+Project Apollo is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+Project Apollo is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Project Apollo; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+See http://nassp.sourceforge.net/license/ for more details.
+
+**************************************************************************/
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// Uplink data the PCM can hold, about 680 keystrokes
+#define PCM_UPLINK_SIZE 2048
+
+///
+/// MCC and the MFDs queue complete uplink loads here, in the same format the telemetry
+/// client sends over TCP, and the PCM takes them out a byte at a time at the uplink
+/// rate. A load is either queued whole or not at all, so loads from different senders
+/// never interleave. Everything is inline, so the MFD modules can use it directly.
+/// \brief Thread-safe in-process uplink queue of the PCM.
+///
+class PCMUplinkQueue
+{
+public:
+	PCMUplinkQueue() {};
+
+	///
+	/// \brief Queue an uplink load.
+	/// \return False if the load doesn't fit into the uplink buffer.
+	///
+	bool Enqueue(const unsigned char *load, unsigned len)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		if (data.size() + len > PCM_UPLINK_SIZE) {
+			return false;
+		}
+		data.insert(data.end(), load, load + len);
+		return true;
+	};
+
+	bool Enqueue(const std::vector<unsigned char> &load) { return load.empty() || Enqueue(load.data(), load.size()); };
+
+	///
+	/// \brief Take the next uplink byte.
+	/// \return False if the queue is empty.
+	///
+	bool Pop(unsigned char &c)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		if (data.empty()) {
+			return false;
+		}
+		c = data.front();
+		data.pop_front();
+		return true;
+	};
+
+	unsigned Size()
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return data.size();
+	};
+
+	bool Empty() { return Size() == 0; };
+
+	void Clear()
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		data.clear();
+	};
+
+protected:
+	std::mutex lock;
+	std::deque<unsigned char> data;
+};
@@ -63,10 +63,15 @@ PanelSwitchItem::PanelSwitchItem() : fInitialAnimState(0.0)
 	doTimeStep = false;
 
 	callback = 0;
+	vcPanel = 0;
 
 	bHasAnimations = false;
 	bHasDirection = false;
 	bHasReference = false;
+
+	lastDrawState = 0;
+	lastDrawFlash = false;
+	lastDrawValid = false;
 }
 
 PanelSwitchItem::~PanelSwitchItem()
@@ -147,6 +152,42 @@ void PanelSwitchItem::SetInitialAnimState(double fState)
 	fInitialAnimState = fState;
 }
 
+void PanelSwitchItem::SetVCAnimation(VESSEL *v, UINT anim, double state)
+
+{
+	if (vcPanel)
+		vcPanel->QueueAnimation(v, anim, state);
+	else
+		v->SetAnimation(anim, state);
+}
+
+void PanelSwitchItem::UpdateVCAnimation(VESSEL *v, UINT anim, double state)
+
+{
+	if (vcPanel)
+		vcPanel->UpdateAnimation(v, anim, state);
+	else
+		v->SetAnimation(anim, state);
+}
+
+bool PanelSwitchItem::NeedsRedraw(bool FlashOn)
+
+{
+	int ds;
+
+	if (!lastDrawValid || !GetDrawState(ds))
+		return true;
+
+	return (ds != lastDrawState) || ((FlashOn && flashing) != lastDrawFlash);
+}
+
+void PanelSwitchItem::SetDrawn(bool FlashOn)
+
+{
+	lastDrawValid = GetDrawState(lastDrawState);
+	lastDrawFlash = (FlashOn && flashing);
+}
+
 const VECTOR3& PanelSwitchItem::GetReference() const
 {
 	return reference;
@@ -352,6 +393,16 @@ bool TwoPositionSwitch::CheckMouseClick(int event, int mx, int my) {
 		return false;
 }
 
+bool TwoPositionSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	x0 = x;
+	y0 = y;
+	x1 = x + width;
+	y1 = y + height;
+	return true;
+}
+
 bool TwoPositionSwitch::DoCheckMouseClickVC(int event, VECTOR3 &p)
 {
 	int OldState = state;
@@ -438,16 +489,23 @@ void TwoPositionSwitch::DrawSwitch(SURFHANDLE DrawSurface)
 		DoDrawSwitch(DrawSurface);
 }
 
+bool TwoPositionSwitch::GetDrawState(int &drawState)
+
+{
+	drawState = (GetState() << 1) | (visible ? 1 : 0);
+	return true;
+}
+
 void TwoPositionSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf)
 {
 	if (!bHasAnimations) return;
 
 	if (IsUp()) {
-		OurVessel->SetAnimation(anim_switch, 1.0);
+		UpdateVCAnimation(OurVessel, anim_switch, 1.0);
 	}
 	else
 	{
-		OurVessel->SetAnimation(anim_switch, 0.0);
+		UpdateVCAnimation(OurVessel, anim_switch, 0.0);
 	}
 }
 
@@ -683,15 +741,15 @@ void ThreePosSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf)
 	if (!bHasAnimations) return;
 
 	if (IsUp()) {
-		OurVessel->SetAnimation(anim_switch, 1.0);
+		UpdateVCAnimation(OurVessel, anim_switch, 1.0);
 	}
 	else if (IsCenter())
 	{
-		OurVessel->SetAnimation(anim_switch, 0.5);
+		UpdateVCAnimation(OurVessel, anim_switch, 0.5);
 	}
 	else
 	{
-		OurVessel->SetAnimation(anim_switch, 0.0);
+		UpdateVCAnimation(OurVessel, anim_switch, 0.0);
 	}
 }
 
@@ -933,24 +991,24 @@ void FivePosSwitch::DefineVCAnimations(UINT vc_idx)
 void FivePosSwitch::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	if (state == FIVEPOSSWITCH_UP) {
-		OurVessel->SetAnimation(anim_switch, 0.5);
-		OurVessel->SetAnimation(anim_switchy, 1.0);
+		SetVCAnimation(OurVessel, anim_switch, 0.5);
+		SetVCAnimation(OurVessel, anim_switchy, 1.0);
 	}
 	else if (state == FIVEPOSSWITCH_RIGHT) {
-		OurVessel->SetAnimation(anim_switch, 1.0);
-		OurVessel->SetAnimation(anim_switchy, 0.5);
+		SetVCAnimation(OurVessel, anim_switch, 1.0);
+		SetVCAnimation(OurVessel, anim_switchy, 0.5);
 	}
 	else if (state == FIVEPOSSWITCH_DOWN) {
-		OurVessel->SetAnimation(anim_switch, 0.5);
-		OurVessel->SetAnimation(anim_switchy, 0.0);
+		SetVCAnimation(OurVessel, anim_switch, 0.5);
+		SetVCAnimation(OurVessel, anim_switchy, 0.0);
 	}
 	else if (state == FIVEPOSSWITCH_LEFT) {
-		OurVessel->SetAnimation(anim_switch, 0.0);
-		OurVessel->SetAnimation(anim_switchy, 0.5);
+		SetVCAnimation(OurVessel, anim_switch, 0.0);
+		SetVCAnimation(OurVessel, anim_switchy, 0.5);
 	}
 	else {
-		OurVessel->SetAnimation(anim_switch, 0.5);
-		OurVessel->SetAnimation(anim_switchy, 0.5);
+		SetVCAnimation(OurVessel, anim_switch, 0.5);
+		SetVCAnimation(OurVessel, anim_switchy, 0.5);
 	}
 }
 
@@ -1417,6 +1475,10 @@ SwitchRow::SwitchRow() {
 	SwitchList = 0;
 	RowList = 0;
 	PanelArea = (-1);
+	TrackChanges = true;
+	HitGridColumns = 0;
+	HitGridRows = 0;
+	HitGridValid = false;
 
 	RowPower = 0;
 }
@@ -1429,15 +1491,75 @@ bool SwitchRow::CheckMouseClick(int id, int event, int mx, int my) {
 	if (id != PanelArea)
 		return false;
 
-	PanelSwitchItem *s = SwitchList;
-	while (s) {
-		if (s->CheckMouseClick(event, mx, my))
+	if (!HitGridValid)
+		BuildHitGrid();
+
+	std::vector<PanelSwitchItem *> *candidates = &HitUnbounded;
+	if (mx >= 0 && my >= 0) {
+		int cx = mx / SWITCHROW_HIT_CELL;
+		int cy = my / SWITCHROW_HIT_CELL;
+		if (cx < HitGridColumns && cy < HitGridRows)
+			candidates = &HitGrid[cy * HitGridColumns + cx];
+	}
+
+	for (unsigned i = 0; i < candidates->size(); i++) {
+		if ((*candidates)[i]->CheckMouseClick(event, mx, my))
 			return true;
-		s = s->GetNext();
 	}
 	return false;
 }
 
+void SwitchRow::BuildHitGrid()
+
+{
+	int x0, y0, x1, y1;
+	PanelSwitchItem *s;
+
+	HitGrid.clear();
+	HitUnbounded.clear();
+	HitGridColumns = 0;
+	HitGridRows = 0;
+
+	//
+	// Size the grid to cover every item's rectangle.
+	//
+
+	s = SwitchList;
+	while (s) {
+		if (s->GetHitRect(x0, y0, x1, y1) && x0 >= 0 && y0 >= 0 && x1 >= x0 && y1 >= y0) {
+			HitGridColumns = max(HitGridColumns, x1 / SWITCHROW_HIT_CELL + 1);
+			HitGridRows = max(HitGridRows, y1 / SWITCHROW_HIT_CELL + 1);
+		}
+		s = s->GetNext();
+	}
+
+	HitGrid.resize(HitGridColumns * HitGridRows);
+
+	//
+	// Items without a usable rectangle go into every cell, and also get the clicks
+	// which fall outside the grid.
+	//
+
+	s = SwitchList;
+	while (s) {
+		if (!s->GetHitRect(x0, y0, x1, y1) || x0 < 0 || y0 < 0) {
+			HitUnbounded.push_back(s);
+			for (unsigned i = 0; i < HitGrid.size(); i++)
+				HitGrid[i].push_back(s);
+		}
+		else if (x1 >= x0 && y1 >= y0) {
+			for (int cy = y0 / SWITCHROW_HIT_CELL; cy <= y1 / SWITCHROW_HIT_CELL; cy++) {
+				for (int cx = x0 / SWITCHROW_HIT_CELL; cx <= x1 / SWITCHROW_HIT_CELL; cx++) {
+					HitGrid[cy * HitGridColumns + cx].push_back(s);
+				}
+			}
+		}
+		s = s->GetNext();
+	}
+
+	HitGridValid = true;
+}
+
 void SwitchRow::timestep(double missionTime)
 {
 	PanelSwitchItem *s = SwitchList;
@@ -1454,6 +1576,7 @@ void SwitchRow::AddSwitch(PanelSwitchItem *s)
 {
 	s->SetNext(SwitchList); 
 	SwitchList = s;
+	HitGridValid = false;
 
 	//
 	// If we have power, wire it to the switch. Unless someone's already connected it
@@ -1490,6 +1613,8 @@ void SwitchRow::Init(int area, PanelSwitches &panel, e_object *p) {
 	PanelArea = area;
 	panelSwitches = &panel;
 	RowPower = p;
+	TrackChanges = true;
+	HitGridValid = false;
 
 	panel.AddRow(this);
 }
@@ -1504,41 +1629,53 @@ bool SwitchRow::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn) {
 		s->DrawSwitch(DrawSurface);
 		if (FlashOn && s->IsFlashing())
 			s->DrawFlash(DrawSurface);
+		s->SetDrawn(FlashOn);
 		s = s->GetNext();
 	}
 	return true;
 }
 
+bool SwitchRow::NeedsRedraw(bool FlashOn) {
+
+	if (!TrackChanges)
+		return true;
+
+	PanelSwitchItem *s = SwitchList;
+	while (s) {
+		if (s->NeedsRedraw(FlashOn))
+			return true;
+		s = s->GetNext();
+	}
+	return false;
+}
+
 void PanelSwitchesVC::DefineVCAnimations(UINT vcidx)
 {
+	AnimationState.clear();
 	for (unsigned int i = 0; i < SwitchList.size(); i++)
 		SwitchList.at(i)->DefineVCAnimations(vcidx);
 }
 
 bool PanelSwitchesVC::VCMouseEvent(int id, int event, VECTOR3 &p)
 {
-	for (unsigned i = 0;i < SwitchList.size();i++)
-	{
-		if (id == SwitchArea[i])
-		{
-			return SwitchList[i]->CheckMouseClickVC(event, p);
-		}
-	}
-	return false;
+	std::unordered_map<int, std::vector<unsigned>>::iterator it = AreaIndex.find(id);
+	if (it == AreaIndex.end())
+		return false;
+
+	return SwitchList[it->second.front()]->CheckMouseClickVC(event, p);
 }
 
 bool PanelSwitchesVC::VCRedrawEvent(int id, int event, SURFHANDLE surf)
 {
-	bool bRedraw = false;
-	for (unsigned i = 0;i < SwitchList.size();i++)
+	std::unordered_map<int, std::vector<unsigned>>::iterator it = AreaIndex.find(id);
+	if (it == AreaIndex.end())
+		return false;
+
+	for (unsigned i = 0; i < it->second.size(); i++)
 	{
-		if (id == SwitchArea[i])
-		{
-			SwitchList[i]->DrawSwitchVC(id, event, surf);
-			bRedraw = true;
-		}
+		SwitchList[it->second[i]]->DrawSwitchVC(id, event, surf);
 	}
-	return bRedraw;
+	return true;
 }
 
 void PanelSwitchesVC::OnPostStep(double SimT, double DeltaT, double MJD)
@@ -1549,16 +1686,81 @@ void PanelSwitchesVC::OnPostStep(double SimT, double DeltaT, double MJD)
 	}
 }
 
+void PanelSwitchesVC::FlushAnimations()
+{
+	AnimationUpdates = (int)AnimationQueue.size() + RedrawUpdates;
+	RedrawUpdates = 0;
+	TotalAnimationUpdates += AnimationUpdates;
+	AnimationFlushes++;
+	for (unsigned i = 0; i < AnimationQueue.size(); i++)
+	{
+		AnimationQueue[i].v->SetAnimation(AnimationQueue[i].anim, AnimationQueue[i].state);
+	}
+	AnimationQueue.clear();
+}
+
+void PanelSwitchesVC::ApplyAnimation(VESSEL *v, UINT anim, double state)
+{
+	for (unsigned i = 0; i < AnimationQueue.size();)
+	{
+		if (AnimationQueue[i].anim == anim)
+			AnimationQueue.erase(AnimationQueue.begin() + i);
+		else
+			i++;
+	}
+
+	AnimationState[anim] = state;
+	v->SetAnimation(anim, state);
+}
+
+void PanelSwitchesVC::UpdateAnimation(VESSEL *v, UINT anim, double state)
+{
+	std::unordered_map<UINT, double>::iterator it = AnimationState.find(anim);
+	if (it != AnimationState.end() && it->second == state) return;
+
+	ApplyAnimation(v, anim, state);
+	RedrawUpdates++;
+}
+
+void PanelSwitchesVC::QueueAnimation(VESSEL *v, UINT anim, double state)
+{
+	std::unordered_map<UINT, double>::iterator it = AnimationState.find(anim);
+	if (it != AnimationState.end())
+	{
+		if (it->second == state) return;
+		it->second = state;
+	}
+	else
+	{
+		AnimationState[anim] = state;
+	}
+
+	VCAnimationChange change;
+	change.v = v;
+	change.anim = anim;
+	change.state = state;
+	AnimationQueue.push_back(change);
+}
+
 void PanelSwitchesVC::AddSwitch(PanelSwitchItem *s, int area)
 {
+	AreaIndex[area].push_back((unsigned)SwitchList.size());
 	SwitchList.push_back(s);
 	SwitchArea.push_back(area);
+	s->SetVCPanel(this);
 }
 
 void PanelSwitchesVC::ClearSwitches()
 {
+	for (unsigned i = 0; i < SwitchList.size(); i++)
+	{
+		SwitchList[i]->SetVCPanel(0);
+	}
 	SwitchList.clear();
 	SwitchArea.clear();
+	AreaIndex.clear();
+	AnimationQueue.clear();
+	AnimationState.clear();
 }
 
 //
@@ -1609,6 +1811,19 @@ bool PanelSwitches::DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn) {
 	return false;
 }
 
+bool PanelSwitches::IsRowUnchanged(int id, bool FlashOn) {
+
+	SwitchRow *row = RowList;
+
+	while (row) {
+		if (row->GetPanelArea() == id)
+			return !row->NeedsRedraw(FlashOn);
+		row = row->GetNext();
+	}
+
+	return false;
+}
+
 bool PanelSwitches::SetFlashing(const char *n, bool flash)
 
 {
@@ -1834,14 +2049,22 @@ void GuardedToggleSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf) {
 
 	if (guardAnim != -1) {
 		if (guardState) {
-			OurVessel->SetAnimation(guardAnim, 1.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 1.0);
 		}
 		else {
-			OurVessel->SetAnimation(guardAnim, 0.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 0.0);
 		}
 	}
 }
 
+bool GuardedToggleSwitch::GetDrawState(int &drawState)
+
+{
+	ToggleSwitch::GetDrawState(drawState);
+	drawState = (drawState << 1) | (guardState ? 1 : 0);
+	return true;
+}
+
 void GuardedToggleSwitch::DrawFlash(SURFHANDLE DrawSurface)
 
 {
@@ -1927,6 +2150,17 @@ void GuardedToggleSwitch::DefineVCAnimations(UINT vc_idx)
 	}
 }
 
+bool GuardedToggleSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	ToggleSwitch::GetHitRect(x0, y0, x1, y1);
+	x0 = min(x0, guardX);
+	y0 = min(y0, guardY);
+	x1 = max(x1, guardX + guardWidth);
+	y1 = max(y1, guardY + guardHeight);
+	return true;
+}
+
 bool GuardedToggleSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
 
 	if (event & PANEL_MOUSE_RBDOWN && p.x > 0.004) {
@@ -2047,6 +2281,14 @@ void GuardedPushSwitch::DoDrawSwitch(SURFHANDLE DrawSurface)
 		TwoPositionSwitch::DoDrawSwitch(DrawSurface);
 }
 
+bool GuardedPushSwitch::GetDrawState(int &drawState)
+
+{
+	PushSwitch::GetDrawState(drawState);
+	drawState = (drawState << 2) | (guardState ? 2 : 0) | (lit ? 1 : 0);
+	return true;
+}
+
 void GuardedPushSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 
 	if (!visible) return;
@@ -2090,10 +2332,10 @@ void GuardedPushSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf) {
 
 	if (guardAnim != -1) {
 		if (guardState) {
-			OurVessel->SetAnimation(guardAnim, 1.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 1.0);
 		}
 		else {
-			OurVessel->SetAnimation(guardAnim, 0.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 0.0);
 		}
 	}
 }
@@ -2145,6 +2387,17 @@ bool GuardedPushSwitch::CheckMouseClick(int event, int mx, int my)
 	return false;
 }
 
+bool GuardedPushSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	PushSwitch::GetHitRect(x0, y0, x1, y1);
+	x0 = min(x0, guardX);
+	y0 = min(y0, guardY);
+	x1 = max(x1, guardX + guardWidth);
+	y1 = max(y1, guardY + guardHeight);
+	return true;
+}
+
 bool GuardedPushSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
 
 	if (event & PANEL_MOUSE_RBDOWN) {
@@ -2261,6 +2514,14 @@ void GuardedThreePosSwitch::DefineVCAnimations(UINT vc_idx)
 	}
 }
 
+bool GuardedThreePosSwitch::GetDrawState(int &drawState)
+
+{
+	ThreePosSwitch::GetDrawState(drawState);
+	drawState = (drawState << 1) | (guardState ? 1 : 0);
+	return true;
+}
+
 void GuardedThreePosSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 
 	if (!visible) return;
@@ -2294,10 +2555,10 @@ void GuardedThreePosSwitch::DrawSwitchVC(int id, int event, SURFHANDLE surf) {
 
 	if (guardAnim != -1) {
 		if (guardState) {
-			OurVessel->SetAnimation(guardAnim, 1.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 1.0);
 		}
 		else {
-			OurVessel->SetAnimation(guardAnim, 0.0);
+			UpdateVCAnimation(OurVessel, guardAnim, 0.0);
 		}
 	}
 }
@@ -2350,6 +2611,17 @@ bool GuardedThreePosSwitch::CheckMouseClick(int event, int mx, int my) {
 	return false;
 }
 
+bool GuardedThreePosSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	ThreePosSwitch::GetHitRect(x0, y0, x1, y1);
+	x0 = min(x0, guardX);
+	y0 = min(y0, guardY);
+	x1 = max(x1, guardX + guardWidth);
+	y1 = max(y1, guardY + guardHeight);
+	return true;
+}
+
 bool GuardedThreePosSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
 
 	if (event & PANEL_MOUSE_RBDOWN && p.x > 0.004) {
@@ -2591,6 +2863,13 @@ void RotationalSwitch::DrawSwitch(SURFHANDLE drawSurface) {
 	}
 }
 
+bool RotationalSwitch::GetDrawState(int &drawState)
+
+{
+	drawState = GetState();
+	return true;
+}
+
 void RotationalSwitch::DrawFlash(SURFHANDLE DrawSurface)
 
 {
@@ -2730,7 +3009,17 @@ void RotationalSwitch::DrawSwitchVC(int id, int event, SURFHANDLE drawSurface)
 
 	if (position) state = position->GetAngle();
 
-	OurVessel->SetAnimation(anim_switch, state / 360);
+	UpdateVCAnimation(OurVessel, anim_switch, state / 360);
+}
+
+bool RotationalSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	x0 = x;
+	y0 = y;
+	x1 = x + width;
+	y1 = y + height;
+	return true;
 }
 
 bool RotationalSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
@@ -2914,7 +3203,7 @@ void OrdealRotationalSwitch::DrawSwitch(SURFHANDLE drawSurface) {
 
 void OrdealRotationalSwitch::DrawSwitchVC(int id, int event, SURFHANDLE drawSurface) {
 
-	OurVessel->SetAnimation(anim_switch, ((double)value / 310) * 0.78);
+	UpdateVCAnimation(OurVessel, anim_switch, ((double)value / 310) * 0.78);
 	//sprintf(oapiDebugString(), "ALT %d", value);
 }
 
@@ -3137,6 +3426,16 @@ void ThumbwheelSwitch::DefineVCAnimations(UINT vc_idx)
 	}
 }
 
+bool ThumbwheelSwitch::GetHitRect(int &x0, int &y0, int &x1, int &y1)
+
+{
+	x0 = x;
+	y0 = y;
+	x1 = x + width;
+	y1 = y + height;
+	return true;
+}
+
 bool ThumbwheelSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
 
 	int OldState = state;
@@ -3177,7 +3476,14 @@ void ThumbwheelSwitch::DrawSwitch(SURFHANDLE DrawSurface) {
 void ThumbwheelSwitch::DrawSwitchVC(int id, int event, SURFHANDLE drawSurface) {
 
 	double s = ((double)state) / ((double)maxState);
-	OurVessel->SetAnimation(anim_switch, s);
+	UpdateVCAnimation(OurVessel, anim_switch, s);
+}
+
+bool ThumbwheelSwitch::GetDrawState(int &drawState)
+
+{
+	drawState = state;
+	return true;
 }
 
 void ThumbwheelSwitch::DrawFlash(SURFHANDLE DrawSurface)
@@ -3382,7 +3688,7 @@ bool ContinuousThumbwheelSwitch::CheckMouseClickVC(int event, VECTOR3 &p) {
 void ContinuousThumbwheelSwitch::DrawSwitchVC(int id, int event, SURFHANDLE drawSurface) {
 
 	double s = position / (double)numPositions;
-	OurVessel->SetAnimation(anim_switch, s);
+	UpdateVCAnimation(OurVessel, anim_switch, s);
 }
 
 bool ContinuousThumbwheelSwitch::SwitchTo(int newPosition) {
@@ -3814,7 +4120,7 @@ void CurvedMeter::DefineVCAnimations(UINT vc_idx)
 void CurvedMeter::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	double v = (GetDisplayValue() - minValue) / (maxValue - minValue);
-	OurVessel->SetAnimation(anim_switch, v);
+	SetVCAnimation(OurVessel, anim_switch, v);
 }
 
 LinearMeter::LinearMeter()
@@ -3842,7 +4148,7 @@ void LinearMeter::DefineVCAnimations(UINT vc_idx)
 void LinearMeter::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	double v = (GetDisplayValue() - minValue) / (maxValue - minValue);
-	OurVessel->SetAnimation(anim_switch, v);
+	SetVCAnimation(OurVessel, anim_switch, v);
 }
 
 RoundMeter::RoundMeter()
@@ -3889,7 +4195,7 @@ void RoundMeter::DefineVCAnimations(UINT vc_idx)
 void RoundMeter::OnPostStep(double SimT, double DeltaT, double MJD)
 {
 	double v = (GetDisplayValue() - minValue) / (maxValue - minValue);
-	OurVessel->SetAnimation(anim_switch, v);
+	SetVCAnimation(OurVessel, anim_switch, v);
 }
 
 void RoundMeter::DrawNeedle (SURFHANDLE surf, int x, int y, double rad, double angle)
@@ -3992,10 +4298,21 @@ double DCAmpMeter::QueryValue()
 // Panel Switch Scenario Handler
 //
 
+std::string PanelSwitchScenarioHandler::SwitchKey(const char *n, size_t len) {
+
+	std::string key(n, len);
+	for (size_t i = 0; i < key.size(); i++)
+		key[i] = (char)tolower((unsigned char)key[i]);
+	return key;
+}
+
 void PanelSwitchScenarioHandler::RegisterSwitch(PanelSwitchItem *s) {
 
 	s->SetNextForScenario(switchList); 
 	switchList = s; 
+
+	if (s->GetName())
+		switchIndex[SwitchKey(s->GetName(), strlen(s->GetName()))].push_back(s);
 }
 
 void PanelSwitchScenarioHandler::SaveState(FILEHANDLE scn) {
@@ -4011,6 +4328,40 @@ void PanelSwitchScenarioHandler::SaveState(FILEHANDLE scn) {
 	oapiWriteLine(scn, PANELSWITCH_END_STRING);
 }
 
+bool PanelSwitchScenarioHandler::DispatchLine(char *line) {
+
+	//
+	// The item name is the first word on the line, as the items read it with sscanf.
+	//
+	const char *start = line;
+	while (isspace((unsigned char)*start))
+		start++;
+	size_t len = 0;
+	while (start[len] && !isspace((unsigned char)start[len]))
+		len++;
+
+	//
+	// Items take every line whose first word starts with their name, so besides the
+	// exact name look up each shorter prefix of the word. That hands the line to the
+	// same items the old walk over the whole list did. The empty prefix is included,
+	// an item with an empty name matched every line.
+	//
+	bool found = false;
+	for (size_t n = len + 1; n > 0; n--) {
+		std::unordered_map<std::string, std::vector<PanelSwitchItem *> >::iterator it = switchIndex.find(SwitchKey(start, n - 1));
+		if (it == switchIndex.end())
+			continue;
+
+		//
+		// Newest first, the same order as the scenario list.
+		//
+		for (size_t i = it->second.size(); i > 0; i--)
+			it->second[i - 1]->LoadState(line);
+		found = true;
+	}
+	return found;
+}
+
 void PanelSwitchScenarioHandler::LoadState(FILEHANDLE scn) {
 
 	char * line;
@@ -4019,23 +4370,27 @@ void PanelSwitchScenarioHandler::LoadState(FILEHANDLE scn) {
 		if (!strnicmp(line, PANELSWITCH_END_STRING, strlen(PANELSWITCH_END_STRING)))
 			return;
 
-		PanelSwitchItem *s = switchList;
-		while (s) {
-			s->LoadState(line);
-			s = s->GetNextForScenario();
+		if (!DispatchLine(line)) {
+			char logbuf[256];
+			sprintf(logbuf, "(PanelSwitch) No panel item takes scenario line \"%.200s\", ignored.", line);
+			oapiWriteLog(logbuf);
 		}
 	}
 }
 
 PanelSwitchItem* PanelSwitchScenarioHandler::GetSwitch(char *name) {
 
-	PanelSwitchItem *s = switchList;
-	while (s) {
-		if (!stricmp(s->GetName(), name)) 
-			return s;
-		s = s->GetNextForScenario();
-	}
-	return 0;
+	if (!name)
+		return 0;
+
+	//
+	// The list is built by prepending, so the most recently registered item
+	// with a given name is the one the old list walk returned.
+	//
+	std::unordered_map<std::string, std::vector<PanelSwitchItem *> >::iterator it = switchIndex.find(SwitchKey(name, strlen(name)));
+	if (it == switchIndex.end())
+		return 0;
+	return it->second.back();
 }
 
 
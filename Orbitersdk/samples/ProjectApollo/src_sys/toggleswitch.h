@@ -33,6 +33,8 @@
 #include "nasspsound.h"
 
 #include <vector>
+#include <string>
+#include <unordered_map>
 #include "cautionwarning.h"
 #include "powersource.h"
 #include "nasspdefs.h"
@@ -71,9 +73,12 @@
 #define TIME_UPDATE_MINUTES 1
 #define TIME_UPDATE_HOURS	2
 
+#define SWITCHROW_HIT_CELL	32		///< Size in pixels of the switch row mouse hit-test grid cells.
+
 class SwitchRow;
 class PanelSwitchScenarioHandler;
 class PanelSwitchCallbackInterface;
+class PanelSwitchesVC;
 
 class PanelSwitchCallbackInterface;
 ///
@@ -124,6 +129,19 @@ public:
 	///
 	virtual bool CheckMouseClick(int event, int mx, int my) = 0;
 
+	///
+	/// Switch rows use this to only offer mouse clicks to items they could be for. Items
+	/// which can react to clicks outside a fixed rectangle keep the default, and get offered
+	/// every click in their panel area. An empty rectangle means the item ignores clicks.
+	/// \brief Get the panel area rectangle this item accepts mouse clicks in.
+	/// \param x0 Set to the left edge.
+	/// \param y0 Set to the top edge.
+	/// \param x1 Set to the right edge, inclusive.
+	/// \param y1 Set to the bottom edge, inclusive.
+	/// \return True if the rectangle is valid, false if the item must see every click.
+	///
+	virtual bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { return false; };
+
 	///
 	/// \brief Draw the switch with its current state and position.
 	/// \param DrawSurface Surface to draw the switch into.
@@ -143,6 +161,29 @@ public:
 	virtual void LoadState(char *line) = 0;
 	virtual void DrawFlash(SURFHANDLE DrawSurface) {};
 
+	///
+	/// Items whose 2D panel image only depends on a few of their own values can pack those
+	/// into one integer here, so a switch row can tell whether anything changed since it was
+	/// last drawn. Items showing live values (meters, talkbacks, anything reading other
+	/// systems) keep the default and are always redrawn.
+	/// \brief Get a value summarising how the item currently looks.
+	/// \param drawState Set to the summary value.
+	/// \return True if the summary is valid, false if the item must always be redrawn.
+	///
+	virtual bool GetDrawState(int &drawState) { return false; };
+
+	///
+	/// \brief Check whether the item looks different from when it was last drawn.
+	/// \param FlashOn True if the flash border is currently showing.
+	///
+	bool NeedsRedraw(bool FlashOn);
+
+	///
+	/// \brief Remember how the item looked when it was drawn.
+	/// \param FlashOn True if the flash border is currently showing.
+	///
+	void SetDrawn(bool FlashOn);
+
 	///
 	/// Each object has a human-readable displayable name. Normally this will be a
 	/// pre-initialised string rather than a dynamic name, so we just copy the pointer
@@ -231,6 +272,33 @@ public:
 	virtual void SetDirection(const VECTOR3& _dir);
 	void SetInitialAnimState(double fState);
 	double InitialAnimState() const { return fInitialAnimState; };
+
+	///
+	/// \brief Set the VC panel this item was added to.
+	///
+	void SetVCPanel(PanelSwitchesVC *p) { vcPanel = p; };
+	
+protected:
+
+	///
+	/// Animations updated every timestep from OnPostStep should be set through this, so
+	/// the VC panel can pass on only the ones which actually changed.
+	/// \brief Set a VC animation state.
+	/// \param v Vessel owning the animation.
+	/// \param anim Animation ID.
+	/// \param state New animation state.
+	///
+	void SetVCAnimation(VESSEL *v, UINT anim, double state);
+
+	///
+	/// VC redraw events come after the timestep, so DrawSwitchVC sets its animations through
+	/// this. It passes the state to the vessel right away, but only if it changed.
+	/// \brief Set a VC animation state from a redraw event.
+	/// \param v Vessel owning the animation.
+	/// \param anim Animation ID.
+	/// \param state New animation state.
+	///
+	void UpdateVCAnimation(VESSEL *v, UINT anim, double state);
 	
 protected:
 
@@ -294,9 +362,17 @@ protected:
 	VECTOR3 reference;
 	VECTOR3 dir;
 
+	///
+	/// \brief Draw state and flash state from the last time the item was drawn.
+	///
+	int lastDrawState;
+	bool lastDrawFlash;
+	bool lastDrawValid;
+
 	PanelSwitchItem *next;
 	PanelSwitchItem *nextForScenario;
 	PanelSwitchCallbackInterface *callback;
+	PanelSwitchesVC *vcPanel;
 };
 
 ///
@@ -330,6 +406,7 @@ public:
 	void ClearToggled() { SwitchToggled = false; };
 	
 	void DrawFlash(SURFHANDLE DrawSurface);
+	virtual bool GetDrawState(int &drawState);
 	void SetBorderSurface(SURFHANDLE border) { BorderSurface = border; };
 
 	virtual bool IsUp() { return (GetState() == TOGGLESWITCH_UP); };
@@ -340,6 +417,7 @@ public:
 	virtual void DrawSwitch(SURFHANDLE DrawSurface);
 	virtual void DrawSwitchVC(int id, int event, SURFHANDLE surf);
 	virtual bool CheckMouseClick(int event, int mx, int my);
+	virtual bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	virtual bool CheckMouseClickVC(int event, VECTOR3 &p);
 	virtual void VesimSwitchTo(int newState);
 	virtual void DefineVCAnimations(UINT vc_idx) = 0;
@@ -425,6 +503,7 @@ class AttitudeToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	virtual bool SwitchTo(int newState, bool dontspring = false);
 
 };
@@ -437,6 +516,7 @@ class NavModeToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, VESSEL *v, int mode, SoundLib &s);
 	virtual bool SwitchTo(int newState, bool dontspring = false);
 
@@ -452,6 +532,7 @@ class HUDToggle: public ToggleSwitch {
 
 public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState) { return false; };
 	bool CheckMouseClick(int event, int mx, int my);
 	void Init(int xp, int yp, int w, int h, SURFHANDLE surf, SURFHANDLE bsurf, SwitchRow &row, int mode, SoundLib &s);
 	virtual bool SwitchTo(int newState,bool dontspring = false);
@@ -493,6 +574,7 @@ public:
 	virtual ~FivePosSwitch();
 	void DefineVCAnimations(UINT vc_idx);
 	void DrawSwitch(SURFHANDLE DrawSurface);
+	void DrawSwitchVC(int id, int event, SURFHANDLE surf) {};	// Animated from OnPostStep
 	void OnPostStep(double SimT, double DeltaT, double MJD);
 	bool CheckMouseClick(int event, int mx, int my);
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
@@ -947,7 +1029,9 @@ public:
 	void DrawSwitch(SURFHANDLE DrawSurface);
 	void DrawSwitchVC(int id, int event, SURFHANDLE surf);
 	void DrawFlash(SURFHANDLE DrawSurface);
+	bool GetDrawState(int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	void VesimSwitchTo(int newState);
 	void SaveState(FILEHANDLE scn);
@@ -1081,7 +1165,9 @@ public:
 	void DrawSwitchVC(int id, int event, SURFHANDLE surf);
 	void DrawFlash(SURFHANDLE DrawSurface);
 	void DoDrawSwitch(SURFHANDLE drawSurface);
+	bool GetDrawState(int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -1132,7 +1218,9 @@ public:
 				   int xOffset = 0, int yOffset = 0);
 	void DrawSwitch(SURFHANDLE DrawSurface);
 	void DrawSwitchVC(int id, int event, SURFHANDLE surf);
+	bool GetDrawState(int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
@@ -1197,7 +1285,9 @@ public:
 	void AddPosition(int value, double angle);
 	void DrawSwitch(SURFHANDLE drawSurface);
 	void DrawFlash(SURFHANDLE drawSurface);
+	virtual bool GetDrawState(int &drawState);
 	virtual bool CheckMouseClick(int event, int mx, int my);
+	virtual bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	virtual bool SwitchTo(int newValue);
 	virtual void SaveState(FILEHANDLE scn);
 	virtual void LoadState(char *line);
@@ -1261,8 +1351,10 @@ class OrdealRotationalSwitch : public RotationalSwitch {
 public:
 	OrdealRotationalSwitch() { value = 100; lastX = 0; mouseDown = false; };
 	virtual void DrawSwitch(SURFHANDLE drawSurface);
+	virtual bool GetDrawState(int &drawState) { return false; };
 	virtual void DrawSwitchVC(int id, int event, SURFHANDLE drawSurface);
 	virtual bool CheckMouseClick(int event, int mx, int my);
+	virtual bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { return false; };	// Keeps tracking drags outside the switch
 	virtual bool CheckMouseClickVC(int event, VECTOR3 &p);
 	virtual void SaveState(FILEHANDLE scn);
 	virtual void LoadState(char *line);
@@ -1286,6 +1378,7 @@ public:
 	void DrawSwitchVC(int id, int event, SURFHANDLE drawSurface);
 	void InitVC(SURFHANDLE surf);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { x0 = y0 = 0; x1 = y1 = -1; return true; };
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
 	virtual int GetState() { return state; };
@@ -1319,6 +1412,7 @@ public:
 	void Init(SwitchRow &row);
 	void DrawSwitch(SURFHANDLE drawSurface);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { x0 = y0 = 0; x1 = y1 = -1; return true; };
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
 	double GetDisplayValue();
@@ -1390,7 +1484,9 @@ public:
 	void DrawSwitch(SURFHANDLE drawSurface);
 	void DrawSwitchVC(int id, int event, SURFHANDLE drawSurface);
 	void DrawFlash(SURFHANDLE drawSurface);
+	virtual bool GetDrawState(int &drawState);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1);
 	bool CheckMouseClickVC(int event, VECTOR3 &p);
 	virtual bool SwitchTo(int newState);
 	void SaveState(FILEHANDLE scn);
@@ -1457,6 +1553,7 @@ public:
 	void DrawSwitch(SURFHANDLE drawSurface);
 	void DrawFlash(SURFHANDLE drawSurface);
 	bool CheckMouseClick(int event, int mx, int my);
+	bool GetHitRect(int &x0, int &y0, int &x1, int &y1) { return false; };	// Releases on any button up
 	void SaveState(FILEHANDLE scn);
 	void LoadState(char *line);
 	int GetState();
@@ -1504,6 +1601,21 @@ public:
 	SwitchRow *GetNext() { return RowList; };
 	void SetNext(SwitchRow *s) { RowList = s; };
 	void timestep(double missionTime);
+	int GetPanelArea() { return PanelArea; };
+
+	///
+	/// \brief Check whether any item in the row looks different from when it was last drawn.
+	/// \param FlashOn True if flash borders are currently showing.
+	/// \return True if the row has to be redrawn.
+	///
+	bool NeedsRedraw(bool FlashOn);
+
+	///
+	/// Rows on panel areas which also draw things of their own in the redraw callback
+	/// must always be redrawn, since the row can't see those changes.
+	/// \brief Enable or disable skipping redraws when nothing changed.
+	///
+	void SetTrackChanges(bool t) { TrackChanges = t; };
 
 	///
 	/// Look up a panel switch item by its name.
@@ -1514,10 +1626,24 @@ public:
 	PanelSwitchItem *GetItemByName(const char *n);
 
 protected:
+	///
+	/// Splits the panel area into square cells, each listing the items whose hit rectangle
+	/// covers it in row order, so a mouse click only has to be offered to those.
+	/// \brief Build the mouse hit-test grid.
+	///
+	void BuildHitGrid();
+
 	PanelSwitchItem *SwitchList;
 	SwitchRow *RowList;
 	int PanelArea;
 	PanelSwitches *panelSwitches;
+	bool TrackChanges;
+
+	std::vector<std::vector<PanelSwitchItem *>> HitGrid;
+	std::vector<PanelSwitchItem *> HitUnbounded;
+	int HitGridColumns;
+	int HitGridRows;
+	bool HitGridValid;
 
 	e_object *RowPower;
 
@@ -1547,16 +1673,68 @@ public:
 class PanelSwitchesVC
 {
 public:
-	PanelSwitchesVC() {}
+	PanelSwitchesVC() { AnimationUpdates = 0; RedrawUpdates = 0; TotalAnimationUpdates = 0; AnimationFlushes = 0; }
 	void DefineVCAnimations(UINT vcidx);
 	bool VCMouseEvent(int id, int event, VECTOR3 &p);
 	bool VCRedrawEvent(int id, int event, SURFHANDLE surf);
 	void OnPostStep(double SimT, double DeltaT, double MJD);
 	void AddSwitch(PanelSwitchItem *s, int area = -1);
 	void ClearSwitches();
+
+	///
+	/// Changes are queued during the timestep, by the panel items and by the vessel systems,
+	/// and passed to the vessel in one batch by FlushAnimations. Animations which are already
+	/// in the requested state are dropped.
+	/// \brief Queue an animation change.
+	///
+	void QueueAnimation(VESSEL *v, UINT anim, double state);
+
+	///
+	/// For states set outside of the timestep, like when animations are defined. Drops queued
+	/// changes of the animation and keeps the new state, so the queue compares with it.
+	/// \brief Set an animation state immediately.
+	///
+	void ApplyAnimation(VESSEL *v, UINT anim, double state);
+
+	///
+	/// For redraw events, which run after FlushAnimations. Sets the state immediately like
+	/// ApplyAnimation, but drops it if the animation is already in that state.
+	/// \brief Set an animation state immediately if it changed.
+	///
+	void UpdateAnimation(VESSEL *v, UINT anim, double state);
+
+	///
+	/// \brief Pass the queued animation changes to the vessel, once at the end of each timestep.
+	///
+	void FlushAnimations();
+
+	///
+	/// \brief Number of animation changes passed to the vessel by the last FlushAnimations, and by redraw events since the one before.
+	///
+	int GetAnimationUpdates() { return AnimationUpdates; };
+
+	///
+	/// \brief Average number of animation changes passed to the vessel per FlushAnimations.
+	///
+	double GetAverageAnimationUpdates() { return AnimationFlushes ? (double)TotalAnimationUpdates / (double)AnimationFlushes : 0.0; };
+
 protected:
 	std::vector<PanelSwitchItem*>SwitchList;
 	std::vector<int> SwitchArea;
+	std::unordered_map<int, std::vector<unsigned>> AreaIndex;
+
+	struct VCAnimationChange {
+		VESSEL *v;
+		UINT anim;
+		double state;
+	};
+
+	std::vector<VCAnimationChange> AnimationQueue;
+	std::unordered_map<UINT, double> AnimationState;
+	int AnimationUpdates;
+	int RedrawUpdates;
+	unsigned long long TotalAnimationUpdates;
+	unsigned long long AnimationFlushes;
 };
 
 class PanelSwitches {
@@ -1565,6 +1743,17 @@ public:
 	PanelSwitches() { PanelID = 0; RowList = 0; lastexecutedtime=MINUS_INFINITY;};
 	bool CheckMouseClick(int id, int event, int mx, int my);
 	bool DrawRow(int id, SURFHANDLE DrawSurface, bool FlashOn);
+
+	///
+	/// Panel areas are registered with PANEL_MAP_BACKGROUND, so a row can't redraw only some
+	/// of its items. Instead, for PANEL_REDRAW_ALWAYS events the redraw callback can check this
+	/// and return false to keep the previous image on the panel.
+	/// \brief Check whether the row for a panel area is unchanged since it was last drawn.
+	/// \param id Panel area ID.
+	/// \param FlashOn True if flash borders are currently showing.
+	/// \return True if a row owns the area and none of its items changed.
+	///
+	bool IsRowUnchanged(int id, bool FlashOn);
 	void AddRow(SwitchRow *s) { s->SetNext(RowList); RowList = s; };
 	void Init(int id, VESSEL *v, SoundLib *s, PanelSwitchListener *l) { PanelID = id; RowList = 0; vessel = v; soundlib = s; listener = l; };
 	void timestep(double missionTime);
@@ -1618,7 +1807,24 @@ public:
 	void LoadState(FILEHANDLE scn);
 
 protected:
+	///
+	/// \brief Hand a scenario line to every item whose name is a prefix of the line's first word.
+	/// \return True if at least one item took the line.
+	///
+	bool DispatchLine(char *line);
+
+	///
+	/// \brief Build the case-insensitive lookup key for an item name.
+	///
+	static std::string SwitchKey(const char *n, size_t len);
+
 	PanelSwitchItem *switchList;
+
+	///
+	/// Case-insensitive index of registered items by name, in registration order. Nothing
+	/// stops two items registering under the same name, and both used to get the line.
+	///
+	std::unordered_map<std::string, std::vector<PanelSwitchItem *> > switchIndex;
 };
 
 ///